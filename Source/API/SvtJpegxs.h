@@ -118,6 +118,36 @@ typedef struct svt_jpeg_xs_bitstream_buffer {
     uint8_t last_packet_in_frame;
 } svt_jpeg_xs_bitstream_buffer_t;
 
+/* Statistics of one slice, filled when statistics are enabled in encoder/decoder configuration.
+ * Timestamps are monotonic clock in nanoseconds.*/
+typedef struct svt_jpeg_xs_slice_stats {
+    uint64_t begin_ns;      /* Slice task start (encoder: RC, quantization and pack; decoder: unpack and IDWT) */
+    uint64_t end_ns;        /* Slice task finish */
+    uint8_t quantization;   /* Highest quantization used by precincts in slice */
+    uint8_t refinement;     /* Refinement of precinct with highest quantization */
+    uint32_t padding_bytes; /* Padding bytes written (encoder) or skipped (decoder) in slice */
+} svt_jpeg_xs_slice_stats_t;
+
+/* Statistics of one frame, owned by application and attached to svt_jpeg_xs_frame_t.
+ * Timestamps are monotonic clock in nanoseconds, 0 when stage does not exist in pipeline.*/
+typedef struct svt_jpeg_xs_frame_stats {
+    uint64_t send_ns;         /* Frame sent to library */
+    uint64_t init_begin_ns;   /* Init Stage take frame from input queue */
+    uint64_t init_end_ns;     /* Init Stage finish frame setup (decoder: parse header), next send slices tasks */
+    uint64_t dwt_begin_ns;    /* Encoder CPU profile: first component DWT start */
+    uint64_t dwt_end_ns;      /* Encoder CPU profile: last component DWT finish */
+    uint64_t slices_begin_ns; /* First slice task start */
+    uint64_t slices_end_ns;   /* Last slice task finish */
+    uint64_t final_ready_ns;  /* Final Stage receive last slice of frame */
+    uint64_t final_send_ns;   /* Final Stage send frame to output queue, after reorder */
+    uint64_t output_ns;       /* Frame received by application */
+    /* Per slice statistics, array allocated by application with slices_size elements.
+     * Library fill min(slices_num, slices_size) elements, slices can be NULL.*/
+    svt_jpeg_xs_slice_stats_t *slices;
+    uint32_t slices_size; /* Set by application */
+    uint32_t slices_num;  /* Set by library, number of slices in frame */
+} svt_jpeg_xs_frame_stats_t;
+
 typedef struct svt_jpeg_xs_frame {
     /*Common structure to keep input and output for encoder and decoder.
      *Encoder: image - is input and bitstream is output.
@@ -125,6 +155,15 @@ typedef struct svt_jpeg_xs_frame {
     svt_jpeg_xs_image_buffer_t image;         /* YUV buffer */
     svt_jpeg_xs_bitstream_buffer_t bitstream; /* Bitstream buffer */
     void *user_prv_ctx_ptr;                   /* Input user private context pointer, receive in output */
+    /* Optional statistics of frame, used only when statistics are enabled in configuration,
+     * filled by library and valid when frame is received in output.*/
+    svt_jpeg_xs_frame_stats_t *stats;
+    /* Optional line band streaming of frame, used only when streaming is enabled in configuration,
+     * then image and bitstream buffers are not used.*/
+    const struct svt_jpeg_xs_stream *stream;
+    /* Source codestream of frame, used only when transcode is enabled in encoder configuration, then image is not used.
+     * Buffer have to be valid until frame is received in output.*/
+    const svt_jpeg_xs_bitstream_buffer_t *transcode_source;
 } svt_jpeg_xs_frame_t;
 
 typedef enum SvtJxsErrorType {
@@ -158,6 +197,28 @@ typedef enum SvtJxsErrorType {
     SvtJxsErrorMax = 0x7FFFFFFF
 } SvtJxsErrorType_t;
 
+/* Line band streaming of one frame, set in svt_jpeg_xs_frame_t::stream.
+ * Encoder calls callbacks from slice threads, also at the same time for different slices of frame, so have to be thread safe.
+ * Decoder calls callbacks from thread of svt_jpeg_xs_decode_frame_sync().
+ * Return SvtJxsErrorNone, any other value mark frame as failed.*/
+typedef struct svt_jpeg_xs_stream {
+    /* Encoder: copy lines_num lines of component starting from first_line to out, out_stride is distance between lines
+     * in samples. Packed formats use only component 0 with interleaved samples. Lines around slice used by vertical DWT
+     * are read also with neighbouring slices, so the same line can be read more than once.*/
+    SvtJxsErrorType_t (*read_lines)(void *context, uint32_t component, uint32_t first_line, uint32_t lines_num, void *out,
+                                    uint32_t out_stride);
+    /* Encoder: write size bytes of codestream at offset from begin of frame. Header is written first, next slices
+     * in order of finish. Offsets are known from rate control budget per slice, size of frame is bitstream.used_size
+     * of frame received by svt_jpeg_xs_encoder_get_packet().*/
+    SvtJxsErrorType_t (*write_bytes)(void *context, uint32_t offset, const uint8_t *data, uint32_t size);
+    /* Decoder: lines_num decoded lines of component starting from first_line, in_stride is distance between lines
+     * in samples. Lines of every component are written in order from top to bottom, each line once, after slice
+     * is decoded. Buffer is valid only during call.*/
+    SvtJxsErrorType_t (*write_lines)(void *context, uint32_t component, uint32_t first_line, uint32_t lines_num,
+                                     const void *in, uint32_t in_stride);
+    void *context;
+} svt_jpeg_xs_stream_t;
+
 typedef enum {
     proxy_mode_full = 0,    //0 - Off, decode the stream to Full resolution
     proxy_mode_half = 1,    //1 - Proxy-Mode 1/2, decode the stream to half the Width and Height
@@ -165,6 +226,21 @@ typedef enum {
     proxy_mode_max
 } proxy_mode_t;
 
+/* Preset of pipeline queue depths in encoder and decoder, explicit queue sizes override preset. */
+typedef enum {
+    pipeline_preset_default = 0,        //0 - Balance between memory, latency and throughput
+    pipeline_preset_min_latency = 1,    //1 - Queues sized for one frame in flight, lowest memory and latency
+    pipeline_preset_max_throughput = 2, //2 - Deep queues for batch processing, more frames in flight
+    pipeline_preset_max
+} pipeline_preset_t;
+
+/* Memory of working buffers (memory_flags of encoder, decoder and svt_jpeg_xs_frame_pool_alloc_with_memory_flags()).
+ * With any flag set, all buffers of instance are allocated from few big regions (arena) released on close. */
+#define SVT_JPEGXS_MEMORY_DEFAULT    (0)      //Every buffer allocated separately from heap
+#define SVT_JPEGXS_MEMORY_ARENA      (1 << 0) //Arena of normal pages
+#define SVT_JPEGXS_MEMORY_HUGE_PAGES (1 << 1) //Arena of 2 MiB huge pages, fallback to transparent huge pages or normal pages
+#define SVT_JPEGXS_MEMORY_LOCK       (1 << 2) //Lock arena in RAM (mlock), keep unlocked when lock limit is exceeded
+
 /**
 CPU FLAGS
 */
@@ -190,6 +266,72 @@ typedef uint64_t CPU_FLAGS;
 #define CPU_FLAGS_ALL      ((CPU_FLAGS_NEON << 1) - 1)
 #define CPU_FLAGS_INVALID  (1ULL << (sizeof(CPU_FLAGS) * 8ULL - 1ULL))
 
+/**
+THREAD POOL
+Pool of worker threads that can be shared by many encoder and decoder instances.
+When pool is set in encoder/decoder configuration, slice tasks of that instance
+are executed by threads of the pool instead of threads created by the instance.
+Workers serve instances round robin: each free worker takes one pending task of
+the next instance that has pending tasks, so an instance with many queued slices
+does not delay the others. Order of frames is kept inside each instance.
+*/
+typedef struct svt_jpeg_xs_thread_pool svt_jpeg_xs_thread_pool_t;
+
+/* Create thread pool.
+ * Parameter:
+ * @ version_api_major - Use version of API Major number (SVT_JPEGXS_API_VER_MAJOR)
+ * @ version_api_minor - Use version of API Minor number (SVT_JPEGXS_API_VER_MINOR)
+ * @ **pool            - Return pointer to created pool
+ * @ threads_num       - Number of worker threads, have to be bigger than 0*/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_thread_pool_create(uint64_t version_api_major, uint64_t version_api_minor,
+                                                            svt_jpeg_xs_thread_pool_t **pool, uint32_t threads_num);
+
+/* Destroy thread pool. Close all encoders and decoders that use the pool before.*/
+PREFIX_API void svt_jpeg_xs_thread_pool_destroy(svt_jpeg_xs_thread_pool_t *pool);
+
+/**
+THREAD PLACEMENT
+Pin threads of encoder/decoder instance to selected CPUs, prefer memory of selected NUMA node
+for buffers allocated by instance and set realtime priority of threads.
+Slice stage threads (encoder DWT and Pack, decoder Universal) can use separate CPU set.
+CPU pinning and NUMA binding are supported only on Linux, CPU pinning on Windows is limited to first 64 CPUs.
+*/
+#define SVT_JPEGXS_CPU_SET_SIZE (1024)
+
+typedef struct svt_jpeg_xs_cpu_set {
+    uint64_t bits[SVT_JPEGXS_CPU_SET_SIZE / 64];
+} svt_jpeg_xs_cpu_set_t;
+
+#define SVT_JPEGXS_CPU_SET_ADD(set, cpu)   ((set)->bits[(cpu) / 64] |= (1ULL << ((cpu) % 64)))
+#define SVT_JPEGXS_CPU_SET_CHECK(set, cpu) (((set)->bits[(cpu) / 64] >> ((cpu) % 64)) & 1)
+
+typedef struct svt_jpeg_xs_thread_placement {
+    /* CPUs of all threads, empty set - threads are not pinned, or pinned to CPUs of numa_node if set. */
+    svt_jpeg_xs_cpu_set_t cpu_set;
+    /* CPUs of slice stage threads, empty set - use cpu_set. */
+    svt_jpeg_xs_cpu_set_t slice_cpu_set;
+    /* NUMA node preferred for threads and allocated buffers, -1 - no binding. */
+    int32_t numa_node;
+    /* 0 - default scheduling, 1-99 - realtime (SCHED_FIFO) priority, require root privileges. */
+    int32_t rt_priority;
+} svt_jpeg_xs_thread_placement_t;
+
+/* Set default placement: empty CPU sets, no NUMA binding, default scheduling.*/
+PREFIX_API void svt_jpeg_xs_thread_placement_init(svt_jpeg_xs_thread_placement_t *placement);
+
+/**
+PIPELINE TRACE
+Library built with CMake option ENABLE_TRACE record begin and end of every stage task
+(frame and slice number) of all encoder and decoder threads.
+Without the option recording is compiled out and flush return SvtJxsErrorUndefined.
+*/
+
+/* Write events recorded since previous flush to file in Chrome trace JSON format, can be opened in Perfetto UI
+ * or chrome://tracing. Can be called while encoders and decoders are running, tasks that are in progress
+ * are finished in next flush. When per thread buffer is full new events are dropped until flush,
+ * number of events dropped since previous flush is reported in "otherData".*/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_trace_flush(const char *file_path);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -48,12 +48,46 @@ typedef struct svt_jpeg_xs_decoder_api {
 
     void* private_ptr;
 
+    /* Thread pool shared with other instances, created by svt_jpeg_xs_thread_pool_create().
+     * When set, slice tasks of decoder are executed by threads of the pool and threads_num is ignored
+     * for slice threads. Pool have to be destroyed after decoder is closed.
+     * Optional, default NULL */
+    svt_jpeg_xs_thread_pool_t* thread_pool;
+
+    /* CPU, NUMA and priority placement of decoder threads, copied on initialization.
+     * Use svt_jpeg_xs_thread_placement_init() to set defaults before modification.
+     * Optional, default NULL - threads are not pinned and use default scheduling */
+    const svt_jpeg_xs_thread_placement_t* thread_placement;
+
+    /* Number of bitstreams waiting in input queue, optional, default 0 - use pipeline_preset */
+    uint32_t input_queue_size;
+    /* Number of decoded frames waiting for receive in output queue, optional, default 0 - use pipeline_preset */
+    uint32_t output_queue_size;
+    /* Number of frames decoded at the same time (pool of decoder instances), optional, default 0 - use pipeline_preset */
+    uint32_t frame_pool_size;
+    /* Preset of queue depths (pipeline_preset_t), sizes above override preset.
+     * Optional, default 0 - pipeline_preset_default */
+    uint8_t pipeline_preset;
+    /* Collect timing statistics of every frame to svt_jpeg_xs_frame_t::stats set by application.
+     * Optional, default 0 - disabled */
+    uint8_t statistics;
+    /* Allocate working buffers from arena of huge pages or locked memory (SVT_JPEGXS_MEMORY_* flags).
+     * Optional, default 0 - SVT_JPEGXS_MEMORY_DEFAULT */
+    uint8_t memory_flags;
+    /* 0 = decode to image buffer; 1 = decoded lines are written by svt_jpeg_xs_frame_t::stream write_lines callback,
+     * image buffer is not used and decoder keeps coefficients and lines only of slice in progress.
+     * Supported only by svt_jpeg_xs_decoder_sync_init() and without colour transformation (Cpih).
+     * Optional, default 0 */
+    uint8_t streaming;
+
     /* This padding is used to avoid changing the size of the public configuration struct
      * when new parameters are added in the future please follow these steps:
      * 1. Insert the new parameter as a member of this structure before the padding array.
      * 2. Decrease the size of the padding array by the size of the new parameter to keep the struct size unchanged.
+     * Parameters from thread_pool and padding take 64 bytes, size is checked on library build.
      */
-    uint8_t padding[64];
+    uint8_t padding[64 - sizeof(svt_jpeg_xs_thread_pool_t*) - sizeof(svt_jpeg_xs_thread_placement_t*) - 3 * sizeof(uint32_t) -
+                    4 * sizeof(uint8_t)];
 } svt_jpeg_xs_decoder_api_t;
 
 PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major, uint64_t version_api_minor,
@@ -61,6 +95,31 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
                                                       size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config);
 PREFIX_API void svt_jpeg_xs_decoder_close(svt_jpeg_xs_decoder_api_t* dec_api);
 
+/* Get heap memory required by decoder with configuration, without init of decoder. Parameters like in svt_jpeg_xs_decoder_init().
+  * Buffers of configuration are allocated and released to measure them, threads are not created.
+  * Value is measured like svt_jpeg_xs_decoder_get_memory_usage(), also with memory_flags set.
+  * Parameters:
+  * @ *out_bytes - Bytes allocated by svt_jpeg_xs_decoder_init() for that configuration
+  * Return fatal:
+  *  SvtJxsErrorDecoderInvalidPointer - when pointer is null
+  * or any other error returned by svt_jpeg_xs_decoder_init() for that configuration
+  **/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_memory_requirements(uint64_t version_api_major, uint64_t version_api_minor,
+                                                                         svt_jpeg_xs_decoder_api_t* dec_api,
+                                                                         const uint8_t* bitstream_buf, size_t codestream_size,
+                                                                         uint64_t* out_bytes);
+
+/* Get heap memory allocated by decoder now, contexts of synchronous decoding are included while they exist.
+  * Other buffers are released only by close, so value is also peak usage of decoder without contexts.
+  * With memory_flags set, value is size of regions mapped by arena plus contexts of synchronous decoding.
+  * Parameters:
+  * @ *dec_api - Decoder handle.
+  * @ *out_bytes - Bytes allocated by decoder
+  * Return fatal:
+  *  SvtJxsErrorBadParameter - when pointer is null or decoder is not initialized
+  **/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_memory_usage(svt_jpeg_xs_decoder_api_t* dec_api, uint64_t* out_bytes);
+
 /* Get single frame size from bitstream
   * Parameters:
   * @ *bitstream_buf - pointer to bitstream
@@ -147,6 +206,53 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_frame(svt_jpeg_xs_decoder_a
   **/
 PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_eoc(svt_jpeg_xs_decoder_api_t* dec_api);
 
+/**
+SYNCHRONOUS DECODING
+Decoder initialized by svt_jpeg_xs_decoder_sync_init() does not create threads and queues,
+frames are decoded on the calling thread by svt_jpeg_xs_decode_frame_sync().
+Every calling thread uses own context created by svt_jpeg_xs_decoder_sync_ctx_create(),
+contexts of one decoder can decode frames in parallel. No memory is allocated per frame.
+*/
+typedef struct svt_jpeg_xs_decoder_sync_ctx svt_jpeg_xs_decoder_sync_ctx_t;
+
+/* Initialize decoder for synchronous decoding, parameters like in svt_jpeg_xs_decoder_init().
+ * threads_num, thread_pool, thread_placement and callbacks are ignored, packetization_mode have to be 0.
+ * Decoder is closed by svt_jpeg_xs_decoder_close() after all contexts are destroyed.
+ * svt_jpeg_xs_decoder_send_frame(), svt_jpeg_xs_decoder_send_packet(), svt_jpeg_xs_decoder_get_frame()
+ * and svt_jpeg_xs_decoder_send_eoc() are not supported for this decoder.
+ **/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_sync_init(uint64_t version_api_major, uint64_t version_api_minor,
+                                                           svt_jpeg_xs_decoder_api_t* dec_api, const uint8_t* bitstream_buf,
+                                                           size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config);
+
+/* Create decoding context, allocate all buffers required to decode a frame.
+  * Parameters:
+  * @ *dec_api - Decoder handle initialized by svt_jpeg_xs_decoder_sync_init().
+  * @ **sync_ctx - Return pointer to created context.
+  * Return fatal:
+  *  SvtJxsErrorDecoderInvalidPointer - when pointer is null or decoder is not initialized for synchronous decoding
+  *  SvtJxsErrorInsufficientResources - when allocation failed
+  **/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_sync_ctx_create(svt_jpeg_xs_decoder_api_t* dec_api,
+                                                                 svt_jpeg_xs_decoder_sync_ctx_t** sync_ctx);
+PREFIX_API void svt_jpeg_xs_decoder_sync_ctx_destroy(svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx);
+
+/* Decode frame on calling thread, function returns when whole frame is decoded.
+  * Parameters:
+  * @ *sync_ctx - Context created by svt_jpeg_xs_decoder_sync_ctx_create(), can not be used by two threads at the same time.
+  * @ *frame - Bitstream of single frame is input, image is output. Buffers are not modified by decoder after return.
+  *            When streaming is enabled, lines are written by frame->stream instead of image.
+  * Return non-fatal:
+  *  SvtJxsErrorNone - on success,
+  * Return fatal:
+  *  SvtJxsErrorDecoderInvalidPointer - when pointer is null, or stream callbacks are not set when streaming is enabled
+  *  SvtJxsErrorBadParameter - when image buffer is too small
+  *  SvtJxsErrorDecoderInvalidBitstream - Invalid bitstream, can not decode
+  *  SvtJxsErrorDecoderConfigChange - Invalid decoder parameters, different resolution or output format. Init decoder again to decode frame,
+  * or any other from SvtJxsErrorType_t enum
+  **/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decode_frame_sync(svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx, svt_jpeg_xs_frame_t* frame);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -15,6 +15,18 @@ extern "C" {
 #include <stdio.h>
 #include <stdlib.h>
 
+/* Preset of coding tools and rate control, from the best quality to the fastest encoding.
+ * Preset overrides rate_control_mode, coding_signs_handling, coding_significance and coding_vertical_prediction_mode,
+ * so the same preset always produces the same bitstream.
+ * Speed and quality of every preset are listed in encoder design document. */
+typedef enum {
+    encoder_preset_custom = 0,       //0 - Coding tools and rate control set by separate parameters
+    encoder_preset_best_quality = 1, //1 - Full sign coding and vertical prediction, slowest
+    encoder_preset_balanced = 2,     //2 - Vertical prediction without sign coding, about 2x faster than best quality
+    encoder_preset_fastest = 3,      //3 - No sign coding and no vertical prediction, same coding tools as default parameters
+    encoder_preset_max
+} encoder_preset_t;
+
 typedef struct svt_jpeg_xs_encoder_api {
     // Input Info
     uint32_t source_width;        /* Mandatory, The width of input source in units of picture luma pixels.*/
@@ -84,12 +96,98 @@ typedef struct svt_jpeg_xs_encoder_api {
 
     void* private_ptr; /*Private encoder pointer, do not touch!!! */
 
+    /* Thread pool shared with other instances, created by svt_jpeg_xs_thread_pool_create().
+     * When set, slice tasks of encoder are executed by threads of the pool and threads_num is ignored
+     * for slice threads. Pool have to be destroyed after encoder is closed.
+     * Optional, default NULL */
+    svt_jpeg_xs_thread_pool_t* thread_pool;
+
+    /* CPU, NUMA and priority placement of encoder threads, copied on initialization.
+     * Use svt_jpeg_xs_thread_placement_init() to set defaults before modification.
+     * Optional, default NULL - threads are not pinned and use default scheduling */
+    const svt_jpeg_xs_thread_placement_t* thread_placement;
+
+    /* Callback: Call every time when new slice task is ready to get by svt_jpeg_xs_encoder_get_task().
+     * Used only when external_tasks is enabled. Can be triggered from different encoder threads.
+     * encoder_handle - Pointer passed on initialization,
+     * Optional, default NULL */
+    void (*callback_task_available)(struct svt_jpeg_xs_encoder_api* encoder, void* context);
+    void* callback_task_available_context;
+
+    /* Slice tasks executed by caller:
+     * 0 = Slice tasks are executed by encoder threads or by thread_pool
+     * 1 = Encoder does not create slice threads, caller threads get tasks by svt_jpeg_xs_encoder_get_task()
+     *     and execute them by svt_jpeg_xs_encoder_run_task(). threads_num limits number of tasks executed at the same time.
+     *     Tasks have to be executed until all sent frames are received, otherwise encoder pipeline waits.
+     * Optional, default 0 */
+    uint8_t external_tasks;
+
+    /* Number of frames processed by encoder at the same time (pool of picture control sets).
+     * Optional, default 0 - 10 frames */
+    uint32_t picture_pool_size;
+
+    /* Number of slice coefficient buffers shared by frames in CPU profile (cpu_profile = 1).
+     * DWT Stage waits for free buffer, buffer is returned when slice is packed.
+     * Lower value reduces memory usage, value is aligned to range from minimum to number of queued slice tasks.
+     * Minimum is 1 when every component has own DWT Stage thread (threads_num > 12), otherwise number of slices in frame.
+     * Optional, default 0 - slice tasks in flight (Pack Stage threads + 1), or queued slice tasks when ring holds frame */
+    uint32_t coeff_slice_ring_size;
+
+    /* Number of frames waiting in input queue, optional, default 0 - use pipeline_preset */
+    uint32_t input_queue_size;
+    /* Number of encoded frames waiting for receive in output queue, optional, default 0 - use pipeline_preset */
+    uint32_t output_queue_size;
+    /* Number of queued slice tasks, optional, default 0 - use pipeline_preset.
+     * In CPU profile (cpu_profile = 1) value smaller than number of slices in frame is aligned to number of slices. */
+    uint32_t slice_queue_size;
+    /* Preset of queue depths (pipeline_preset_t), picture_pool_size and sizes above override preset.
+     * Optional, default 0 - pipeline_preset_default */
+    uint8_t pipeline_preset;
+    /* Collect timing and rate statistics of every frame to svt_jpeg_xs_frame_t::stats set by application.
+     * Optional, default 0 - disabled */
+    uint8_t statistics;
+    /* Allocate working buffers from arena of huge pages or locked memory (SVT_JPEGXS_MEMORY_* flags).
+     * Optional, default 0 - SVT_JPEGXS_MEMORY_DEFAULT */
+    uint8_t memory_flags;
+    /* Preset of coding tools and rate control (encoder_preset_t), 1 - best quality to 3 - fastest.
+     * Optional, default 0 - encoder_preset_custom */
+    uint8_t preset;
+    /* Streaming of frames by line bands, for images too big to keep in memory:
+     * 0 = Whole image and bitstream buffers are passed in svt_jpeg_xs_frame_t
+     * 1 = Lines are read and codestream is written by callbacks of svt_jpeg_xs_frame_t::stream, encoder keeps only
+     *     lines of slices in progress. cpu_profile is forced to Low latency, slice packetization mode is not supported.
+     * Optional, default 0 */
+    uint8_t streaming;
+    /* Transcoding of codestream to bpp of encoder without decoding to image
+     * 0 = Disabled, image of svt_jpeg_xs_frame_t is encoded.
+     * 1 = Codestream svt_jpeg_xs_frame_t::transcode_source is unpacked to coefficients and packed again with budget of encoder,
+     *     DWT is not used. Source have to be coded with the same size, format, decomposition and slice height as encoder
+     *     (or as proxy, see transcode_proxy_mode), with precinct width 0.
+     *     cpu_profile has to be 0 (Low latency), streaming is not supported.
+     * Optional, default 0 */
+    uint8_t transcode;
+    /* Proxy stream generated by transcode, value of proxy_mode_t
+     * proxy_mode_full = Source is coded with the same geometry as encoder.
+     * proxy_mode_half, proxy_mode_quarter = Only lower bands of source are kept. Encoder is configured with geometry of proxy:
+     *     width, height and slice height divided by 2 or 4 rounded up, ndecomp_h and ndecomp_v lowered by 1 or 2.
+     * Optional, default 0 */
+    uint8_t transcode_proxy_mode;
+    /* Reuse of unchanged slices, for screen content where most of frame is static:
+     * 0 = Every slice is encoded.
+     * 1 = Input lines of slice and lines around read by vertical DWT are hashed, when hash is the same as in previous
+     *     encoding of this slice, its packed bytes are copied instead of DWT, RC and pack. Codestream is the same as
+     *     without reuse. Memory for one codestream is kept. streaming and transcode are not supported.
+     * Optional, default 0 */
+    uint8_t reuse_unchanged_slices;
+
     /* This padding is used to avoid changing the size of the public configuration struct
      * when new parameters are added in the future please follow these steps:
      * 1. Insert the new parameter as a member of this structure before the padding array.
      * 2. Decrease the size of the padding array by the size of the new parameter to keep the struct size unchanged.
+     * Parameters after private_ptr and padding take 128 bytes, size is checked on library build.
      */
-    uint8_t padding[64];
+    uint8_t padding[128 - sizeof(svt_jpeg_xs_thread_pool_t*) - sizeof(svt_jpeg_xs_thread_placement_t*) - 2 * sizeof(void*) -
+                    sizeof(uint32_t) /*external_tasks with alignment*/ - 5 * sizeof(uint32_t) - 8 * sizeof(uint8_t)];
 } svt_jpeg_xs_encoder_api_t;
 
 /* STEP 0 (Optional): Set default encoder parameters.
@@ -110,6 +208,25 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_image_config(uint64_t versi
                                                                   svt_jpeg_xs_image_config_t* out_image_config,
                                                                   uint32_t* out_bytes_per_frame);
 
+/* STEP x: Get heap memory required by encoder with configuration. No need to init encoder.
+ * Buffers of configuration are allocated and released to measure them, threads are not created.
+ * Value is measured like svt_jpeg_xs_encoder_get_memory_usage(), also with memory_flags set.
+ * Parameter:
+ * @ version_api_major - Use version of API Major number (SVT_JPEGXS_API_VER_MAJOR)
+   @ version_api_minor - Use version of API Minor number (SVT_JPEGXS_API_VER_MINOR)
+ * @ *enc_api          - Encoder handle with configuration, handle is not modified
+ * @ *out_bytes        - Bytes allocated by svt_jpeg_xs_encoder_init() for that configuration*/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_memory_requirements(uint64_t version_api_major, uint64_t version_api_minor,
+                                                                         svt_jpeg_xs_encoder_api_t* enc_api,
+                                                                         uint64_t* out_bytes);
+
+/* Get heap memory allocated by encoder now. Buffers are released only by close, so value is also peak usage of encoder.
+ * With memory_flags set, value is size of regions mapped by arena.
+ * Parameter:
+ * @ *enc_api          - Encoder handle
+ * @ *out_bytes        - Bytes allocated by encoder*/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_memory_usage(svt_jpeg_xs_encoder_api_t* enc_api, uint64_t* out_bytes);
+
 /* STEP 1: Initialize encoder Handle and allocates memory to necessary buffers.
  * Parameter:
  * @ version_api_major - Use version of API Major number (SVT_JPEGXS_API_VER_MAJOR)
@@ -141,6 +258,24 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_send_picture(svt_jpeg_xs_encode
 PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_packet(svt_jpeg_xs_encoder_api_t* enc_api, svt_jpeg_xs_frame_t* enc_output,
                                                             uint8_t blocking_flag);
 
+/* Slice task of encoder initialized with external_tasks enabled.*/
+typedef struct svt_jpeg_xs_encoder_task svt_jpeg_xs_encoder_task_t;
+
+/* Get next slice task, can be called from any thread. Ordering and output assembly stay inside encoder.
+ * Parameter:
+ * @ *enc_api            Encoder handler.
+ * @ **task              Return task to execute by svt_jpeg_xs_encoder_run_task(), every task have to be executed.
+ * Return SvtJxsErrorNoErrorEmptyQueue and set task to NULL when there is no task ready,
+ * SvtJxsErrorBadParameter when external_tasks is not enabled in encoder.*/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_task(svt_jpeg_xs_encoder_api_t* enc_api, svt_jpeg_xs_encoder_task_t** task);
+
+/* Execute slice task on calling thread and mark it as done, task can not be used after call.
+ * When more than threads_num tasks are executed at the same time, then call waits for first finished task.
+ * Parameter:
+ * @ *enc_api            Encoder handler.
+ * @ *task               Task received from svt_jpeg_xs_encoder_get_task().*/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_run_task(svt_jpeg_xs_encoder_api_t* enc_api, svt_jpeg_xs_encoder_task_t* task);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -55,6 +55,14 @@ typedef struct svt_jpeg_xs_frame_pool svt_jpeg_xs_frame_pool_t;
 PREFIX_API svt_jpeg_xs_frame_pool_t* svt_jpeg_xs_frame_pool_alloc(const svt_jpeg_xs_image_config_t* image_config,
                                                                   uint32_t bitstream_size, uint32_t count);
 
+/*Allocate pool of image YUV and bitstream buffers like svt_jpeg_xs_frame_pool_alloc(), from arena of selected memory
+ * Parameters:
+ * @ memory_flags - SVT_JPEGXS_MEMORY_* flags, huge pages and locked memory are used when system allows, otherwise
+ *                  buffers are allocated from normal pages
+ **/
+PREFIX_API svt_jpeg_xs_frame_pool_t* svt_jpeg_xs_frame_pool_alloc_with_memory_flags(
+    const svt_jpeg_xs_image_config_t* image_config, uint32_t bitstream_size, uint32_t count, uint32_t memory_flags);
+
 /*Free pool of image YUV and bitstream buffers
  * Parameters:
  * @ image_buffer_pool - Pointer on allocated pool of frames, have to be that same pointer as allocated by svt_jpeg_xs_frame_pool_alloc()
@@ -0,0 +1,34 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "ThreadPlacementApp.h"
+#include <stdlib.h>
+#include <string.h>
+
+void parse_cpu_list(const char* value, svt_jpeg_xs_cpu_set_t* set) {
+    memset(set, 0, sizeof(*set));
+    while (*value) {
+        char* end;
+        uint32_t first = (uint32_t)strtoul(value, &end, 10);
+        if (end == value) {
+            break;
+        }
+        uint32_t last = first;
+        if (*end == '-') {
+            value = end + 1;
+            last = (uint32_t)strtoul(value, &end, 10);
+            if (end == value) {
+                break;
+            }
+        }
+        for (uint32_t cpu = first; cpu <= last && cpu < SVT_JPEGXS_CPU_SET_SIZE; cpu++) {
+            SVT_JPEGXS_CPU_SET_ADD(set, cpu);
+        }
+        if (*end != ',') {
+            break;
+        }
+        value = end + 1;
+    }
+}
@@ -0,0 +1,13 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef __APP_THREAD_PLACEMENT_H__
+#define __APP_THREAD_PLACEMENT_H__
+#include "SvtJpegxs.h"
+
+/*Parse list of CPUs, example: 0-3,8,10-11*/
+void parse_cpu_list(const char* value, svt_jpeg_xs_cpu_set_t* set);
+
+#endif
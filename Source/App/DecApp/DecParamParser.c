@@ -13,6 +13,7 @@
 #include <string.h>
 #include <assert.h>
 #include "DecParamParser.h"
+#include "ThreadPlacementApp.h"
 
 /**********************************
    * CLI options
@@ -30,6 +31,10 @@
 #define LIMIT_FPS_TOKEN              "--limit-fps"
 #define PACKETIZATION_MODE           "--packetization-mode"
 #define PROXY_MODE                   "--proxy-mode"
+#define CPU_LIST_TOKEN               "--cpu-list"
+#define SLICE_CPU_LIST_TOKEN         "--slice-cpu-list"
+#define NUMA_NODE_TOKEN              "--numa-node"
+#define RT_PRIORITY_TOKEN            "--rt-priority"
 #define MAX_NUM_TOKENS               200
 
 static void strncpy_local(char* dest, const char* src, size_t count) {
@@ -65,6 +70,30 @@ static void set_num_thread(const char* value, DecoderConfig_t* cfg) {
     cfg->decoder.threads_num = strtoul(value, NULL, 0);
 };
 
+static svt_jpeg_xs_thread_placement_t* get_thread_placement(DecoderConfig_t* cfg) {
+    if (cfg->decoder.thread_placement == NULL) {
+        svt_jpeg_xs_thread_placement_init(&cfg->thread_placement);
+        cfg->decoder.thread_placement = &cfg->thread_placement;
+    }
+    return &cfg->thread_placement;
+}
+
+static void set_cpu_list(const char* value, DecoderConfig_t* cfg) {
+    parse_cpu_list(value, &get_thread_placement(cfg)->cpu_set);
+}
+
+static void set_slice_cpu_list(const char* value, DecoderConfig_t* cfg) {
+    parse_cpu_list(value, &get_thread_placement(cfg)->slice_cpu_set);
+}
+
+static void set_numa_node(const char* value, DecoderConfig_t* cfg) {
+    get_thread_placement(cfg)->numa_node = (int32_t)strtol(value, NULL, 0);
+}
+
+static void set_rt_priority(const char* value, DecoderConfig_t* cfg) {
+    get_thread_placement(cfg)->rt_priority = (int32_t)strtol(value, NULL, 0);
+}
+
 static void set_frame_num(const char* value, DecoderConfig_t* cfg) {
     cfg->frames_count = strtoul(value, NULL, 0);
 };
@@ -180,6 +209,10 @@ ConfigEntry config_entry[] = {
                                                 " avx, avx2, avx512, max], by default highest level supported by CPU", 0, 1,
                                                 set_asm_type},
     {THREAD_PERF_OPTIONS, THREADS_TOKEN,        "Thread Scaling parameter, the higher the value the more threads are created and thus lower latency and/or higher FPS can be achieved (default: 0, which means lowest possible number of threads is created)", 0, 1, set_num_thread},
+    {THREAD_PERF_OPTIONS, CPU_LIST_TOKEN,       "Pin decoder threads to list of CPUs (example: 0-3,8), by default threads are not pinned", 0, 1, set_cpu_list},
+    {THREAD_PERF_OPTIONS, SLICE_CPU_LIST_TOKEN, "Pin slice threads to list of CPUs, by default use --cpu-list", 0, 1, set_slice_cpu_list},
+    {THREAD_PERF_OPTIONS, NUMA_NODE_TOKEN,      "Prefer NUMA node for threads and buffers (disabled: -1, default: -1)", 0, 1, set_numa_node},
+    {THREAD_PERF_OPTIONS, RT_PRIORITY_TOKEN,    "Realtime priority of threads, require root (disabled: 0, enabled [1-99], default: 0)", 0, 1, set_rt_priority},
     // Termination
     {NULL_OPTIONS, NULL, NULL, 0, 0, NULL}
 };
@@ -36,6 +36,7 @@ typedef struct DecoderConfig {
     uint32_t limit_fps;
 
     svt_jpeg_xs_decoder_api_t decoder;
+    svt_jpeg_xs_thread_placement_t thread_placement;
     svt_jpeg_xs_image_config_t image_config;
 
     svt_jpeg_xs_frame_pool_t* frame_pool;
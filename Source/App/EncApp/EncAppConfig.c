@@ -9,6 +9,7 @@
 #include <sys/stat.h>
 
 #include "EncAppConfig.h"
+#include "ThreadPlacementApp.h"
 #ifdef _WIN32
 #include <io.h>
 #include <windows.h>
@@ -58,6 +59,11 @@ static void strncpy_local(char *dest, const char *src, size_t count) {
 #define PROFILE_TYPE_TOKEN "--profile"
 #define THREAD_MGMNT       "--lp"
 #define FRAMES_COUNT_TOKEN "-n"
+
+#define CPU_LIST_TOKEN       "--cpu-list"
+#define SLICE_CPU_LIST_TOKEN "--slice-cpu-list"
+#define NUMA_NODE_TOKEN      "--numa-node"
+#define RT_PRIORITY_TOKEN    "--rt-priority"
 // double dash
 #define PRESET_TOKEN "--preset"
 
@@ -125,6 +131,10 @@ static void set_coding_vpred(const char *value, EncoderConfig_t *cfg) {
     cfg->encoder.coding_vertical_prediction_mode = strtoul(value, NULL, 0);
 }
 
+static void set_preset(const char *value, EncoderConfig_t *cfg) {
+    cfg->encoder.preset = (uint8_t)strtoul(value, NULL, 0);
+}
+
 static void set_rate_control_mode(const char *value, EncoderConfig_t *cfg) {
     cfg->encoder.rate_control_mode = strtoul(value, NULL, 0);
 }
@@ -259,6 +269,30 @@ static void set_num_thread(const char *value, EncoderConfig_t *cfg) {
     cfg->encoder.threads_num = (uint32_t)strtoul(value, NULL, 0);
 }
 
+static svt_jpeg_xs_thread_placement_t *get_thread_placement(EncoderConfig_t *cfg) {
+    if (cfg->encoder.thread_placement == NULL) {
+        svt_jpeg_xs_thread_placement_init(&cfg->thread_placement);
+        cfg->encoder.thread_placement = &cfg->thread_placement;
+    }
+    return &cfg->thread_placement;
+}
+
+static void set_cpu_list(const char *value, EncoderConfig_t *cfg) {
+    parse_cpu_list(value, &get_thread_placement(cfg)->cpu_set);
+}
+
+static void set_slice_cpu_list(const char *value, EncoderConfig_t *cfg) {
+    parse_cpu_list(value, &get_thread_placement(cfg)->slice_cpu_set);
+}
+
+static void set_numa_node(const char *value, EncoderConfig_t *cfg) {
+    get_thread_placement(cfg)->numa_node = (int32_t)strtol(value, NULL, 0);
+}
+
+static void set_rt_priority(const char *value, EncoderConfig_t *cfg) {
+    get_thread_placement(cfg)->rt_priority = (int32_t)strtol(value, NULL, 0);
+}
+
 static void set_print_bands(const char *value, EncoderConfig_t *cfg) {
     cfg->encoder.print_bands_info = (int32_t)strtol(value, NULL, 0);
 }
@@ -315,12 +349,17 @@ ConfigEntry config_entry[] = {
     {CODING_OPTIONS, CODING_SIGF_TOKEN,     "Enable Significance coding (enabled:1, disable:0, default:1)", 0, 1, set_coding_significance},
     {CODING_OPTIONS, CODING_PRED_TOKEN,     "Enable Vertical Prediction coding (disable:0, zero prediction residuals:1, zero coefficients:2, default: 0)", 0, 1, set_coding_vpred},
     {CODING_OPTIONS, CODING_RATE_CONTROL,   "Rate Control mode (CBR: budget per precinct: 0, CBR: budget per precinct with padding movement: 1, CBR: budget per slice: 2, CBR: budget per slice with max size RATE: 3, default 0)", 0, 1, set_rate_control_mode},
+    {CODING_OPTIONS, PRESET_TOKEN,          "Preset of coding tools and rate control, overrides coding and rc options (custom:0, best quality:1, balanced:2, fastest:3, default:0)", 0, 1, set_preset},
     {THREAD_PERF_OPTIONS, ASM_TYPE_TOKEN,   "Limit assembly instruction set [0 - 11] or [c, mmx, sse, sse2, sse3, "
                                             "ssse3, sse4_1, sse4_2,"
                                             " avx, avx2, avx512, max], by default highest level supported by CPU", 0, 1,
                                             set_asm_type},
     {THREAD_PERF_OPTIONS, PROFILE_TYPE_TOKEN,"Profile of CPU use. 0:latency Low Latency mode, 1:cpu Low CPU use mode [latency:0, cpu:1, default: 0]", 0, 1, set_profile_type},
     {THREAD_PERF_OPTIONS, THREAD_MGMNT,     "Thread Scaling parameter, the higher the value the more threads are created and thus lower latency and/or higher FPS can be achieved (default: 0, which means lowest possible number of threads is created)", 0, 1, set_num_thread},
+    {THREAD_PERF_OPTIONS, CPU_LIST_TOKEN,   "Pin encoder threads to list of CPUs (example: 0-3,8), by default threads are not pinned", 0, 1, set_cpu_list},
+    {THREAD_PERF_OPTIONS, SLICE_CPU_LIST_TOKEN,"Pin slice threads (DWT, Pack) to list of CPUs, by default use --cpu-list", 0, 1, set_slice_cpu_list},
+    {THREAD_PERF_OPTIONS, NUMA_NODE_TOKEN,  "Prefer NUMA node for threads and buffers (disabled: -1, default: -1)", 0, 1, set_numa_node},
+    {THREAD_PERF_OPTIONS, RT_PRIORITY_TOKEN,"Realtime priority of threads, require root (disabled: 0, enabled [1-99], default: 0)", 0, 1, set_rt_priority},
     // Termination
     {NULL_OPTIONS, NULL, NULL, 0, 0, NULL}
 };
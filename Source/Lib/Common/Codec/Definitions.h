@@ -104,6 +104,15 @@ typedef enum PointerType {
 // Common Macros
 #define UNUSED(x) (void)(x)
 
+/*Compile time check, _Static_assert is not available in C99 and in MSVC C before C11.*/
+#define SVT_STATIC_ASSERT(condition, name) typedef char svt_static_assert_##name[(condition) ? 1 : -1]
+
+#if defined(_MSC_VER)
+#define SVT_THREAD_LOCAL __declspec(thread)
+#else
+#define SVT_THREAD_LOCAL __thread
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,7 @@
 
 #include "SvtJpegxsImageBufferTools.h"
 #include "Threads/SystemResourceManager.h"
+#include "Threads/SvtArena.h"
 
 struct svt_jpeg_xs_frame_pool {
     uint8_t use_image_buffer;
@@ -15,6 +16,7 @@ struct svt_jpeg_xs_frame_pool {
     Fifo_t* pool_image_buffer_fifo_ptr;
     SystemResource_t* pool_bitstream_resource_ptr;
     Fifo_t* pool_bitstream_fifo_ptr;
+    MemoryArena_t* arena;
 };
 
 PREFIX_API svt_jpeg_xs_image_buffer_t* svt_jpeg_xs_image_buffer_alloc(svt_jpeg_xs_image_config_t* image_config) {
@@ -131,17 +133,14 @@ static void out_bitstream_buffer_destroy_ctor(void_ptr p) {
     svt_jpeg_xs_bitstream_free(bitstream_buffer);
 }
 
-PREFIX_API svt_jpeg_xs_frame_pool_t* svt_jpeg_xs_frame_pool_alloc(const svt_jpeg_xs_image_config_t* image_config,
-                                                                  uint32_t bitstream_size, uint32_t count) {
+static svt_jpeg_xs_frame_pool_t* frame_pool_alloc_buffers(const svt_jpeg_xs_image_config_t* image_config, uint32_t bitstream_size,
+                                                          uint32_t count) {
     svt_jpeg_xs_frame_pool_t* frame_pool = NULL;
 
-    if (count == 0 || (image_config == NULL && bitstream_size == 0)) {
-        return NULL;
-    }
-
     SVT_NO_THROW_MALLOC(frame_pool, sizeof(svt_jpeg_xs_frame_pool_t));
     if (frame_pool) {
         svt_jxs_increase_component_count();
+        frame_pool->arena = NULL;
         frame_pool->pool_image_buffer_resource_ptr = NULL;
         frame_pool->pool_image_buffer_fifo_ptr = NULL;
         frame_pool->pool_bitstream_resource_ptr = NULL;
@@ -201,8 +200,36 @@ PREFIX_API svt_jpeg_xs_frame_pool_t* svt_jpeg_xs_frame_pool_alloc(const svt_jpeg
     return frame_pool;
 }
 
+PREFIX_API svt_jpeg_xs_frame_pool_t* svt_jpeg_xs_frame_pool_alloc_with_memory_flags(
+    const svt_jpeg_xs_image_config_t* image_config, uint32_t bitstream_size, uint32_t count, uint32_t memory_flags) {
+    if (count == 0 || (image_config == NULL && bitstream_size == 0)) {
+        return NULL;
+    }
+
+    /*Pool buffers are allocated only here, so arena is active only here and in svt_jpeg_xs_frame_pool_free().*/
+    MemoryArena_t* arena = svt_jxs_arena_create(memory_flags);
+    MemoryArena_t* arena_prev = svt_jxs_arena_set_active(arena);
+    svt_jpeg_xs_frame_pool_t* frame_pool = frame_pool_alloc_buffers(image_config, bitstream_size, count);
+    svt_jxs_arena_set_active(arena_prev);
+    if (frame_pool) {
+        frame_pool->arena = arena;
+    }
+    else {
+        svt_jxs_arena_destroy(arena);
+    }
+    return frame_pool;
+}
+
+PREFIX_API svt_jpeg_xs_frame_pool_t* svt_jpeg_xs_frame_pool_alloc(const svt_jpeg_xs_image_config_t* image_config,
+                                                                  uint32_t bitstream_size, uint32_t count) {
+    return svt_jpeg_xs_frame_pool_alloc_with_memory_flags(image_config, bitstream_size, count, SVT_JPEGXS_MEMORY_DEFAULT);
+}
+
 PREFIX_API void svt_jpeg_xs_frame_pool_free(svt_jpeg_xs_frame_pool_t* frame_pool) {
     if (frame_pool) {
+        /*Pool that failed in allocation is released in scope of arena set by caller.*/
+        MemoryArena_t* arena = frame_pool->arena;
+        MemoryArena_t* arena_prev = arena ? svt_jxs_arena_set_active(arena) : NULL;
         if (frame_pool->pool_image_buffer_resource_ptr) {
             SVT_DELETE(frame_pool->pool_image_buffer_resource_ptr);
         }
@@ -211,6 +238,10 @@ PREFIX_API void svt_jpeg_xs_frame_pool_free(svt_jpeg_xs_frame_pool_t* frame_pool
         }
         SVT_FREE(frame_pool);
         svt_jxs_decrease_component_count();
+        if (arena) {
+            svt_jxs_arena_set_active(arena_prev);
+            svt_jxs_arena_destroy(arena);
+        }
     }
 }
 
@@ -198,6 +198,10 @@ typedef struct precinct {
     //uint32_t global_height;         /* Height of precinct in image, relative to image-space */
     precinct_band_t bands[MAX_COMPONENTS_NUM][MAX_BANDS_PER_COMPONENT_NUM];
     precinct_info_t* p_info;
+    /* Precinct header parameters and padding, set by unpack */
+    uint8_t quantization;
+    uint8_t refinement;
+    uint32_t padding_bytes;
 } precinct_t;
 
 #define BITS_ALIGN_TO_BYTE(nbits)      (((nbits) + 7) & (~(7)))
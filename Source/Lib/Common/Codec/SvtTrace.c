@@ -0,0 +1,230 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "SvtJpegxs.h"
+#include "SvtTrace.h"
+#include "SvtUtility.h"
+#include "Threads/SvtThreads.h"
+
+#ifdef SVT_JXS_TRACE
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define TRACE_THREADS_MAX         (1024)
+#define TRACE_EVENTS_PER_THREAD   (1 << 16) /*Power of 2*/
+#define TRACE_EVENTS_PER_THREAD_M (TRACE_EVENTS_PER_THREAD - 1)
+
+typedef struct TraceEvent {
+    uint64_t time_ns;
+    const char* name;
+    uint64_t frame;
+    int32_t slice;
+    char phase;
+} TraceEvent;
+
+/*Single producer (owner thread) and single consumer (flush) ring.
+ *When ring is full new events are dropped until next flush.
+ *Trace row is named by first flushed event, events are published by write_idx, so flush never read fields of owner.*/
+typedef struct TraceBuffer {
+    volatile int32_t owned;     /*Buffer is used by running thread*/
+    volatile int32_t write_idx; /*Written only by owner thread*/
+    volatile int32_t read_idx;  /*Written only by flush*/
+    volatile int32_t dropped;   /*Incremented by owner thread, subtracted by flush*/
+    TraceEvent events[TRACE_EVENTS_PER_THREAD];
+} TraceBuffer;
+
+/*Buffers are kept for process lifetime, so events of closed encoders and decoders can be flushed.
+ *When thread exit its buffer is given to next new thread, events of both are in that same trace row.*/
+static TraceBuffer* volatile trace_buffers[TRACE_THREADS_MAX];
+static volatile int32_t trace_buffers_num = 0;
+static volatile int32_t trace_flush_busy = 0;
+static SVT_THREAD_LOCAL TraceBuffer* trace_thread_buffer = NULL;
+static SVT_THREAD_LOCAL int32_t trace_thread_disabled = 0;
+
+/*Thread exit notification, release buffer of thread.*/
+static void trace_thread_exit(void* context) {
+    TraceBuffer* buffer = (TraceBuffer*)context;
+    if (buffer) {
+        svt_jxs_atomic_store_i32(&buffer->owned, 0);
+    }
+}
+
+#ifdef _WIN32
+static INIT_ONCE trace_exit_once = INIT_ONCE_STATIC_INIT;
+static DWORD trace_exit_key = FLS_OUT_OF_INDEXES;
+
+static void WINAPI trace_thread_exit_win(void* context) {
+    trace_thread_exit(context);
+}
+
+static BOOL CALLBACK trace_exit_key_init(PINIT_ONCE once, void* param, void** context) {
+    UNUSED(once);
+    UNUSED(param);
+    UNUSED(context);
+    trace_exit_key = FlsAlloc(trace_thread_exit_win);
+    return TRUE;
+}
+
+static void trace_set_thread_exit(TraceBuffer* buffer) {
+    InitOnceExecuteOnce(&trace_exit_once, trace_exit_key_init, NULL, NULL);
+    if (trace_exit_key != FLS_OUT_OF_INDEXES) {
+        FlsSetValue(trace_exit_key, buffer);
+    }
+}
+#else
+static pthread_once_t trace_exit_once = PTHREAD_ONCE_INIT;
+static pthread_key_t trace_exit_key;
+static int32_t trace_exit_key_valid = 0;
+
+static void trace_exit_key_init(void) {
+    trace_exit_key_valid = !pthread_key_create(&trace_exit_key, trace_thread_exit);
+}
+
+static void trace_set_thread_exit(TraceBuffer* buffer) {
+    pthread_once(&trace_exit_once, trace_exit_key_init);
+    if (trace_exit_key_valid) {
+        pthread_setspecific(trace_exit_key, buffer);
+    }
+}
+#endif
+
+static TraceBuffer* trace_register_thread(void) {
+    if (trace_thread_disabled) {
+        return NULL;
+    }
+    TraceBuffer* buffer = NULL;
+    int32_t buffers_num = svt_jxs_atomic_load_i32(&trace_buffers_num);
+    if (buffers_num > TRACE_THREADS_MAX) {
+        buffers_num = TRACE_THREADS_MAX;
+    }
+    /*Reuse buffer of finished thread*/
+    for (int32_t i = 0; i < buffers_num && buffer == NULL; i++) {
+        int32_t expected = 0;
+        TraceBuffer* old = trace_buffers[i];
+        if (old && svt_jxs_atomic_cas_i32(&old->owned, &expected, 1)) {
+            buffer = old;
+        }
+    }
+    if (buffer == NULL) {
+        const int32_t idx = svt_jxs_atomic_fetch_add_i32(&trace_buffers_num, 1);
+        if (idx < TRACE_THREADS_MAX) {
+            buffer = (TraceBuffer*)calloc(1, sizeof(TraceBuffer));
+        }
+        if (buffer == NULL) {
+            /*Too many threads or no memory, do not record events of this thread.*/
+            trace_thread_disabled = 1;
+            return NULL;
+        }
+        buffer->owned = 1;
+        svt_jxs_atomic_store_i32(&buffer->write_idx, 0);
+        trace_buffers[idx] = buffer;
+    }
+    /*Without exit notification buffer is never released, that only limit number of recorded threads.*/
+    trace_set_thread_exit(buffer);
+    trace_thread_buffer = buffer;
+    return buffer;
+}
+
+void svt_jxs_trace_event(const char* name, char phase, uint64_t frame, int32_t slice) {
+    TraceBuffer* buffer = trace_thread_buffer;
+    if (buffer == NULL) {
+        buffer = trace_register_thread();
+        if (buffer == NULL) {
+            return;
+        }
+    }
+    const int32_t write_idx = buffer->write_idx;
+    if ((uint32_t)write_idx - (uint32_t)svt_jxs_atomic_load_i32(&buffer->read_idx) >= TRACE_EVENTS_PER_THREAD) {
+        svt_jxs_atomic_fetch_add_i32(&buffer->dropped, 1);
+        return;
+    }
+    TraceEvent* event = &buffer->events[(uint32_t)write_idx & TRACE_EVENTS_PER_THREAD_M];
+    event->time_ns = get_current_time_ns();
+    event->name = name;
+    event->frame = frame;
+    event->slice = slice;
+    event->phase = phase;
+    svt_jxs_atomic_store_i32(&buffer->write_idx, (int32_t)((uint32_t)write_idx + 1));
+}
+
+static void trace_write_buffer(FILE* file, TraceBuffer* buffer, int32_t tid, uint8_t* first, uint64_t* dropped) {
+    const int32_t write_idx = svt_jxs_atomic_load_i32(&buffer->write_idx);
+    const int32_t read_idx = buffer->read_idx;
+    /*Events dropped since previous flush, owner can drop next ones meanwhile.*/
+    const int32_t buffer_dropped = svt_jxs_atomic_load_i32(&buffer->dropped);
+    svt_jxs_atomic_fetch_add_i32(&buffer->dropped, -buffer_dropped);
+    *dropped += (uint32_t)buffer_dropped;
+    if (read_idx == write_idx) {
+        return;
+    }
+
+    fprintf(file,
+            "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%i,\"args\":{\"name\":\"%s %i\"}}",
+            *first ? "" : ",\n",
+            tid,
+            buffer->events[(uint32_t)read_idx & TRACE_EVENTS_PER_THREAD_M].name,
+            tid);
+    *first = 0;
+    for (uint32_t i = (uint32_t)read_idx; i != (uint32_t)write_idx; i++) {
+        const TraceEvent* event = &buffer->events[i & TRACE_EVENTS_PER_THREAD_M];
+        fprintf(file,
+                ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%i,\"args\":{\"frame\":%llu,\"slice\":%i}}",
+                event->name,
+                event->phase,
+                (unsigned long long)(event->time_ns / 1000),
+                (uint32_t)(event->time_ns % 1000),
+                tid,
+                (unsigned long long)event->frame,
+                event->slice);
+    }
+    svt_jxs_atomic_store_i32(&buffer->read_idx, write_idx);
+}
+#endif /*SVT_JXS_TRACE*/
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_trace_flush(const char* file_path) {
+#ifdef SVT_JXS_TRACE
+    if (file_path == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+    FILE* file = fopen(file_path, "w");
+    if (file == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+
+    /*Only one flush at a time, recording threads are never blocked.*/
+    int32_t expected = 0;
+    while (!svt_jxs_atomic_cas_i32(&trace_flush_busy, &expected, 1)) {
+        expected = 0;
+        svt_jxs_cpu_relax();
+    }
+
+    uint8_t first = 1;
+    uint64_t dropped = 0;
+    int32_t buffers_num = svt_jxs_atomic_load_i32(&trace_buffers_num);
+    if (buffers_num > TRACE_THREADS_MAX) {
+        buffers_num = TRACE_THREADS_MAX;
+    }
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (int32_t i = 0; i < buffers_num; i++) {
+        TraceBuffer* buffer = trace_buffers[i];
+        if (buffer) {
+            trace_write_buffer(file, buffer, i + 1, &first, &dropped);
+        }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":\"%llu\"}}\n", (unsigned long long)dropped);
+
+    svt_jxs_atomic_store_i32(&trace_flush_busy, 0);
+    return fclose(file) ? SvtJxsErrorUndefined : SvtJxsErrorNone;
+#else
+    UNUSED(file_path);
+    return SvtJxsErrorUndefined;
+#endif
+}
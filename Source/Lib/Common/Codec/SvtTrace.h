@@ -0,0 +1,34 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _SVT_TRACE_H_
+#define _SVT_TRACE_H_
+
+#include "Definitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Pipeline events for Chrome trace export, enabled by CMake option ENABLE_TRACE.
+ * Every thread record events to own buffer without locks, svt_jpeg_xs_trace_flush() write them to JSON.
+ * name have to be static string, slice is -1 for events not related to slice.
+ * When tracing is disabled macros compile to nothing.
+ */
+#ifdef SVT_JXS_TRACE
+void svt_jxs_trace_event(const char* name, char phase, uint64_t frame, int32_t slice);
+
+#define SVT_TRACE_BEGIN(name, frame, slice) svt_jxs_trace_event((name), 'B', (uint64_t)(frame), (int32_t)(slice))
+#define SVT_TRACE_END(name, frame, slice)   svt_jxs_trace_event((name), 'E', (uint64_t)(frame), (int32_t)(slice))
+#else
+#define SVT_TRACE_BEGIN(name, frame, slice)
+#define SVT_TRACE_END(name, frame, slice)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*_SVT_TRACE_H_*/
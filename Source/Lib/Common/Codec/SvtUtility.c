@@ -23,6 +23,28 @@ void assert_err(uint32_t condition, char* err_msg) {
     assert(condition);
 }
 
+/* Monotonic clock in nanoseconds, used to timestamp pipeline stages. */
+uint64_t get_current_time_ns(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL +
+                      ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC) && !defined(OLD_MACOS)
+    struct timespec curr_time;
+    clock_gettime(CLOCK_MONOTONIC, &curr_time);
+    return (uint64_t)curr_time.tv_sec * 1000000000ULL + (uint64_t)curr_time.tv_nsec;
+#else
+    struct timeval curr_time;
+    gettimeofday(&curr_time, NULL);
+    return (uint64_t)curr_time.tv_sec * 1000000000ULL + (uint64_t)curr_time.tv_usec * 1000ULL;
+#endif
+}
+
 /*****************************************
  * Long Log 2
  *  This is a quick adaptation of a Number
@@ -45,6 +45,8 @@ static INLINE void get_current_time(uint64_t* const seconds, uint64_t* const mse
 #endif
 }
 
+uint64_t get_current_time_ns(void);
+
 static INLINE double compute_elapsed_time_in_ms(const uint64_t start_seconds, const uint64_t start_mseconds,
                                                 const uint64_t finish_seconds, const uint64_t finish_mseconds) {
     const int64_t s_diff = (int64_t)finish_seconds - (int64_t)start_seconds,
@@ -0,0 +1,199 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include "SvtJpegxs.h"
+#include "SvtArena.h"
+#include "Definitions.h"
+#define LOG_TAG "SvtArena"
+#include "SvtLog.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#define ARENA_REGION_SIZE ((size_t)2 << 20) /*Size of huge page*/
+#define ARENA_ALIGN_UP(x, a) (((x) + (a) - 1) & ~((size_t)(a) - 1))
+
+/*Header placed on begin of every mapped region*/
+typedef struct ArenaRegion {
+    struct ArenaRegion* next;
+    size_t size;
+} ArenaRegion;
+
+#define ARENA_HEADER_SIZE ARENA_ALIGN_UP(sizeof(ArenaRegion), ALVALUE)
+
+struct MemoryArena {
+    ArenaRegion* regions;
+    uint8_t* current; /*Free space of region used for next buffers*/
+    uint8_t* current_end;
+    uint64_t mapped_bytes;
+    uint32_t memory_flags;
+    uint8_t huge_pages_failed; /*Explicit huge pages are not available, do not try again*/
+    uint8_t lock_failed;
+};
+
+static SVT_THREAD_LOCAL MemoryArena_t* g_active_arena = NULL;
+
+#ifdef _WIN32
+static void* arena_map(MemoryArena_t* arena, size_t size) {
+    void* ptr = NULL;
+    if ((arena->memory_flags & SVT_JPEGXS_MEMORY_HUGE_PAGES) && !arena->huge_pages_failed) {
+        /*Large pages require SeLockMemoryPrivilege, they are always locked in RAM.*/
+        const SIZE_T large_page = GetLargePageMinimum();
+        if (large_page && (size % large_page) == 0) {
+            ptr = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        }
+        if (ptr == NULL) {
+            arena->huge_pages_failed = 1;
+        }
+    }
+    if (ptr == NULL) {
+        ptr = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (ptr && (arena->memory_flags & SVT_JPEGXS_MEMORY_LOCK) && !arena->lock_failed && !VirtualLock(ptr, size)) {
+            SVT_WARN("Failed to lock memory, working set size limit exceeded\n");
+            arena->lock_failed = 1;
+        }
+    }
+    return ptr;
+}
+
+static void arena_unmap(void* ptr, size_t size) {
+    UNUSED(size);
+    VirtualFree(ptr, 0, MEM_RELEASE);
+}
+#else
+static void* arena_map(MemoryArena_t* arena, size_t size) {
+    void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if ((arena->memory_flags & SVT_JPEGXS_MEMORY_HUGE_PAGES) && !arena->huge_pages_failed) {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+        flags |= 21 << MAP_HUGE_SHIFT; /*2 MiB pages also when default huge page size is different*/
+#endif
+        ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (ptr == MAP_FAILED) {
+            /*No huge pages reserved in system, use transparent huge pages.*/
+            arena->huge_pages_failed = 1;
+        }
+    }
+#endif
+    if (ptr == MAP_FAILED) {
+        /*Align region to huge page, so transparent huge pages can back whole region.*/
+        const size_t align = (arena->memory_flags & SVT_JPEGXS_MEMORY_HUGE_PAGES) ? ARENA_REGION_SIZE : 0;
+        uint8_t* map = (uint8_t*)mmap(NULL, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if ((void*)map == MAP_FAILED) {
+            return NULL;
+        }
+        ptr = map;
+        if (align) {
+            uint8_t* aligned = (uint8_t*)ARENA_ALIGN_UP((uintptr_t)map, align);
+            const size_t head = (size_t)(aligned - map);
+            if (head) {
+                munmap(map, head);
+            }
+            if (align - head) {
+                munmap(aligned + size, align - head);
+            }
+            ptr = aligned;
+#ifdef MADV_HUGEPAGE
+            madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+        }
+    }
+    if ((arena->memory_flags & SVT_JPEGXS_MEMORY_LOCK) && !arena->lock_failed && mlock(ptr, size)) {
+        SVT_WARN("Failed to lock memory, check RLIMIT_MEMLOCK\n");
+        arena->lock_failed = 1;
+    }
+    return ptr;
+}
+
+static void arena_unmap(void* ptr, size_t size) {
+    munmap(ptr, size);
+}
+#endif
+
+MemoryArena_t* svt_jxs_arena_create(uint32_t memory_flags) {
+    if (memory_flags == SVT_JPEGXS_MEMORY_DEFAULT) {
+        return NULL;
+    }
+    MemoryArena_t* arena = (MemoryArena_t*)calloc(1, sizeof(MemoryArena_t));
+    if (arena) {
+        arena->memory_flags = memory_flags;
+    }
+    return arena;
+}
+
+void svt_jxs_arena_destroy(MemoryArena_t* arena) {
+    if (arena) {
+        ArenaRegion* region = arena->regions;
+        while (region) {
+            ArenaRegion* next = region->next;
+            arena_unmap(region, region->size);
+            region = next;
+        }
+        if (g_active_arena == arena) {
+            g_active_arena = NULL;
+        }
+        free(arena);
+    }
+}
+
+void* svt_jxs_arena_alloc(MemoryArena_t* arena, size_t size) {
+    if (size > SIZE_MAX - ARENA_HEADER_SIZE - 2 * ARENA_REGION_SIZE) {
+        return NULL;
+    }
+    size = ARENA_ALIGN_UP(size ? size : 1, ALVALUE);
+    if (size <= (size_t)(arena->current_end - arena->current)) {
+        void* ptr = arena->current;
+        arena->current += size;
+        return ptr;
+    }
+
+    /*Buffers bigger than region get own region rounded up to huge page size.*/
+    const size_t region_size = ARENA_ALIGN_UP(size + ARENA_HEADER_SIZE, ARENA_REGION_SIZE);
+    ArenaRegion* region = (ArenaRegion*)arena_map(arena, region_size);
+    if (region == NULL) {
+        return NULL;
+    }
+    region->size = region_size;
+    region->next = arena->regions;
+    arena->regions = region;
+    arena->mapped_bytes += region_size;
+
+    uint8_t* begin = (uint8_t*)region + ARENA_HEADER_SIZE;
+    uint8_t* end = (uint8_t*)region + region_size;
+    /*Keep region with more free space for next buffers.*/
+    if ((size_t)(end - begin) - size > (size_t)(arena->current_end - arena->current)) {
+        arena->current = begin + size;
+        arena->current_end = end;
+    }
+    return begin;
+}
+
+uint8_t svt_jxs_arena_contains(const MemoryArena_t* arena, const void* ptr) {
+    for (const ArenaRegion* region = arena->regions; region; region = region->next) {
+        if ((const uint8_t*)ptr >= (const uint8_t*)region && (const uint8_t*)ptr < (const uint8_t*)region + region->size) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+uint64_t svt_jxs_arena_get_mapped_bytes(const MemoryArena_t* arena) {
+    return arena ? arena->mapped_bytes : 0;
+}
+
+MemoryArena_t* svt_jxs_arena_set_active(MemoryArena_t* arena) {
+    MemoryArena_t* previous = g_active_arena;
+    g_active_arena = arena;
+    return previous;
+}
+
+MemoryArena_t* svt_jxs_arena_get_active(void) {
+    return g_active_arena;
+}
@@ -0,0 +1,39 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _SVT_ARENA_H_
+#define _SVT_ARENA_H_
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*Arena of encoder, decoder or frame pool working buffers.
+ *Buffers are allocated one after another from big regions (2 MiB huge pages when available),
+ *free of single buffer does nothing, all regions are released by svt_jxs_arena_destroy().
+ *Arena is used only by thread that set it active, so it does not need any synchronization.*/
+typedef struct MemoryArena MemoryArena_t;
+
+/*memory_flags - SVT_JPEGXS_MEMORY_* flags, return NULL when no flag is set or arena can not be created.*/
+MemoryArena_t* svt_jxs_arena_create(uint32_t memory_flags);
+void svt_jxs_arena_destroy(MemoryArena_t* arena);
+
+/*Return zeroed buffer aligned to ALVALUE, or NULL when there is no memory.*/
+void* svt_jxs_arena_alloc(MemoryArena_t* arena, size_t size);
+uint8_t svt_jxs_arena_contains(const MemoryArena_t* arena, const void* ptr);
+/*Bytes of regions mapped by arena.*/
+uint64_t svt_jxs_arena_get_mapped_bytes(const MemoryArena_t* arena);
+
+/*Set arena used by SVT_MALLOC, SVT_CALLOC and SVT_MALLOC_ALIGNED of calling thread, return previous arena.
+ *SVT_FREE and SVT_FREE_ALIGNED of buffer from active arena do nothing.*/
+MemoryArena_t* svt_jxs_arena_set_active(MemoryArena_t* arena);
+MemoryArena_t* svt_jxs_arena_get_active(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*_SVT_ARENA_H_*/
@@ -13,6 +13,7 @@
 
 #include "SvtMalloc.h"
 #include "SvtThreads.h"
+#include "SvtArena.h"
 #define LOG_TAG "SvtMalloc"
 #include "SvtLog.h"
 
@@ -20,6 +21,139 @@ void svt_jxs_print_alloc_fail_impl(const char* file, int line) {
     SVT_FATAL("allocate memory failed, at %s:%d\n", file, line);
 }
 
+struct MemoryAccount {
+    volatile int64_t live_bytes;
+};
+
+/*Header before every heap buffer, aligned buffers have it at end of ALVALUE bytes before buffer.
+ *Size of header keep alignment of malloc() on 32 and 64 bit systems.*/
+typedef struct MemoryHeader {
+    MemoryAccount_t* account;
+    size_t size;
+} MemoryHeader_t;
+
+#define MEMORY_HEADER_SIZE sizeof(MemoryHeader_t)
+
+static SVT_THREAD_LOCAL MemoryAccount_t* g_memory_account = NULL;
+
+MemoryAccount_t* svt_jxs_memory_account_create(void) {
+    /*Account is not counted by itself.*/
+    return (MemoryAccount_t*)calloc(1, sizeof(MemoryAccount_t));
+}
+
+void svt_jxs_memory_account_destroy(MemoryAccount_t* account) {
+    if (g_memory_account == account) {
+        g_memory_account = NULL;
+    }
+    free(account);
+}
+
+MemoryAccount_t* svt_jxs_memory_account_set_active(MemoryAccount_t* account) {
+    MemoryAccount_t* previous = g_memory_account;
+    g_memory_account = account;
+    return previous;
+}
+
+uint64_t svt_jxs_memory_account_get_live_bytes(MemoryAccount_t* account) {
+    const int64_t live_bytes = account ? svt_jxs_atomic_load_i64(&account->live_bytes) : 0;
+    return live_bytes > 0 ? (uint64_t)live_bytes : 0;
+}
+
+/*Write header before buffer at raw + header_offset and add buffer to active account, return buffer.*/
+static void* memory_header_init(void* raw, size_t header_offset, size_t size) {
+    if (raw == NULL) {
+        return NULL;
+    }
+    uint8_t* ptr = (uint8_t*)raw + header_offset;
+    MemoryHeader_t* header = (MemoryHeader_t*)(ptr - sizeof(MemoryHeader_t));
+    header->account = g_memory_account;
+    header->size = size;
+    if (header->account) {
+        svt_jxs_atomic_fetch_add_i64(&header->account->live_bytes, (int64_t)size);
+    }
+    return ptr;
+}
+
+/*Subtract buffer from its account, return pointer allocated by heap.*/
+static void* memory_header_release(void* ptr, size_t header_offset) {
+    MemoryHeader_t* header = (MemoryHeader_t*)((uint8_t*)ptr - sizeof(MemoryHeader_t));
+    if (header->account) {
+        svt_jxs_atomic_fetch_add_i64(&header->account->live_bytes, -(int64_t)header->size);
+    }
+    return (uint8_t*)ptr - header_offset;
+}
+
+void* svt_jxs_malloc(size_t size) {
+    MemoryArena_t* arena = svt_jxs_arena_get_active();
+    if (arena) {
+        return svt_jxs_arena_alloc(arena, size);
+    }
+    if (size > SIZE_MAX - MEMORY_HEADER_SIZE) {
+        return NULL;
+    }
+    return memory_header_init(malloc(MEMORY_HEADER_SIZE + size), MEMORY_HEADER_SIZE, size);
+}
+
+void* svt_jxs_calloc(size_t count, size_t size) {
+    if (size && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    MemoryArena_t* arena = svt_jxs_arena_get_active();
+    if (arena) {
+        /*Regions are mapped zeroed and never reused.*/
+        return svt_jxs_arena_alloc(arena, count * size);
+    }
+    if (count * size > SIZE_MAX - MEMORY_HEADER_SIZE) {
+        return NULL;
+    }
+    return memory_header_init(calloc(1, MEMORY_HEADER_SIZE + count * size), MEMORY_HEADER_SIZE, count * size);
+}
+
+void* svt_jxs_malloc_aligned(size_t size) {
+    MemoryArena_t* arena = svt_jxs_arena_get_active();
+    if (arena) {
+        return svt_jxs_arena_alloc(arena, size);
+    }
+    if (size > SIZE_MAX - ALVALUE) {
+        return NULL;
+    }
+#ifdef _WIN32
+    void* raw = _aligned_malloc(ALVALUE + size, ALVALUE);
+#else
+    void* raw;
+    if (posix_memalign(&raw, ALVALUE, ALVALUE + size) != 0) {
+        return NULL;
+    }
+#endif
+    return memory_header_init(raw, ALVALUE, size);
+}
+
+void svt_jxs_free(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    MemoryArena_t* arena = svt_jxs_arena_get_active();
+    if (arena && svt_jxs_arena_contains(arena, ptr)) {
+        return;
+    }
+    free(memory_header_release(ptr, MEMORY_HEADER_SIZE));
+}
+
+void svt_jxs_free_aligned(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    MemoryArena_t* arena = svt_jxs_arena_get_active();
+    if (arena && svt_jxs_arena_contains(arena, ptr)) {
+        return;
+    }
+#ifdef _WIN32
+    _aligned_free(memory_header_release(ptr, ALVALUE));
+#else
+    free(memory_header_release(ptr, ALVALUE));
+#endif
+}
+
 #ifdef DEBUG_MEMORY_USAGE
 
 static Handle_t g_malloc_mutex;
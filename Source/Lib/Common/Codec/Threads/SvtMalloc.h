@@ -22,6 +22,28 @@
 #define svt_print_alloc_fail(a, b) svt_jxs_print_alloc_fail_impl(a, b)
 void svt_jxs_print_alloc_fail_impl(const char* file, int line);
 
+/*Memory accounting of encoder or decoder instance, available also in Release build.
+ *Heap buffers allocated by thread with active account are added to it, instance sets its account active
+ *in every call that allocates its buffers. Every heap buffer has header with its size and account,
+ *so release on any thread subtracts it and account holds bytes live now. Buffers from arena are not counted.
+ *Synchronous contexts of one decoder can be created and destroyed by many threads, so counter is atomic.*/
+typedef struct MemoryAccount MemoryAccount_t;
+
+MemoryAccount_t* svt_jxs_memory_account_create(void);
+/*Buffers of account have to be released before.*/
+void svt_jxs_memory_account_destroy(MemoryAccount_t* account);
+/*Set account of buffers allocated by calling thread, return previous account.*/
+MemoryAccount_t* svt_jxs_memory_account_set_active(MemoryAccount_t* account);
+uint64_t svt_jxs_memory_account_get_live_bytes(MemoryAccount_t* account);
+
+/*Allocate from arena active in calling thread (svt_jxs_arena_set_active()) or from heap.*/
+void* svt_jxs_malloc(size_t size);
+void* svt_jxs_calloc(size_t count, size_t size);
+void* svt_jxs_malloc_aligned(size_t size);
+/*Buffers of active arena are released with arena.*/
+void svt_jxs_free(void* ptr);
+void svt_jxs_free_aligned(void* ptr);
+
 #ifdef DEBUG_MEMORY_USAGE
 void svt_jxs_print_memory_usage();
 void svt_jxs_increase_component_count();
@@ -57,8 +79,9 @@ void svt_jxs_remove_mem_entry(void* ptr, PointerType_t type);
     do {                                              \
         if (!p)                                       \
             svt_print_alloc_fail(__FILE__, __LINE__); \
-        else                                          \
+        else {                                        \
             SVT_ADD_MEM_ENTRY(p, type, size);         \
+        }                                             \
     } while (0)
 
 #define SVT_CHECK_MEM(p)                             \
@@ -75,7 +98,7 @@ void svt_jxs_remove_mem_entry(void* ptr, PointerType_t type);
 
 #define SVT_NO_THROW_MALLOC(pointer, size)                          \
     do {                                                            \
-        void* malloced_p = malloc(size);                            \
+        void* malloced_p = svt_jxs_malloc(size);                    \
         SVT_NO_THROW_ADD_MEM(malloced_p, size, POINTER_TYPE_N_PTR); \
         pointer = malloced_p;                                       \
     } while (0)
@@ -88,7 +111,7 @@ void svt_jxs_remove_mem_entry(void* ptr, PointerType_t type);
 
 #define SVT_NO_THROW_CALLOC(pointer, count, size)                       \
     do {                                                                \
-        pointer = calloc(count, size);                                  \
+        pointer = svt_jxs_calloc(count, size);                          \
         SVT_NO_THROW_ADD_MEM(pointer, count* size, POINTER_TYPE_C_PTR); \
     } while (0)
 
@@ -101,7 +124,7 @@ void svt_jxs_remove_mem_entry(void* ptr, PointerType_t type);
 #define SVT_FREE(pointer)                                  \
     do {                                                   \
         SVT_REMOVE_MEM_ENTRY(pointer, POINTER_TYPE_N_PTR); \
-        free(pointer);                                     \
+        svt_jxs_free(pointer);                             \
         pointer = NULL;                                    \
     } while (0)
 
@@ -110,17 +133,6 @@ void svt_jxs_remove_mem_entry(void* ptr, PointerType_t type);
         SVT_MALLOC(pa, sizeof(*(pa)) * (count)); \
     } while (0)
 
-#define SVT_REALLOC_ARRAY(pa, count)                      \
-    do {                                                  \
-        size_t size = sizeof(*(pa)) * (count);            \
-        void* p = realloc(pa, size);                      \
-        if (p) {                                          \
-            SVT_REMOVE_MEM_ENTRY(pa, POINTER_TYPE_N_PTR); \
-        }                                                 \
-        SVT_ADD_MEM(p, size, POINTER_TYPE_N_PTR);         \
-        pa = p;                                           \
-    } while (0)
-
 #define SVT_CALLOC_ARRAY(pa, count)           \
     do {                                      \
         SVT_CALLOC(pa, count, sizeof(*(pa))); \
@@ -165,34 +177,18 @@ void svt_jxs_remove_mem_entry(void* ptr, PointerType_t type);
         SVT_FREE_ARRAY(p2d);        \
     } while (0)
 
-#ifdef _WIN32
 #define SVT_MALLOC_ALIGNED(pointer, size)               \
     do {                                                \
-        pointer = _aligned_malloc(size, ALVALUE);       \
+        pointer = svt_jxs_malloc_aligned(size);         \
         SVT_ADD_MEM(pointer, size, POINTER_TYPE_A_PTR); \
     } while (0)
 
 #define SVT_FREE_ALIGNED(pointer)                          \
     do {                                                   \
         SVT_REMOVE_MEM_ENTRY(pointer, POINTER_TYPE_A_PTR); \
-        _aligned_free(pointer);                            \
+        svt_jxs_free_aligned(pointer);                     \
         pointer = NULL;                                    \
     } while (0)
-#else
-#define SVT_MALLOC_ALIGNED(pointer, size)                           \
-    do {                                                            \
-        if (posix_memalign((void**)&(pointer), ALVALUE, size) != 0) \
-            return SvtJxsErrorInsufficientResources;                \
-        SVT_ADD_MEM(pointer, size, POINTER_TYPE_A_PTR);             \
-    } while (0)
-
-#define SVT_FREE_ALIGNED(pointer)                          \
-    do {                                                   \
-        SVT_REMOVE_MEM_ENTRY(pointer, POINTER_TYPE_A_PTR); \
-        free(pointer);                                     \
-        pointer = NULL;                                    \
-    } while (0)
-#endif
 
 #define SVT_MALLOC_ALIGNED_ARRAY(pa, count) SVT_MALLOC_ALIGNED(pa, sizeof(*(pa)) * (count))
 
@@ -0,0 +1,216 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "SvtJpegxs.h"
+#include "SvtThreadPool.h"
+#include "SvtMalloc.h"
+
+struct svt_jpeg_xs_thread_pool {
+    DctorCall dctor;
+    uint32_t threads_num;
+    Handle_t *thread_handle_array;
+    // tasks_semaphore - posted once per submitted task
+    Handle_t tasks_semaphore;
+    int32_t quit_signal;
+    // mutex - protect ready list and pending tasks of clients
+    Handle_t mutex;
+    // ready_head, ready_tail - clients with pending tasks, served round robin so one instance
+    // that submit many tasks do not delay tasks of other instances sharing the pool
+    ThreadPoolClient_t *ready_head;
+    ThreadPoolClient_t *ready_tail;
+};
+
+/*Append client to the end of ready list, called with pool mutex locked.*/
+static void thread_pool_ready_push(struct svt_jpeg_xs_thread_pool *pool, ThreadPoolClient_t *client) {
+    client->ready_next = NULL;
+    if (pool->ready_tail) {
+        pool->ready_tail->ready_next = client;
+    }
+    else {
+        pool->ready_head = client;
+    }
+    pool->ready_tail = client;
+}
+
+/*Take one task of the first ready client and move the client to the end of list when it has more tasks.
+ *Return NULL when tasks were removed by closed client.*/
+static ThreadPoolClient_t *thread_pool_take(struct svt_jpeg_xs_thread_pool *pool) {
+    svt_jxs_block_on_mutex(pool->mutex);
+    ThreadPoolClient_t *client = pool->ready_head;
+    if (client) {
+        pool->ready_head = client->ready_next;
+        if (pool->ready_head == NULL) {
+            pool->ready_tail = NULL;
+        }
+        client->pending--;
+        if (client->pending) {
+            thread_pool_ready_push(pool, client);
+        }
+        svt_jxs_atomic_fetch_add_i32(&client->running, 1);
+    }
+    svt_jxs_release_mutex(pool->mutex);
+    return client;
+}
+
+/*Remove client with all its pending tasks from ready list.*/
+static void thread_pool_remove_client(struct svt_jpeg_xs_thread_pool *pool, ThreadPoolClient_t *client) {
+    svt_jxs_block_on_mutex(pool->mutex);
+    ThreadPoolClient_t *prev = NULL;
+    for (ThreadPoolClient_t *it = pool->ready_head; it; prev = it, it = it->ready_next) {
+        if (it == client) {
+            if (prev) {
+                prev->ready_next = it->ready_next;
+            }
+            else {
+                pool->ready_head = it->ready_next;
+            }
+            if (pool->ready_tail == it) {
+                pool->ready_tail = prev;
+            }
+            break;
+        }
+    }
+    client->pending = 0;
+    svt_jxs_release_mutex(pool->mutex);
+}
+
+static void thread_pool_run_task(ThreadPoolClient_t *client) {
+    const uint32_t lanes_num = client->pool->threads_num;
+    uint32_t lane = 0;
+    for (;;) {
+        int32_t expected = 0;
+        if (svt_jxs_atomic_cas_i32(&client->lane_busy_array[lane], &expected, 1)) {
+            break;
+        }
+        lane = (lane + 1) % lanes_num;
+    }
+    client->run_task(client->lane_ctx_array[lane]);
+    svt_jxs_atomic_store_i32(&client->lane_busy_array[lane], 0);
+    svt_jxs_atomic_fetch_add_i32(&client->running, -1);
+}
+
+static void *thread_pool_worker_kernel(void *input_ptr) {
+    struct svt_jpeg_xs_thread_pool *pool = (struct svt_jpeg_xs_thread_pool *)input_ptr;
+
+    for (;;) {
+        svt_jxs_block_on_semaphore(pool->tasks_semaphore);
+        if (svt_jxs_atomic_load_i32(&pool->quit_signal)) {
+            break;
+        }
+
+        ThreadPoolClient_t *client = thread_pool_take(pool);
+        /*Task can be already removed by closed client.*/
+        if (client) {
+            thread_pool_run_task(client);
+        }
+    }
+    return NULL;
+}
+
+static void thread_pool_dctor(void_ptr p) {
+    struct svt_jpeg_xs_thread_pool *pool = (struct svt_jpeg_xs_thread_pool *)p;
+    if (pool->thread_handle_array) {
+        svt_jxs_atomic_store_i32(&pool->quit_signal, 1);
+        for (uint32_t i = 0; i < pool->threads_num; i++) {
+            svt_jxs_post_semaphore(pool->tasks_semaphore);
+        }
+        SVT_DESTROY_THREAD_ARRAY(pool->thread_handle_array, pool->threads_num);
+    }
+    SVT_DESTROY_MUTEX(pool->mutex);
+    SVT_DESTROY_SEMAPHORE(pool->tasks_semaphore);
+}
+
+static SvtJxsErrorType_t thread_pool_ctor(struct svt_jpeg_xs_thread_pool *pool, uint32_t threads_num) {
+    pool->dctor = thread_pool_dctor;
+    pool->threads_num = threads_num;
+
+    SVT_CREATE_SEMAPHORE(pool->tasks_semaphore, 0, 0x7FFFFFFF);
+    if (pool->tasks_semaphore == NULL) {
+        return SvtJxsErrorInsufficientResources;
+    }
+
+    SVT_CREATE_MUTEX(pool->mutex);
+    if (pool->mutex == NULL) {
+        return SvtJxsErrorCreateMutexFailed;
+    }
+
+    SVT_ALLOC_PTR_ARRAY(pool->thread_handle_array, threads_num);
+    for (uint32_t i = 0; i < threads_num; i++) {
+        SVT_CREATE_THREAD(pool->thread_handle_array[i], thread_pool_worker_kernel, pool);
+    }
+    return SvtJxsErrorNone;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_thread_pool_create(uint64_t version_api_major, uint64_t version_api_minor,
+                                                            svt_jpeg_xs_thread_pool_t **pool, uint32_t threads_num) {
+    if (version_api_major > SVT_JPEGXS_API_VER_MAJOR ||
+        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
+        return SvtJxsErrorInvalidApiVersion;
+    }
+    if (pool == NULL || threads_num == 0) {
+        return SvtJxsErrorBadParameter;
+    }
+    *pool = NULL;
+
+    svt_jxs_increase_component_count();
+    struct svt_jpeg_xs_thread_pool *pool_ptr = NULL;
+    SVT_NO_THROW_NEW(pool_ptr, thread_pool_ctor, threads_num);
+    if (pool_ptr == NULL) {
+        svt_jxs_decrease_component_count();
+        return SvtJxsErrorInsufficientResources;
+    }
+    *pool = pool_ptr;
+    return SvtJxsErrorNone;
+}
+
+PREFIX_API void svt_jpeg_xs_thread_pool_destroy(svt_jpeg_xs_thread_pool_t *pool) {
+    if (pool) {
+        SVT_DELETE(pool);
+        svt_jxs_decrease_component_count();
+    }
+}
+
+uint32_t svt_jxs_thread_pool_get_threads_num(const struct svt_jpeg_xs_thread_pool *pool) {
+    return pool->threads_num;
+}
+
+static void thread_pool_client_dctor(void_ptr p) {
+    ThreadPoolClient_t *client = (ThreadPoolClient_t *)p;
+    struct svt_jpeg_xs_thread_pool *pool = client->pool;
+    if (pool) {
+        thread_pool_remove_client(pool, client);
+        /*Tasks taken before removal are counted in running.*/
+        while (svt_jxs_atomic_load_i32(&client->running)) {
+            svt_jxs_cpu_relax();
+        }
+    }
+    SVT_FREE(client->lane_busy_array);
+}
+
+SvtJxsErrorType_t svt_jxs_thread_pool_client_ctor(ThreadPoolClient_t *client, struct svt_jpeg_xs_thread_pool *pool,
+                                                  void (*run_task)(void *lane_ctx), void **lane_ctx_array) {
+    client->dctor = thread_pool_client_dctor;
+    client->run_task = run_task;
+    client->lane_ctx_array = lane_ctx_array;
+    SVT_CALLOC(client->lane_busy_array, pool->threads_num, sizeof(int32_t));
+    client->pool = pool;
+    return SvtJxsErrorNone;
+}
+
+SvtJxsErrorType_t svt_jxs_thread_pool_submit(ThreadPoolClient_t *client) {
+    struct svt_jpeg_xs_thread_pool *pool = client->pool;
+    svt_jxs_block_on_mutex(pool->mutex);
+    if (client->pending == 0) {
+        thread_pool_ready_push(pool, client);
+    }
+    client->pending++;
+    svt_jxs_release_mutex(pool->mutex);
+
+    svt_jxs_post_semaphore(pool->tasks_semaphore);
+    return SvtJxsErrorNone;
+}
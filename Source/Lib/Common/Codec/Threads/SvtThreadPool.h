@@ -0,0 +1,55 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _SVT_THREAD_POOL_H_
+#define _SVT_THREAD_POOL_H_
+
+#include "Definitions.h"
+#include "SvtObject.h"
+#include "SvtThreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************************************************************
+ * ThreadPoolClient
+ *   Encoder or decoder instance registered in the thread pool.
+ *   Every svt_jxs_thread_pool_submit() schedule one call of run_task.
+ *   run_task is executed on one of lanes of the client, lane is a
+ *   context that is never used by two workers at the same time.
+ *   Number of lanes is equal to number of threads in the pool, so
+ *   worker always find a free lane.
+ *   Workers take tasks of clients in round robin order, one task of
+ *   every client with pending tasks before next task of the same client.
+ *********************************************************************/
+typedef struct ThreadPoolClient {
+    DctorCall dctor;
+    struct svt_jpeg_xs_thread_pool *pool;
+    void (*run_task)(void *lane_ctx);
+    void **lane_ctx_array;
+    int32_t *lane_busy_array;
+    // running - number of tasks of client executed by workers right now
+    int32_t running;
+    // pending, ready_next - not started tasks and link in ready list of pool, protected by pool mutex
+    uint32_t pending;
+    struct ThreadPoolClient *ready_next;
+} ThreadPoolClient_t;
+
+/*Return number of worker threads in pool, every client have to provide that many lanes.*/
+uint32_t svt_jxs_thread_pool_get_threads_num(const struct svt_jpeg_xs_thread_pool *pool);
+
+/*Register client in pool. lane_ctx_array have svt_jxs_thread_pool_get_threads_num() entries.
+ *Client dctor remove not started tasks and wait until running tasks are finished.*/
+SvtJxsErrorType_t svt_jxs_thread_pool_client_ctor(ThreadPoolClient_t *client, struct svt_jpeg_xs_thread_pool *pool,
+                                                  void (*run_task)(void *lane_ctx), void **lane_ctx_array);
+
+/*Schedule one task of client.*/
+SvtJxsErrorType_t svt_jxs_thread_pool_submit(ThreadPoolClient_t *client);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*_SVT_THREAD_POOL_H_*/
@@ -25,6 +25,10 @@
 #define POINTER_TYPE_THREAD_SANITIZER_ENABLED 0
 #endif
 
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 /****************************************
  * Universal Includes
  ****************************************/
@@ -42,8 +46,12 @@
 #include <fcntl.h>
 #include <pthread.h>
 #include <semaphore.h>
+#include <string.h>
 #include <unistd.h>
 #endif // _WIN32
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 #ifdef __APPLE__
 #include <dispatch/dispatch.h>
 #endif
@@ -60,11 +68,157 @@ void printfTime(const char *fmt, ...) {
 #endif
 #endif
 
+static uint8_t cpu_set_is_empty(const svt_jpeg_xs_cpu_set_t *set) {
+    for (uint32_t i = 0; i < SVT_JPEGXS_CPU_SET_SIZE / 64; i++) {
+        if (set->bits[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+PREFIX_API void svt_jpeg_xs_thread_placement_init(svt_jpeg_xs_thread_placement_t *placement) {
+    if (placement) {
+        memset(placement, 0, sizeof(*placement));
+        placement->numa_node = -1;
+        placement->rt_priority = 0;
+    }
+}
+
+/****************************************
+ * NUMA memory policy
+ * Policy of calling thread is changed, pages are allocated on preferred node on first touch.
+ ****************************************/
+#define SVT_MPOL_DEFAULT   (0)
+#define SVT_MPOL_PREFERRED (1)
+
+void svt_jxs_numa_prefer_node(int32_t numa_node, NumaPolicy_t *saved_policy) {
+#if defined(__linux__) && defined(SYS_set_mempolicy) && defined(SYS_get_mempolicy)
+    if (saved_policy) {
+        int mode = SVT_MPOL_DEFAULT;
+        memset(saved_policy, 0, sizeof(*saved_policy));
+        if (syscall(SYS_get_mempolicy, &mode, saved_policy->nodemask, SVT_NUMA_NODES_MAX, NULL, 0)) {
+            mode = SVT_MPOL_DEFAULT;
+        }
+        saved_policy->mode = mode;
+    }
+    if (numa_node < 0 || numa_node >= SVT_NUMA_NODES_MAX - 1) {
+        return;
+    }
+    unsigned long nodemask[SVT_NUMA_NODES_MAX / (8 * sizeof(unsigned long))] = {0};
+    nodemask[numa_node / (8 * sizeof(unsigned long))] |= 1UL << (numa_node % (8 * sizeof(unsigned long)));
+    if (syscall(SYS_set_mempolicy, SVT_MPOL_PREFERRED, nodemask, SVT_NUMA_NODES_MAX)) {
+        SVT_WARN("Failed to set NUMA memory policy\n");
+    }
+#else
+    (void)numa_node;
+    if (saved_policy) {
+        memset(saved_policy, 0, sizeof(*saved_policy));
+    }
+#endif
+}
+
+void svt_jxs_numa_restore(const NumaPolicy_t *saved_policy) {
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    syscall(SYS_set_mempolicy,
+            saved_policy->mode,
+            saved_policy->mode == SVT_MPOL_DEFAULT ? NULL : saved_policy->nodemask,
+            SVT_NUMA_NODES_MAX);
+#else
+    (void)saved_policy;
+#endif
+}
+
+void svt_jxs_thread_placement_resolve(svt_jpeg_xs_thread_placement_t *placement) {
+    if (placement->numa_node < 0 || !cpu_set_is_empty(&placement->cpu_set)) {
+        return;
+    }
+#if defined(__linux__)
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", placement->numa_node);
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        SVT_WARN("Unknown NUMA node %d, threads are not pinned\n", placement->numa_node);
+        return;
+    }
+    /*Format of cpulist: 0-15,32-47*/
+    uint32_t first, last;
+    while (fscanf(file, "%u", &first) == 1) {
+        last = first;
+        int c = fgetc(file);
+        if (c == '-') {
+            if (fscanf(file, "%u", &last) != 1) {
+                break;
+            }
+            c = fgetc(file);
+        }
+        for (uint32_t cpu = first; cpu <= last && cpu < SVT_JPEGXS_CPU_SET_SIZE; cpu++) {
+            SVT_JPEGXS_CPU_SET_ADD(&placement->cpu_set, cpu);
+        }
+        if (c != ',') {
+            break;
+        }
+    }
+    fclose(file);
+#endif
+}
+
+#if defined(__linux__)
+typedef struct ThreadStartContext {
+    void *(*thread_function)(void *);
+    void *thread_context;
+    svt_jpeg_xs_cpu_set_t cpu_set;
+    int32_t numa_node;
+} ThreadStartContext_t;
+
+/*Apply CPU and NUMA placement from inside of new thread, then run thread function.*/
+static void *thread_start_placed(void *input_ptr) {
+    ThreadStartContext_t start = *(ThreadStartContext_t *)input_ptr;
+    free(input_ptr);
+
+    if (!cpu_set_is_empty(&start.cpu_set)) {
+        cpu_set_t *set = CPU_ALLOC(SVT_JPEGXS_CPU_SET_SIZE);
+        if (set) {
+            const size_t set_size = CPU_ALLOC_SIZE(SVT_JPEGXS_CPU_SET_SIZE);
+            CPU_ZERO_S(set_size, set);
+            for (uint32_t cpu = 0; cpu < SVT_JPEGXS_CPU_SET_SIZE; cpu++) {
+                if (SVT_JPEGXS_CPU_SET_CHECK(&start.cpu_set, cpu)) {
+                    CPU_SET_S(cpu, set_size, set);
+                }
+            }
+            if (sched_setaffinity(0, set_size, set)) {
+                SVT_WARN("Failed to set thread affinity\n");
+            }
+            CPU_FREE(set);
+        }
+    }
+    if (start.numa_node >= 0) {
+        svt_jxs_numa_prefer_node(start.numa_node, NULL);
+    }
+    return start.thread_function(start.thread_context);
+}
+#endif
+
 /****************************************
  * svt_jxs_create_thread
  ****************************************/
 Handle_t svt_jxs_create_thread(void *(*thread_function)(void *), void *thread_context) {
+    return svt_jxs_create_thread_placed(thread_function, thread_context, NULL, 0);
+}
+
+/****************************************
+ * svt_jxs_create_thread_placed
+ ****************************************/
+Handle_t svt_jxs_create_thread_placed(void *(*thread_function)(void *), void *thread_context,
+                                      const svt_jpeg_xs_thread_placement_t *placement, uint8_t slice_stage) {
     Handle_t thread_handle = NULL;
+    const svt_jpeg_xs_cpu_set_t *cpu_set = NULL;
+    int32_t rt_priority = 0;
+    if (placement) {
+        cpu_set = (slice_stage && !cpu_set_is_empty(&placement->slice_cpu_set)) ? &placement->slice_cpu_set
+                                                                                : &placement->cpu_set;
+        rt_priority = placement->rt_priority;
+    }
 
 #ifdef _WIN32
 
@@ -76,11 +230,20 @@ Handle_t svt_jxs_create_thread(void *(*thread_function)(void *), void *thread_co
                                            0,                                       // default stack size
                                            (LPTHREAD_START_ROUTINE)thread_function, // function to be tied to the new thread
                                            thread_context,                          // context to be tied to the new thread
-                                           0,                                       // thread active when created
+                                           placement ? CREATE_SUSPENDED : 0,        // placement is applied before start
                                            NULL);                                   // new thread ID
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif //__GNUC__
+    if (thread_handle && placement) {
+        if (cpu_set->bits[0] && !SetThreadAffinityMask(thread_handle, (DWORD_PTR)cpu_set->bits[0])) {
+            SVT_WARN("Failed to set thread affinity\n");
+        }
+        if (rt_priority > 0 && !SetThreadPriority(thread_handle, THREAD_PRIORITY_TIME_CRITICAL)) {
+            SVT_WARN("Failed to set thread priority\n");
+        }
+        ResumeThread(thread_handle);
+    }
 
 #else
     pthread_attr_t attr;
@@ -107,8 +270,34 @@ Handle_t svt_jxs_create_thread(void *(*thread_function)(void *), void *thread_co
         return NULL;
     }
 
-    if (pthread_create(th, &attr, thread_function, thread_context)) {
+    void *(*start_function)(void *) = thread_function;
+    void *start_context = thread_context;
+#if defined(__linux__)
+    if (placement && (!cpu_set_is_empty(cpu_set) || placement->numa_node >= 0)) {
+        ThreadStartContext_t *start = malloc(sizeof(*start));
+        if (start == NULL) {
+            SVT_ERROR("Failed to allocate thread start context\n");
+            free(th);
+            return NULL;
+        }
+        start->thread_function = thread_function;
+        start->thread_context = thread_context;
+        start->cpu_set = *cpu_set;
+        start->numa_node = placement->numa_node;
+        start_function = thread_start_placed;
+        start_context = start;
+    }
+#else
+    if (placement && !cpu_set_is_empty(cpu_set)) {
+        SVT_WARN("Thread affinity is not supported on this platform\n");
+    }
+#endif
+
+    if (pthread_create(th, &attr, start_function, start_context)) {
         SVT_ERROR("Failed to create thread: %s\n", strerror(errno));
+        if (start_context != thread_context) {
+            free(start_context);
+        }
         free(th);
         return NULL;
     }
@@ -127,10 +316,16 @@ Handle_t svt_jxs_create_thread(void *(*thread_function)(void *), void *thread_co
      * the thread priority will __always__ fail the thread sanitizer.
      * https://github.com/google/sanitizers/issues/1088
      */
-    if (!POINTER_TYPE_THREAD_SANITIZER_ENABLED && !geteuid()) {
-        if (pthread_setschedparam(*th, SCHED_FIFO, &(struct sched_param){.sched_priority = 99}))
-            SVT_WARN("Failed to set thread priority\n");
-        // ignore if this failed
+    if (rt_priority > 0) {
+        if (!POINTER_TYPE_THREAD_SANITIZER_ENABLED && !geteuid()) {
+            struct sched_param param = {.sched_priority = rt_priority > 99 ? 99 : rt_priority};
+            if (pthread_setschedparam(*th, SCHED_FIFO, &param))
+                SVT_WARN("Failed to set thread priority\n");
+            // ignore if this failed
+        }
+        else {
+            SVT_WARN("Realtime thread priority requires root privileges\n");
+        }
     }
     thread_handle = th;
 #endif // _WIN32
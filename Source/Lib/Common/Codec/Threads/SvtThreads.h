@@ -29,6 +29,24 @@ extern "C" {
      * Threads
      **************************************/
 extern Handle_t svt_jxs_create_thread(void *(*thread_function)(void *), void *thread_context);
+/*Create thread pinned to CPUs of placement, slice_stage select slice_cpu_set when not empty.*/
+extern Handle_t svt_jxs_create_thread_placed(void *(*thread_function)(void *), void *thread_context,
+                                             const svt_jpeg_xs_thread_placement_t *placement, uint8_t slice_stage);
+/*Fill empty cpu_set with CPUs of placement NUMA node.*/
+extern void svt_jxs_thread_placement_resolve(svt_jpeg_xs_thread_placement_t *placement);
+
+/**************************************
+     * NUMA
+     **************************************/
+#define SVT_NUMA_NODES_MAX (1024)
+typedef struct NumaPolicy {
+    int32_t mode;
+    unsigned long nodemask[SVT_NUMA_NODES_MAX / (8 * sizeof(unsigned long))];
+} NumaPolicy_t;
+
+/*Prefer memory of numa_node for calling thread, previous policy is stored in saved_policy when not NULL.*/
+extern void svt_jxs_numa_prefer_node(int32_t numa_node, NumaPolicy_t *saved_policy);
+extern void svt_jxs_numa_restore(const NumaPolicy_t *saved_policy);
 
 extern SvtJxsErrorType_t svt_jxs_destroy_thread(Handle_t thread_handle);
 
@@ -97,6 +115,19 @@ extern SvtJxsErrorType_t svt_jxs_destroy_mutex(Handle_t mutex_handle);
             SVT_CREATE_THREAD(pa[i], thread_function, thread_contexts[i]);   \
     } while (0)
 
+#define SVT_CREATE_THREAD_PLACED(pointer, thread_function, thread_context, placement, slice_stage)          \
+    do {                                                                                                    \
+        pointer = svt_jxs_create_thread_placed(thread_function, thread_context, placement, slice_stage);    \
+        SVT_ADD_MEM(pointer, 1, POINTER_TYPE_THREAD);                                                       \
+    } while (0)
+
+#define SVT_CREATE_THREAD_ARRAY_PLACED(pa, count, thread_function, thread_contexts, placement, slice_stage) \
+    do {                                                                                                    \
+        SVT_ALLOC_PTR_ARRAY(pa, count);                                                                     \
+        for (uint32_t i = 0; i < count; i++)                                                                \
+            SVT_CREATE_THREAD_PLACED(pa[i], thread_function, thread_contexts[i], placement, slice_stage);   \
+    } while (0)
+
 #define SVT_DESTROY_THREAD_ARRAY(pa, count)      \
     do {                                         \
         if (pa) {                                \
@@ -126,6 +157,75 @@ SvtJxsErrorType_t svt_jxs_set_cond_var(CondVar *cond_var, int32_t new_value);
 SvtJxsErrorType_t svt_jxs_add_cond_var(CondVar *cond_var, int32_t add_value);
 SvtJxsErrorType_t svt_jxs_wait_cond_var(CondVar *cond_var, int32_t input);
 
+/**************************************
+     * Atomics
+     *   Sequentially consistent on MSVC, acquire/release elsewhere.
+     **************************************/
+#if defined(_MSC_VER)
+#include <intrin.h>
+static INLINE int32_t svt_jxs_atomic_load_i32(volatile int32_t *ptr) {
+    return (int32_t)_InterlockedOr((volatile long *)ptr, 0);
+}
+static INLINE void svt_jxs_atomic_store_i32(volatile int32_t *ptr, int32_t value) {
+    _InterlockedExchange((volatile long *)ptr, (long)value);
+}
+/*Return previous value*/
+static INLINE int32_t svt_jxs_atomic_fetch_add_i32(volatile int32_t *ptr, int32_t value) {
+    return (int32_t)_InterlockedExchangeAdd((volatile long *)ptr, (long)value);
+}
+/*Return 1 and write desired when *ptr is equal *expected, otherwise update *expected*/
+static INLINE int32_t svt_jxs_atomic_cas_i32(volatile int32_t *ptr, int32_t *expected, int32_t desired) {
+    const int32_t prev = (int32_t)_InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)*expected);
+    if (prev == *expected) {
+        return 1;
+    }
+    *expected = prev;
+    return 0;
+}
+static INLINE int64_t svt_jxs_atomic_load_i64(volatile int64_t *ptr) {
+    return (int64_t)_InterlockedOr64((volatile __int64 *)ptr, 0);
+}
+/*Return previous value*/
+static INLINE int64_t svt_jxs_atomic_fetch_add_i64(volatile int64_t *ptr, int64_t value) {
+    return (int64_t)_InterlockedExchangeAdd64((volatile __int64 *)ptr, (__int64)value);
+}
+#else
+static INLINE int32_t svt_jxs_atomic_load_i32(volatile int32_t *ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+static INLINE void svt_jxs_atomic_store_i32(volatile int32_t *ptr, int32_t value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+/*Return previous value*/
+static INLINE int32_t svt_jxs_atomic_fetch_add_i32(volatile int32_t *ptr, int32_t value) {
+    return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+}
+/*Return 1 and write desired when *ptr is equal *expected, otherwise update *expected*/
+static INLINE int32_t svt_jxs_atomic_cas_i32(volatile int32_t *ptr, int32_t *expected, int32_t desired) {
+    return __atomic_compare_exchange_n(ptr, expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+static INLINE int64_t svt_jxs_atomic_load_i64(volatile int64_t *ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+/*Return previous value*/
+static INLINE int64_t svt_jxs_atomic_fetch_add_i64(volatile int64_t *ptr, int64_t value) {
+    return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+}
+#endif
+
+/*Hint to CPU that thread is in spin-wait loop*/
+static INLINE void svt_jxs_cpu_relax(void) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,7 +20,7 @@ extern "C" {
 /*********************************
      * Defines
      *********************************/
-#define ObjectWrapperReleasedValue ~0u
+#define ObjectWrapperReleasedValue (-1)
 
 /*********************************************************************
       * Object Wrapper
@@ -36,9 +36,9 @@ typedef struct ObjectWrapper {
     void *object_ptr;
 
     // live_count - a count of the number of pictures actively being
-    //   encoded in the pipeline at any given time.  Modification
-    //   of this value by any process must be protected by a mutex.
-    uint32_t live_count;
+    //   encoded in the pipeline at any given time.  Object can be
+    //   released by any process, so it is modified only by atomics.
+    volatile int32_t live_count;
 
     // release_enable - a flag that enables the release of
     //   ObjectWrapper_t for reuse in the encoding of subsequent
@@ -48,65 +48,59 @@ typedef struct ObjectWrapper {
     // system_resource_ptr - a pointer to the SystemResourceManager
     //   that the object belongs to.
     struct SystemResource *system_resource_ptr;
-
-    // next_ptr - a pointer to a different ObjectWrapper_t.  Used
-    //   only in the implementation of a single-linked Fifo.
-    struct ObjectWrapper *next_ptr;
 } ObjectWrapper_t;
 
 /*********************************************************************
      * Fifo
-     *   Defines a static (i.e. no dynamic memory allocation) single
-     *   linked-list, constant time fifo implementation. The fifo uses
-     *   the ObjectWrapper_t member next_ptr to create the linked-list.
-     *   The Fifo also contains a counting_semaphore for OS thread-blocking
-     *   and dynamic ObjectWrapper_t counting.
+     *   Handle of one producer or consumer process to a MuxingQueue.
+     *   Every process of a queue shares the same ring, so an object is
+     *   taken by the first process that asks for it.
      *********************************************************************/
 typedef struct Fifo {
     DctorCall dctor;
-    // counting_semaphore - used for OS thread-blocking & dynamically
-    //   counting the number of ObjectWrapper_ts currently in the
-    //   Fifo_t.
-    Handle_t counting_semaphore;
-
-    // lockout_mutex - used to prevent more than one thread from
-    //   modifying Fifo_t simultaneously.
-    Handle_t lockout_mutex;
-
-    // first_ptr - head pointer of the FIFO.
-    ObjectWrapper_t *first_ptr;
-
-    // last_ptr - pointer to the tail of the Fifo
-    ObjectWrapper_t *last_ptr;
-
-    // quit_signal - a flag that main thread sets to break out from kernels
-    uint8_t quit_signal;
-
     // queue_ptr - pointer to MuxingQueue that the Fifo_t is
     //   associated with.
     struct MuxingQueue *queue_ptr;
 } Fifo_t;
 
 /*********************************************************************
-     * CircularBuffer
+     * RingCell
+     *   Slot of the MuxingQueue ring. sequence tells producers and
+     *   consumers in which lap the slot can be written or read.
      *********************************************************************/
-typedef struct CircularBuffer {
-    DctorCall dctor;
-    void_ptr *array_ptr;
-    uint32_t head_index;
-    uint32_t tail_index;
-    uint32_t buffer_total_count;
-    uint32_t current_count;
-} CircularBuffer_t;
+typedef struct RingCell {
+    int32_t sequence;
+    ObjectWrapper_t *wrapper_ptr;
+} RingCell_t;
 
 /*********************************************************************
      * MuxingQueue
+     *   Bounded lock-free multi-producer multi-consumer ring of
+     *   ObjectWrapper_t. Ring is never full because it is sized for every
+     *   object of the SystemResource. Consumers spin shortly on
+     *   available_count and then sleep on counting_semaphore, which is
+     *   touched only when a consumer is really blocked.
      *********************************************************************/
 typedef struct MuxingQueue {
     DctorCall dctor;
-    Handle_t lockout_mutex;
-    CircularBuffer_t *object_queue;
-    CircularBuffer_t *process_queue;
+    RingCell_t *cells;
+    uint32_t cells_mask;
+
+    // Producer and consumer positions are kept on separate cache lines.
+    uint8_t padding_enqueue[64];
+    int32_t enqueue_pos;
+    uint8_t padding_dequeue[64];
+    int32_t dequeue_pos;
+    uint8_t padding_count[64];
+
+    // available_count - number of objects in the ring not yet reserved by
+    //   a consumer. Negative value is the number of blocked consumers.
+    int32_t available_count;
+    Handle_t counting_semaphore;
+
+    // quit_signal - a flag that main thread sets to break out from kernels
+    int32_t quit_signal;
+
     uint32_t process_total_count;
     Fifo_t **process_fifo_ptr_array;
 } MuxingQueue_t;
@@ -192,9 +186,8 @@ Fifo_t *svt_jxs_system_resource_get_consumer_fifo(const SystemResource_t *resour
      * SystemResource_tGetEmptyObject
      *   Dequeues an empty ObjectWrapper_t from the SystemResource.  The
      *   new ObjectWrapper_t will be populated with the contents of the
-     *   wrapperCopyPtr if wrapperCopyPtr is not NULL. This function blocks
-     *   on the SystemResource emptyFifo counting_semaphore. This function
-     *   is write protected by the SystemResource emptyFifo lockout_mutex.
+     *   wrapperCopyPtr if wrapperCopyPtr is not NULL. This function spins
+     *   shortly and then blocks on the empty queue counting_semaphore.
      *
      *   resource_ptr
      *      pointer to the SystemResource that provides the empty
@@ -211,9 +204,8 @@ extern SvtJxsErrorType_t svt_jxs_get_empty_object_non_blocking(Fifo_t *empty_fif
 /*********************************************************************
      * SystemResource_tPostObject
      *   Queues a full ObjectWrapper_t to the SystemResource. This
-     *   function posts the SystemResource fullFifo counting_semaphore.
-     *   This function is write protected by the SystemResource fullFifo
-     *   lockout_mutex.
+     *   function posts the full queue counting_semaphore only when a
+     *   consumer is blocked on it.
      *
      *   resource_ptr
      *      pointer to the SystemResource that the ObjectWrapper_t is
@@ -227,9 +219,8 @@ extern SvtJxsErrorType_t svt_jxs_post_full_object(ObjectWrapper_t *object_ptr);
 /*********************************************************************
      * SystemResource_tGetFullObject
      *   Dequeues an full ObjectWrapper_t from the SystemResource. This
-     *   function blocks on the SystemResource fullFifo counting_semaphore.
-     *   This function is write protected by the SystemResource fullFifo
-     *   lockout_mutex.
+     *   function spins shortly and then blocks on the full queue
+     *   counting_semaphore.
      *
      *   resource_ptr
      *      pointer to the SystemResource that provides the full
@@ -246,9 +237,8 @@ extern SvtJxsErrorType_t svt_jxs_get_full_object_non_blocking(Fifo_t *full_fifo_
 /*********************************************************************
      * SystemResource_tReleaseObject
      *   Queues an empty ObjectWrapper_t to the SystemResource. This
-     *   function posts the SystemResource emptyFifo counting_semaphore.
-     *   This function is write protected by the SystemResource emptyFifo
-     *   lockout_mutex.
+     *   function posts the empty queue counting_semaphore only when a
+     *   producer is blocked on it.
      *
      *   object_ptr
      *      pointer to ObjectWrapper_t to be released.
@@ -105,11 +105,10 @@ CPU_FLAGS get_cpu_flags() {
 #define SET_AVX2(ptr, c, avx2)                              SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, 0)
 #define SET_AVX2_AVX512(ptr, c, avx2, avx512)               SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, avx512)
 
-void setup_common_rtcd_internal(CPU_FLAGS flags) {
-    /* Avoid check that pointer is set double, after first  setup. */
-    static uint8_t first_call_setup = 1;
-    uint8_t check_pointer_was_set = first_call_setup;
-    first_call_setup = 0;
+void setup_common_rtcd(common_rtcd_t* rtcd, CPU_FLAGS flags) {
+    /* Table is always resolved from scratch, so check that no pointer is set twice. */
+    uint8_t check_pointer_was_set = 1;
+    memset(rtcd, 0, sizeof(*rtcd));
 #ifdef ARCH_X86_64
     /** Should be done during library initialization,
       but for safe limiting CPU flags again. */
@@ -119,5 +118,15 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
     (void)flags;
 #endif
 
-    SET_SSE2(svt_log2_32, log2_32_c, Log2_32_ASM);
+    SET_SSE2(rtcd->svt_log2_32, log2_32_c, Log2_32_ASM);
+}
+
+void bind_common_rtcd(const common_rtcd_t* rtcd) {
+    svt_log2_32 = rtcd->svt_log2_32;
+}
+
+void setup_common_rtcd_internal(CPU_FLAGS flags) {
+    common_rtcd_t rtcd;
+    setup_common_rtcd(&rtcd, flags);
+    bind_common_rtcd(&rtcd);
 }
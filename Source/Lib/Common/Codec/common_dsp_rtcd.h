@@ -9,10 +9,19 @@
 
 #include "Definitions.h"
 
+/* Kernel pointers are thread local. Every encoder/decoder instance resolves its own
+ * dispatch table from its use_cpu_flags and binds it to each of its threads, so
+ * instances with different CPU flags never overwrite each other's kernels. */
+#if defined(_MSC_VER)
+#define RTCD_THREAD_LOCAL __declspec(thread)
+#else
+#define RTCD_THREAD_LOCAL __thread
+#endif
+
 #ifdef RTCD_C
-#define RTCD_EXTERN // CHKN RTCD call in effect. declare the function pointers in  encHandle.
+#define RTCD_EXTERN RTCD_THREAD_LOCAL // CHKN RTCD call in effect. declare the function pointers in  encHandle.
 #else
-#define RTCD_EXTERN extern // CHKN run time externing the function pointers.
+#define RTCD_EXTERN extern RTCD_THREAD_LOCAL // CHKN run time externing the function pointers.
 #endif
 
 /**************************************
@@ -27,8 +36,17 @@
 extern "C" {
 #endif
 
+typedef struct common_rtcd {
+    uint32_t (*svt_log2_32)(uint32_t x);
+} common_rtcd_t;
+
 // Helper Functions
 CPU_FLAGS get_cpu_flags();
+/* Resolve table for flags, no global state is modified. */
+void setup_common_rtcd(common_rtcd_t* rtcd, CPU_FLAGS flags);
+/* Bind table to kernel pointers of calling thread. */
+void bind_common_rtcd(const common_rtcd_t* rtcd);
+/* Resolve and bind on calling thread. */
 void setup_common_rtcd_internal(CPU_FLAGS flags);
 uint32_t log2_32_c(uint32_t x);
 RTCD_EXTERN uint32_t (*svt_log2_32)(uint32_t x);
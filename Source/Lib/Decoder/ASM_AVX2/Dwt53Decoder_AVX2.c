@@ -133,6 +133,137 @@ void idwt_horizontal_line_lf16_hf16_avx2(const int16_t *lf_ptr, const int16_t *h
     }
 }
 
+static INLINE __m256i output_linear_clamp_avx2(__m256i v, __m256i round, int32_t dzeta, __m256i max) {
+    v = _mm256_srai_epi32(_mm256_add_epi32(v, round), dzeta);
+    return _mm256_max_epi32(_mm256_min_epi32(v, max), _mm256_setzero_si256());
+}
+
+static INLINE void idwt_horizontal_line_lf32_hf16_output_avx2(const int32_t *lf_ptr, const int16_t *hf_ptr, void *out,
+                                                              uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth,
+                                                              uint8_t output_16bit) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    const int32_t dzeta = bw - depth;
+    const __m256i round_avx2 = _mm256_set1_epi32(((1 << bw) >> 1) + ((1 << dzeta) >> 1));
+    const __m256i max_avx2 = _mm256_set1_epi32((1 << depth) - 1);
+
+    int32_t prev_even = lf_ptr[0] - ((((int32_t)hf_ptr[0] << shift) + 1) >> 1);
+
+    const __m256i reg_permutevar_mask_move_right = _mm256_setr_epi32(0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06);
+    const __m256i two = _mm256_set1_epi32(2);
+
+    const uint32_t simd_batch = (len - 2) / 16;
+
+    for (uint32_t i = 0; i < simd_batch; i++) {
+        const __m256i lf_avx2 = _mm256_loadu_si256((__m256i *)(lf_ptr + i * 8 + 1));
+        const __m256i hf1_avx2 = _mm256_slli_epi32(_mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i *)(hf_ptr + i * 8))), shift);
+        const __m256i hf2_avx2 = _mm256_slli_epi32(_mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i *)(hf_ptr + i * 8 + 1))),
+                                                   shift);
+
+        __m256i even = _mm256_add_epi32(hf1_avx2, hf2_avx2);
+        even = _mm256_add_epi32(even, two);
+        even = _mm256_srai_epi32(even, 2);
+        even = _mm256_sub_epi32(lf_avx2, even);
+
+        int32_t next_even = _mm256_extract_epi32(even, 7);
+        __m256i even_m1 = _mm256_permutevar8x32_epi32(even, reg_permutevar_mask_move_right);
+        even_m1 = _mm256_insert_epi32(even_m1, prev_even, 0);
+
+        //out[0] + out[2]
+        __m256i odd = _mm256_add_epi32(even_m1, even);
+        odd = _mm256_srai_epi32(odd, 1);
+        odd = _mm256_add_epi32(odd, hf1_avx2);
+
+        even_m1 = output_linear_clamp_avx2(even_m1, round_avx2, dzeta, max_avx2);
+        odd = output_linear_clamp_avx2(odd, round_avx2, dzeta, max_avx2);
+
+        if (output_16bit) {
+            /*Odd sample in high 16 bits of every 32 bits give 16 output samples in order*/
+            _mm256_storeu_si256((__m256i *)((uint16_t *)out + i * 16), _mm256_or_si256(even_m1, _mm256_slli_epi32(odd, 16)));
+        }
+        else {
+            /*Odd sample in second byte of every 32 bits, then pack to 16 bytes*/
+            __m256i pairs = _mm256_or_si256(even_m1, _mm256_slli_epi32(odd, 8));
+            pairs = _mm256_packus_epi32(pairs, pairs);
+            pairs = _mm256_permute4x64_epi64(pairs, 0x08);
+            _mm_storeu_si128((__m128i *)((uint8_t *)out + i * 16), _mm256_castsi256_si128(pairs));
+        }
+
+        prev_even = next_even;
+    }
+    idwt_horizontal_line_lf32_hf16_output_end(
+        lf_ptr, hf_ptr, out, len, simd_batch * 16, prev_even, shift, bw, depth, output_16bit);
+}
+
+void idwt_horizontal_line_lf32_hf16_output_8bit_avx2(const int32_t *lf_ptr, const int16_t *hf_ptr, uint8_t *out_ptr, uint32_t len,
+                                                     uint8_t shift, uint8_t bw, uint8_t depth) {
+    idwt_horizontal_line_lf32_hf16_output_avx2(lf_ptr, hf_ptr, out_ptr, len, shift, bw, depth, 0);
+}
+
+void idwt_horizontal_line_lf32_hf16_output_16bit_avx2(const int32_t *lf_ptr, const int16_t *hf_ptr, uint16_t *out_ptr,
+                                                      uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth) {
+    idwt_horizontal_line_lf32_hf16_output_avx2(lf_ptr, hf_ptr, out_ptr, len, shift, bw, depth, 1);
+}
+
+/*Store 8 samples, already clamped to output range, to 8bit or 16bit output line.*/
+static INLINE void store_output_line_avx2(void *out, uint32_t id, __m256i v, uint8_t output_16bit) {
+    v = _mm256_packus_epi32(v, v);
+    v = _mm256_permute4x64_epi64(v, 0x08);
+    if (output_16bit) {
+        _mm_storeu_si128((__m128i *)((uint16_t *)out + id), _mm256_castsi256_si128(v));
+    }
+    else {
+        const __m128i v_128 = _mm256_castsi256_si128(v);
+        _mm_storel_epi64((__m128i *)((uint8_t *)out + id), _mm_packus_epi16(v_128, v_128));
+    }
+}
+
+static INLINE void idwt_vertical_line_output_avx2(const int32_t *in_lf, const int32_t *in_hf0, const int32_t *in_hf1,
+                                                  int32_t *out[4], void *out_odd, void *out_even, uint32_t len, uint8_t bw,
+                                                  uint8_t depth, uint8_t output_16bit) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    const int32_t dzeta = bw - depth;
+    const __m256i round_avx2 = _mm256_set1_epi32(((1 << bw) >> 1) + ((1 << dzeta) >> 1));
+    const __m256i max_avx2 = _mm256_set1_epi32((1 << depth) - 1);
+    const __m256i two = _mm256_set1_epi32(2);
+    const uint32_t simd_len = len - (len % 8);
+    int32_t *out_0 = out[0];
+    int32_t *out_2 = out[2];
+
+    uint32_t i = 0;
+    for (; i < simd_len; i += 8) {
+        __m256i lf = _mm256_loadu_si256((__m256i *)(in_lf + i));
+        __m256i hf0 = _mm256_loadu_si256((__m256i *)(in_hf0 + i));
+        __m256i hf1 = _mm256_loadu_si256((__m256i *)(in_hf1 + i));
+
+        //out_2[0] = in_lf[0] - ((in_hf0[0] + in_hf1[0] + 2) >> 2);
+        __m256i out2 = _mm256_add_epi32(hf0, hf1);
+        out2 = _mm256_add_epi32(out2, two);
+        out2 = _mm256_srai_epi32(out2, 2);
+        out2 = _mm256_sub_epi32(lf, out2);
+
+        //out_1[0] = in_hf0[0] + ((out_0[0] + out_2[0]) >> 1);
+        __m256i out0 = _mm256_loadu_si256((__m256i *)(out_0 + i));
+        __m256i out1 = _mm256_add_epi32(out0, out2);
+        out1 = _mm256_srai_epi32(out1, 1);
+        out1 = _mm256_add_epi32(out1, hf0);
+
+        _mm256_storeu_si256((__m256i *)(out_2 + i), out2);
+        store_output_line_avx2(out_even, i, output_linear_clamp_avx2(out2, round_avx2, dzeta, max_avx2), output_16bit);
+        store_output_line_avx2(out_odd, i, output_linear_clamp_avx2(out1, round_avx2, dzeta, max_avx2), output_16bit);
+    }
+    idwt_vertical_line_output_end(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, i, bw, depth, output_16bit);
+}
+
+void idwt_vertical_line_output_8bit_avx2(const int32_t *in_lf, const int32_t *in_hf0, const int32_t *in_hf1, int32_t *out[4],
+                                         uint8_t *out_odd, uint8_t *out_even, uint32_t len, uint8_t bw, uint8_t depth) {
+    idwt_vertical_line_output_avx2(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, bw, depth, 0);
+}
+
+void idwt_vertical_line_output_16bit_avx2(const int32_t *in_lf, const int32_t *in_hf0, const int32_t *in_hf1, int32_t *out[4],
+                                          uint16_t *out_odd, uint16_t *out_even, uint32_t len, uint8_t bw, uint8_t depth) {
+    idwt_vertical_line_output_avx2(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, bw, depth, 1);
+}
+
 void idwt_vertical_line_avx2(const int32_t *in_lf, const int32_t *in_hf0, const int32_t *in_hf1, int32_t *out[4], uint32_t len,
                              int32_t first_precinct, int32_t last_precinct, int32_t height) {
     assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
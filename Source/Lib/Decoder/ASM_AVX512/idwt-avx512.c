@@ -6,6 +6,7 @@
 #include "idwt-avx512.h"
 #include <immintrin.h>
 #include "Definitions.h"
+#include "Idwt.h"
 
 uint32_t loop_short_lf32_hf16(uint32_t len, const int32_t** lf_ptr, const int16_t** hf_ptr, int32_t** out_ptr, int32_t* prev_even,
                               uint8_t shift) {
@@ -120,6 +121,130 @@ void idwt_horizontal_line_lf32_hf16_avx512(const int32_t* lf_ptr, const int16_t*
     }
 }
 
+static INLINE __m512i output_linear_clamp_avx512(__m512i v, __m512i round, int32_t dzeta, __m512i max) {
+    v = _mm512_srai_epi32(_mm512_add_epi32(v, round), dzeta);
+    return _mm512_max_epi32(_mm512_min_epi32(v, max), _mm512_setzero_si512());
+}
+
+static INLINE void idwt_horizontal_line_lf32_hf16_output_avx512(const int32_t* lf_ptr, const int16_t* hf_ptr, void* out,
+                                                                uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth,
+                                                                uint8_t output_16bit) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    const int32_t dzeta = bw - depth;
+    const __m512i round_avx512 = _mm512_set1_epi32(((1 << bw) >> 1) + ((1 << dzeta) >> 1));
+    const __m512i max_avx512 = _mm512_set1_epi32((1 << depth) - 1);
+
+    int32_t prev_even = lf_ptr[0] - ((((int32_t)hf_ptr[0] << shift) + 1) >> 1);
+
+    const __m512i two = _mm512_set1_epi32(2);
+
+    const uint32_t simd_batch_512 = (len - 2) / 32;
+
+    for (uint32_t i = 0; i < simd_batch_512; i++) {
+        const __m512i lf_avx512 = _mm512_loadu_si512((__m512i*)(lf_ptr + i * 16 + 1));
+        const __m512i hf1_avx512 = _mm512_slli_epi32(_mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(hf_ptr + i * 16))),
+                                                     shift);
+        const __m512i hf2_avx512 = _mm512_slli_epi32(_mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(hf_ptr + i * 16 + 1))),
+                                                     shift);
+
+        __m512i even = _mm512_add_epi32(hf1_avx512, hf2_avx512);
+        even = _mm512_add_epi32(even, two);
+        even = _mm512_srai_epi32(even, 2);
+        even = _mm512_sub_epi32(lf_avx512, even);
+
+        int32_t next_even = _mm_extract_epi32(_mm512_extracti32x4_epi32(even, 3), 3);
+        __m512i even_m1 = _mm512_alignr_epi32(even, _mm512_set1_epi32(prev_even), 15);
+
+        //out[0] + out[2]
+        __m512i odd = _mm512_add_epi32(even_m1, even);
+        odd = _mm512_srai_epi32(odd, 1);
+        odd = _mm512_add_epi32(odd, hf1_avx512);
+
+        even_m1 = output_linear_clamp_avx512(even_m1, round_avx512, dzeta, max_avx512);
+        odd = output_linear_clamp_avx512(odd, round_avx512, dzeta, max_avx512);
+
+        if (output_16bit) {
+            /*Odd sample in high 16 bits of every 32 bits give 32 output samples in order*/
+            _mm512_storeu_si512((uint16_t*)out + i * 32, _mm512_or_si512(even_m1, _mm512_slli_epi32(odd, 16)));
+        }
+        else {
+            /*Odd sample in second byte of every 32 bits, then narrow to 32 bytes*/
+            const __m512i pairs = _mm512_or_si512(even_m1, _mm512_slli_epi32(odd, 8));
+            _mm256_storeu_si256((__m256i*)((uint8_t*)out + i * 32), _mm512_cvtepi32_epi16(pairs));
+        }
+
+        prev_even = next_even;
+    }
+    idwt_horizontal_line_lf32_hf16_output_end(
+        lf_ptr, hf_ptr, out, len, simd_batch_512 * 32, prev_even, shift, bw, depth, output_16bit);
+}
+
+void idwt_horizontal_line_lf32_hf16_output_8bit_avx512(const int32_t* lf_ptr, const int16_t* hf_ptr, uint8_t* out_ptr,
+                                                       uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth) {
+    idwt_horizontal_line_lf32_hf16_output_avx512(lf_ptr, hf_ptr, out_ptr, len, shift, bw, depth, 0);
+}
+
+void idwt_horizontal_line_lf32_hf16_output_16bit_avx512(const int32_t* lf_ptr, const int16_t* hf_ptr, uint16_t* out_ptr,
+                                                        uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth) {
+    idwt_horizontal_line_lf32_hf16_output_avx512(lf_ptr, hf_ptr, out_ptr, len, shift, bw, depth, 1);
+}
+
+static INLINE void idwt_vertical_line_output_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1,
+                                                    int32_t* out[4], void* out_odd, void* out_even, uint32_t len, uint8_t bw,
+                                                    uint8_t depth, uint8_t output_16bit) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    const int32_t dzeta = bw - depth;
+    const __m512i round_avx512 = _mm512_set1_epi32(((1 << bw) >> 1) + ((1 << dzeta) >> 1));
+    const __m512i max_avx512 = _mm512_set1_epi32((1 << depth) - 1);
+    const __m512i two = _mm512_set1_epi32(2);
+    const uint32_t simd_len = len - (len % 16);
+    int32_t* out_0 = out[0];
+    int32_t* out_2 = out[2];
+
+    uint32_t i = 0;
+    for (; i < simd_len; i += 16) {
+        __m512i lf = _mm512_loadu_si512((__m512i*)(in_lf + i));
+        __m512i hf0 = _mm512_loadu_si512((__m512i*)(in_hf0 + i));
+        __m512i hf1 = _mm512_loadu_si512((__m512i*)(in_hf1 + i));
+
+        //out_2[0] = in_lf[0] - ((in_hf0[0] + in_hf1[0] + 2) >> 2);
+        __m512i out2 = _mm512_add_epi32(hf0, hf1);
+        out2 = _mm512_add_epi32(out2, two);
+        out2 = _mm512_srai_epi32(out2, 2);
+        out2 = _mm512_sub_epi32(lf, out2);
+
+        //out_1[0] = in_hf0[0] + ((out_0[0] + out_2[0]) >> 1);
+        __m512i out0 = _mm512_loadu_si512((__m512i*)(out_0 + i));
+        __m512i out1 = _mm512_add_epi32(out0, out2);
+        out1 = _mm512_srai_epi32(out1, 1);
+        out1 = _mm512_add_epi32(out1, hf0);
+
+        _mm512_storeu_si512((__m512i*)(out_2 + i), out2);
+        out2 = output_linear_clamp_avx512(out2, round_avx512, dzeta, max_avx512);
+        out1 = output_linear_clamp_avx512(out1, round_avx512, dzeta, max_avx512);
+        /*Samples are already clamped to output range, so narrowing truncation is exact*/
+        if (output_16bit) {
+            _mm256_storeu_si256((__m256i*)((uint16_t*)out_even + i), _mm512_cvtepi32_epi16(out2));
+            _mm256_storeu_si256((__m256i*)((uint16_t*)out_odd + i), _mm512_cvtepi32_epi16(out1));
+        }
+        else {
+            _mm_storeu_si128((__m128i*)((uint8_t*)out_even + i), _mm512_cvtepi32_epi8(out2));
+            _mm_storeu_si128((__m128i*)((uint8_t*)out_odd + i), _mm512_cvtepi32_epi8(out1));
+        }
+    }
+    idwt_vertical_line_output_end(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, i, bw, depth, output_16bit);
+}
+
+void idwt_vertical_line_output_8bit_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                           uint8_t* out_odd, uint8_t* out_even, uint32_t len, uint8_t bw, uint8_t depth) {
+    idwt_vertical_line_output_avx512(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, bw, depth, 0);
+}
+
+void idwt_vertical_line_output_16bit_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                            uint16_t* out_odd, uint16_t* out_even, uint32_t len, uint8_t bw, uint8_t depth) {
+    idwt_vertical_line_output_avx512(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, bw, depth, 1);
+}
+
 uint32_t loop_short_lf16_hf16(uint32_t len, const int16_t** lf_ptr, const int16_t** hf_ptr, int32_t** out_ptr, int32_t* prev_even,
                               uint8_t shift) {
     const uint32_t batch = (len - 2) / 8;
@@ -20,10 +20,19 @@ void idwt_horizontal_line_lf16_hf16_avx512(const int16_t* lf_ptr, const int16_t*
                                            uint8_t shift);
 void idwt_horizontal_line_lf32_hf16_avx512(const int32_t* lf_ptr, const int16_t* hf_ptr, int32_t* out_ptr, uint32_t len,
                                            uint8_t shift);
+void idwt_horizontal_line_lf32_hf16_output_8bit_avx512(const int32_t* lf_ptr, const int16_t* hf_ptr, uint8_t* out_ptr,
+                                                       uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth);
+void idwt_horizontal_line_lf32_hf16_output_16bit_avx512(const int32_t* lf_ptr, const int16_t* hf_ptr, uint16_t* out_ptr,
+                                                        uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth);
 
 void idwt_vertical_line_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4], uint32_t len,
                                int32_t first_precinct, int32_t last_precinct, int32_t height);
 
+void idwt_vertical_line_output_8bit_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                           uint8_t* out_odd, uint8_t* out_even, uint32_t len, uint8_t bw, uint8_t depth);
+void idwt_vertical_line_output_16bit_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                            uint16_t* out_odd, uint16_t* out_even, uint32_t len, uint8_t bw, uint8_t depth);
+
 void idwt_vertical_line_recalc_avx512(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
                                       uint32_t len, uint32_t precinct_line_idx);
 
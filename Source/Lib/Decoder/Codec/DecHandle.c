@@ -17,6 +17,11 @@
 #include "SvtLog.h"
 #include "EncDec.h"
 #include "SvtJpegxsImageBufferTools.h"
+#include "SvtUtility.h"
+#include <stddef.h>
+
+/*Parameters added after thread_pool have to fit in padding, so size of configuration does not change with new parameters.*/
+SVT_STATIC_ASSERT(sizeof(svt_jpeg_xs_decoder_api_t) == offsetof(svt_jpeg_xs_decoder_api_t, thread_pool) + 64, decoder_api_size);
 
 PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_single_frame_size(const uint8_t* bitstream_buf, size_t bitstream_buf_size,
                                                                        svt_jpeg_xs_image_config_t* out_image_config,
@@ -37,6 +42,9 @@ PREFIX_API void svt_jpeg_xs_decoder_close(svt_jpeg_xs_decoder_api_t* dec_api) {
     if (dec_api) {
         svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
         if (dec_api_prv) {
+            MemoryArena_t* arena = dec_api_prv->arena;
+            MemoryArena_t* arena_prev = svt_jxs_arena_set_active(arena);
+            MemoryAccount_t* memory_account = dec_api_prv->memory_account;
             svt_jxs_shutdown_process(dec_api_prv->input_buffer_resource_ptr);
             svt_jxs_shutdown_process(dec_api_prv->universal_buffer_resource_ptr);
             svt_jxs_shutdown_process(dec_api_prv->final_buffer_resource_ptr);
@@ -44,6 +52,7 @@ PREFIX_API void svt_jpeg_xs_decoder_close(svt_jpeg_xs_decoder_api_t* dec_api) {
 
             SVT_DESTROY_THREAD(dec_api_prv->input_stage_thread_handle);
             SVT_DESTROY_THREAD_ARRAY(dec_api_prv->universal_stage_thread_handle_array, dec_api_prv->universal_threads_num);
+            SVT_DELETE(dec_api_prv->universal_stage_pool_client);
             SVT_DESTROY_THREAD(dec_api_prv->final_stage_thread_handle);
 
             SVT_DELETE(dec_api_prv->input_buffer_resource_ptr);
@@ -55,12 +64,17 @@ PREFIX_API void svt_jpeg_xs_decoder_close(svt_jpeg_xs_decoder_api_t* dec_api) {
             SVT_DELETE(dec_api_prv->internal_pool_decoder_instance_resource_ptr);
 
             SVT_FREE(dec_api_prv->sync_output_ringbuffer);
-            svt_jxs_free_cond_var(&dec_api_prv->sync_output_ringbuffer_left);
+            if (!dec_api_prv->sync_mode) {
+                svt_jxs_free_cond_var(&dec_api_prv->sync_output_ringbuffer_left);
+            }
 
             for (uint32_t c = 0; c < MAX_COMPONENTS_NUM; c++) {
                 SVT_FREE(dec_api_prv->dec_common.buffer_tmp_cpih[c]);
             }
             SVT_FREE(dec_api->private_ptr);
+            svt_jxs_memory_account_destroy(memory_account);
+            svt_jxs_arena_set_active(arena_prev);
+            svt_jxs_arena_destroy(arena);
         }
         dec_api->private_ptr = NULL;
         svt_jxs_decrease_component_count();
@@ -100,19 +114,22 @@ SvtJxsErrorType_t decoder_allocate_handle(svt_jpeg_xs_decoder_api_t* dec_api) {
     return SvtJxsErrorNone;
 }
 
-PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major, uint64_t version_api_minor,
-                                                      svt_jpeg_xs_decoder_api_t* dec_api, const uint8_t* bitstream_buf,
-                                                      size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config) {
-    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
-        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
-        return SvtJxsErrorInvalidApiVersion;
+/* start_threads is 0 when only memory requirements are measured, then buffers are allocated but threads are not started.
+ * arena and memory_account are owned by instance also on error, svt_jpeg_xs_decoder_close() releases buffers
+ * and destroys them.*/
+static SvtJxsErrorType_t decoder_init_instance(svt_jpeg_xs_decoder_api_t* dec_api, const uint8_t* bitstream_buf,
+                                               size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config,
+                                               MemoryArena_t* arena, MemoryAccount_t* memory_account, uint8_t sync_mode,
+                                               uint8_t start_threads) {
+    SvtJxsErrorType_t ret = decoder_allocate_handle(dec_api);
+    if (dec_api->private_ptr) {
+        ((svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr)->arena = arena;
+        ((svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr)->memory_account = memory_account;
     }
-
-    if (dec_api == NULL || bitstream_buf == NULL || codestream_size == 0) {
-        return SvtJxsErrorDecoderInvalidPointer;
+    else {
+        svt_jxs_arena_destroy(arena);
+        svt_jxs_memory_account_destroy(memory_account);
     }
-
-    SvtJxsErrorType_t ret = decoder_allocate_handle(dec_api);
     if (ret) {
         svt_jpeg_xs_decoder_close(dec_api);
         return ret;
@@ -126,6 +143,20 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
     dec_api_prv->callback_get_data_available = dec_api->callback_get_data_available;
     dec_api_prv->callback_get_data_available_context = dec_api->callback_get_data_available_context;
     dec_api_prv->verbose = dec_api->verbose;
+    dec_api_prv->sync_mode = sync_mode;
+
+    if (dec_api->thread_placement) {
+        dec_api_prv->thread_placement = *dec_api->thread_placement;
+        svt_jxs_thread_placement_resolve(&dec_api_prv->thread_placement);
+        dec_api_prv->thread_placement_ptr = &dec_api_prv->thread_placement;
+    }
+
+    if (dec_api->pipeline_preset >= pipeline_preset_max) {
+        if (dec_api->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Unrecognized pipeline preset\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
 
     dec_api_prv->packetization_mode = dec_api->packetization_mode;
     if (dec_api_prv->packetization_mode != 0 && dec_api_prv->packetization_mode != 1) {
@@ -134,6 +165,20 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
         }
         return SvtJxsErrorBadParameter;
     }
+    if (dec_api_prv->sync_mode && dec_api_prv->packetization_mode) {
+        if (dec_api->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Packetization mode not supported in synchronous decoding\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+
+    if (dec_api->streaming > 1 || (dec_api->streaming && !dec_api_prv->sync_mode)) {
+        if (dec_api->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Streaming supported only in synchronous decoding\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    dec_api_prv->dec_common.streaming = dec_api->streaming;
 
     if (dec_api->proxy_mode >= proxy_mode_max) {
         if (dec_api->verbose >= VERBOSE_ERRORS) {
@@ -142,6 +187,7 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
         return SvtJxsErrorBadParameter;
     }
     dec_api_prv->proxy_mode = dec_api->proxy_mode;
+    dec_api_prv->statistics = dec_api->statistics;
 
     const CPU_FLAGS cpu_flags = get_cpu_flags();
     dec_api->use_cpu_flags &= cpu_flags;
@@ -150,8 +196,8 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
         fprintf(stderr, "[asm level selected : up to %s]\n", get_asm_level_name_str(dec_api->use_cpu_flags));
     }
 
-    setup_common_rtcd_internal(dec_api->use_cpu_flags);
-    setup_decoder_rtcd_internal(dec_api->use_cpu_flags);
+    setup_common_rtcd(&dec_api_prv->dec_common.common_rtcd, dec_api->use_cpu_flags);
+    setup_decoder_rtcd(&dec_api_prv->dec_common.decoder_rtcd, dec_api->use_cpu_flags);
 
     //Init queue
     if (dec_api_prv->verbose >= VERBOSE_SYSTEM_INFO) {
@@ -168,6 +214,7 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
     dec_api_prv->universal_threads_num = 0;
     dec_api_prv->universal_stage_thread_handle_array = NULL;
     dec_api_prv->universal_stage_context_ptr_array = NULL;
+    dec_api_prv->universal_stage_pool_client = NULL;
     dec_api_prv->final_buffer_resource_ptr = NULL;
     dec_api_prv->final_consumer_fifo_ptr = NULL;
     dec_api_prv->final_stage_thread_handle = NULL;
@@ -197,6 +244,14 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
         return SvtJxsErrorBadParameter;
     }
 
+    if (dec_api_prv->dec_common.streaming && dec_api_prv->dec_common.picture_header_const.hdr_Cpih) {
+        if (dec_api->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Streaming not supported with colour transformation\n");
+        }
+        svt_jpeg_xs_decoder_close(dec_api);
+        return SvtJxsErrorBadParameter;
+    }
+
     dec_api_prv->dec_common.max_frame_bitstream_size = 0;
     if (dec_api_prv->packetization_mode) {
         dec_api_prv->dec_common.max_frame_bitstream_size = header_dynamic.hdr_Lcod;
@@ -230,7 +285,16 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
                 color_format_name);
     }
 
-    if (dec_api->threads_num <= 2) {
+    if (dec_api_prv->sync_mode) {
+        /*Frames are decoded on calling thread in svt_jpeg_xs_decode_frame_sync().*/
+        return SvtJxsErrorNone;
+    }
+
+    if (dec_api->thread_pool) {
+        /*Slice tasks are executed by shared pool, one Universal Stage context per pool worker.*/
+        dec_api_prv->universal_threads_num = svt_jxs_thread_pool_get_threads_num(dec_api->thread_pool);
+    }
+    else if (dec_api->threads_num <= 2) {
         dec_api_prv->universal_threads_num = 1;
     }
     else {
@@ -242,8 +306,31 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
     uint32_t input_bitstream_queue_count = 2 * dec_api_prv->universal_threads_num + 10;
     uint32_t pool_decoders_instances_count =
         3; //Allocate decoder instances, One instance to prepare init, one to calculate and one to finish
-    dec_api_prv->sync_output_ringbuffer_size = dec_api_prv->universal_threads_num +
-        20; //Should be more that pool_decoders_instances_count to not reduce performance
+    if (dec_api->pipeline_preset == pipeline_preset_min_latency) {
+        output_bitsteram_queue_count = 1;
+        input_bitstream_queue_count = 1;
+        pool_decoders_instances_count = 1;
+    }
+    else if (dec_api->pipeline_preset == pipeline_preset_max_throughput) {
+        output_bitsteram_queue_count = 4 * dec_api_prv->universal_threads_num + 20;
+        input_bitstream_queue_count = 4 * dec_api_prv->universal_threads_num + 20;
+        pool_decoders_instances_count = 6;
+    }
+    if (dec_api->input_queue_size) {
+        input_bitstream_queue_count = dec_api->input_queue_size;
+    }
+    if (dec_api->output_queue_size) {
+        output_bitsteram_queue_count = dec_api->output_queue_size;
+    }
+    if (dec_api->frame_pool_size) {
+        pool_decoders_instances_count = dec_api->frame_pool_size;
+    }
+    //Should be more that pool_decoders_instances_count to not reduce performance
+    dec_api_prv->sync_output_ringbuffer_size = dec_api_prv->universal_threads_num + 20;
+    if (dec_api->pipeline_preset == pipeline_preset_min_latency) {
+        /*Limit number of frames in flight to number of decoder instances*/
+        dec_api_prv->sync_output_ringbuffer_size = pool_decoders_instances_count;
+    }
 
     if (dec_api_prv->verbose >= VERBOSE_SYSTEM_INFO_ALL) {
         fprintf(stderr, "-------------------------------------------\n");
@@ -330,17 +417,34 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
     dec_api_prv->internal_pool_decoder_instance_fifo_ptr = svt_jxs_system_resource_get_producer_fifo(
         dec_api_prv->internal_pool_decoder_instance_resource_ptr, 0);
 
+    if (!start_threads) {
+        return SvtJxsErrorNone;
+    }
+
     if (!dec_api_prv->packetization_mode) {
         /*Start threads*/
-        SVT_CREATE_THREAD(dec_api_prv->input_stage_thread_handle, thread_init_stage_kernel, dec_api_prv);
+        SVT_CREATE_THREAD_PLACED(
+            dec_api_prv->input_stage_thread_handle, thread_init_stage_kernel, dec_api_prv, dec_api_prv->thread_placement_ptr, 0);
     }
 
-    SVT_CREATE_THREAD_ARRAY(dec_api_prv->universal_stage_thread_handle_array,
-                            dec_api_prv->universal_threads_num,
-                            thread_universal_stage_kernel,
-                            dec_api_prv->universal_stage_context_ptr_array);
+    if (dec_api->thread_pool) {
+        SVT_NEW(dec_api_prv->universal_stage_pool_client,
+                svt_jxs_thread_pool_client_ctor,
+                dec_api->thread_pool,
+                universal_stage_pool_task,
+                (void**)dec_api_prv->universal_stage_context_ptr_array);
+    }
+    else {
+        SVT_CREATE_THREAD_ARRAY_PLACED(dec_api_prv->universal_stage_thread_handle_array,
+                                       dec_api_prv->universal_threads_num,
+                                       thread_universal_stage_kernel,
+                                       dec_api_prv->universal_stage_context_ptr_array,
+                                       dec_api_prv->thread_placement_ptr,
+                                       1);
+    }
 
-    SVT_CREATE_THREAD(dec_api_prv->final_stage_thread_handle, thread_final_stage_kernel, dec_api_prv);
+    SVT_CREATE_THREAD_PLACED(
+        dec_api_prv->final_stage_thread_handle, thread_final_stage_kernel, dec_api_prv, dec_api_prv->thread_placement_ptr, 0);
 
     if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
         fprintf(stderr, "[%s] End\n", __FUNCTION__);
@@ -355,22 +459,111 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major
     return SvtJxsErrorNone;
 }
 
-PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_frame(svt_jpeg_xs_decoder_api_t* dec_api, svt_jpeg_xs_frame_t* dec_input,
-                                                            uint8_t blocking_flag) {
-    if (dec_api == NULL || dec_api->private_ptr == NULL || dec_input == NULL) {
+/* All buffers are allocated in calling thread, so arena is active only here and in svt_jpeg_xs_decoder_close(),
+ * account is active here and in svt_jpeg_xs_decoder_sync_ctx_create().*/
+static SvtJxsErrorType_t decoder_init_with_arena(svt_jpeg_xs_decoder_api_t* dec_api, const uint8_t* bitstream_buf,
+                                                 size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config,
+                                                 uint8_t sync_mode, uint8_t start_threads) {
+    MemoryArena_t* arena = svt_jxs_arena_create(dec_api->memory_flags);
+    MemoryAccount_t* memory_account = svt_jxs_memory_account_create();
+    if (memory_account == NULL) {
+        svt_jxs_arena_destroy(arena);
+        dec_api->private_ptr = NULL;
+        return SvtJxsErrorInsufficientResources;
+    }
+    MemoryArena_t* arena_prev = svt_jxs_arena_set_active(arena);
+    MemoryAccount_t* memory_account_prev = svt_jxs_memory_account_set_active(memory_account);
+    SvtJxsErrorType_t ret = decoder_init_instance(
+        dec_api, bitstream_buf, codestream_size, out_image_config, arena, memory_account, sync_mode, start_threads);
+    svt_jxs_memory_account_set_active(memory_account_prev);
+    svt_jxs_arena_set_active(arena_prev);
+    return ret;
+}
+
+/*Regions mapped by arena and heap buffers live now, contexts of synchronous decoding included.*/
+static uint64_t decoder_memory_usage(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv) {
+    const uint64_t mapped_bytes = dec_api_prv->arena ? svt_jxs_arena_get_mapped_bytes(dec_api_prv->arena) : 0;
+    return mapped_bytes + svt_jxs_memory_account_get_live_bytes(dec_api_prv->memory_account);
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_init(uint64_t version_api_major, uint64_t version_api_minor,
+                                                      svt_jpeg_xs_decoder_api_t* dec_api, const uint8_t* bitstream_buf,
+                                                      size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config) {
+    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
+        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
+        return SvtJxsErrorInvalidApiVersion;
+    }
+
+    if (dec_api == NULL || bitstream_buf == NULL || codestream_size == 0) {
         return SvtJxsErrorDecoderInvalidPointer;
     }
 
-    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
+    /*Buffers allocated and first touched in initialization are placed on selected NUMA node.*/
+    const int32_t numa_node = dec_api->thread_placement ? dec_api->thread_placement->numa_node : -1;
+    NumaPolicy_t numa_policy;
+    if (numa_node >= 0) {
+        svt_jxs_numa_prefer_node(numa_node, &numa_policy);
+    }
+    SvtJxsErrorType_t ret = decoder_init_with_arena(dec_api, bitstream_buf, codestream_size, out_image_config, 0, 1);
+    if (numa_node >= 0) {
+        svt_jxs_numa_restore(&numa_policy);
+    }
+    return ret;
+}
 
-    if (dec_api_prv->packetization_mode) {
-        if (dec_api->verbose >= VERBOSE_ERRORS) {
-            fprintf(stderr, "\nDecoder initialized for packet-based input, but svt_jpeg_xs_decoder_send_frame() is called\n");
-            fprintf(stderr, "Please use svt_jpeg_xs_decoder_send_packet() instead\n");
-        }
-        return SvtJxsErrorUndefined;
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_sync_init(uint64_t version_api_major, uint64_t version_api_minor,
+                                                           svt_jpeg_xs_decoder_api_t* dec_api, const uint8_t* bitstream_buf,
+                                                           size_t codestream_size, svt_jpeg_xs_image_config_t* out_image_config) {
+    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
+        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
+        return SvtJxsErrorInvalidApiVersion;
+    }
+
+    if (dec_api == NULL || bitstream_buf == NULL || codestream_size == 0) {
+        return SvtJxsErrorDecoderInvalidPointer;
+    }
+    SvtJxsErrorType_t ret = decoder_init_with_arena(dec_api, bitstream_buf, codestream_size, out_image_config, 1, 1);
+    return ret;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_memory_requirements(uint64_t version_api_major, uint64_t version_api_minor,
+                                                                         svt_jpeg_xs_decoder_api_t* dec_api,
+                                                                         const uint8_t* bitstream_buf, size_t codestream_size,
+                                                                         uint64_t* out_bytes) {
+    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
+        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
+        return SvtJxsErrorInvalidApiVersion;
     }
 
+    if (dec_api == NULL || bitstream_buf == NULL || codestream_size == 0 || out_bytes == NULL) {
+        return SvtJxsErrorDecoderInvalidPointer;
+    }
+
+    /*Allocate all buffers of configuration on copy of handle, without starting threads, and release them.
+     *Arena of memory_flags is created too, so value is the same as svt_jpeg_xs_decoder_get_memory_usage() after init.*/
+    svt_jpeg_xs_decoder_api_t dec_api_query = *dec_api;
+    if (dec_api_query.verbose > VERBOSE_ERRORS) {
+        dec_api_query.verbose = VERBOSE_ERRORS;
+    }
+    svt_jpeg_xs_image_config_t image_config;
+    SvtJxsErrorType_t ret = decoder_init_with_arena(&dec_api_query, bitstream_buf, codestream_size, &image_config, 0, 0);
+    *out_bytes = 0;
+    if (dec_api_query.private_ptr) {
+        *out_bytes = decoder_memory_usage((svt_jpeg_xs_decoder_api_prv_t*)dec_api_query.private_ptr);
+    }
+    svt_jpeg_xs_decoder_close(&dec_api_query);
+    return ret;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_memory_usage(svt_jpeg_xs_decoder_api_t* dec_api, uint64_t* out_bytes) {
+    if (dec_api == NULL || dec_api->private_ptr == NULL || out_bytes == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+    *out_bytes = decoder_memory_usage((svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr);
+    return SvtJxsErrorNone;
+}
+
+SvtJxsErrorType_t decoder_check_output_image(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, const svt_jpeg_xs_image_buffer_t* image) {
     pi_t* pi = &dec_api_prv->dec_common.pi;
     uint8_t input_bit_depth = dec_api_prv->dec_common.picture_header_const.hdr_bit_depth[0];
     uint32_t pixel_size = input_bit_depth <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
@@ -384,15 +577,52 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_frame(svt_jpeg_xs_decoder_
         // into every second row. The last row of the second field which is the last row of the
         // output image would only have a single row of data left in it then though (at most half
         // the specified rowstride in that case).
-        min_size = dec_input->image.stride[c] * pixel_size * (pi->components[c].height - 1);
+        min_size = image->stride[c] * pixel_size * (pi->components[c].height - 1);
         min_size += pi->components[c].width * pixel_size;
-        if (dec_input->image.alloc_size[c] < min_size) {
+        if (image->alloc_size[c] < min_size) {
             return SvtJxsErrorBadParameter;
         }
     }
+    return SvtJxsErrorNone;
+}
+
+/*Frame, packet and EOC functions use queues and threads that are not created in synchronous mode.*/
+static SvtJxsErrorType_t decoder_check_not_sync_mode(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv) {
+    if (dec_api_prv->sync_mode) {
+        if (dec_api_prv->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "\nDecoder initialized for synchronous decoding, please use svt_jpeg_xs_decode_frame_sync()\n");
+        }
+        return SvtJxsErrorUndefined;
+    }
+    return SvtJxsErrorNone;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_frame(svt_jpeg_xs_decoder_api_t* dec_api, svt_jpeg_xs_frame_t* dec_input,
+                                                            uint8_t blocking_flag) {
+    if (dec_api == NULL || dec_api->private_ptr == NULL || dec_input == NULL) {
+        return SvtJxsErrorDecoderInvalidPointer;
+    }
+
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
+    SvtJxsErrorType_t ret = decoder_check_not_sync_mode(dec_api_prv);
+    if (ret) {
+        return ret;
+    }
+
+    if (dec_api_prv->packetization_mode) {
+        if (dec_api->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "\nDecoder initialized for packet-based input, but svt_jpeg_xs_decoder_send_frame() is called\n");
+            fprintf(stderr, "Please use svt_jpeg_xs_decoder_send_packet() instead\n");
+        }
+        return SvtJxsErrorUndefined;
+    }
+
+    ret = decoder_check_output_image(dec_api_prv, &dec_input->image);
+    if (ret) {
+        return ret;
+    }
 
     ObjectWrapper_t* input_wrapper_ptr;
-    SvtJxsErrorType_t ret = SvtJxsErrorNone;
     if (blocking_flag) {
         ret = svt_jxs_get_empty_object(dec_api_prv->input_producer_fifo_ptr, &input_wrapper_ptr);
     }
@@ -408,6 +638,7 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_frame(svt_jpeg_xs_decoder_
         TaskInputBitstream* buffer_input = (TaskInputBitstream*)input_wrapper_ptr->object_ptr;
         buffer_input->dec_input = *dec_input; /*Copy output buffer structure.*/
         buffer_input->flags = 0;
+        decoder_statistics_send(dec_api_prv, &buffer_input->dec_input);
         svt_jxs_post_full_object(input_wrapper_ptr);
         return SvtJxsErrorNone;
     }
@@ -420,6 +651,10 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_packet(svt_jpeg_xs_decoder
         return SvtJxsErrorDecoderInvalidPointer;
     }
     svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
+    SvtJxsErrorType_t ret = decoder_check_not_sync_mode(dec_api_prv);
+    if (ret) {
+        return ret;
+    }
     return internal_svt_jpeg_xs_decoder_send_packet(dec_api_prv, dec_input, bytes_used);
 }
 
@@ -430,6 +665,10 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_frame(svt_jpeg_xs_decoder_a
     }
 
     svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
+    SvtJxsErrorType_t ret = decoder_check_not_sync_mode(dec_api_prv);
+    if (ret) {
+        return ret;
+    }
     ObjectWrapper_t* wrapper_ptr = NULL;
     if (blocking_flag) {
         svt_jxs_get_full_object(dec_api_prv->output_consumer_fifo_ptr, &wrapper_ptr);
@@ -443,6 +682,9 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_get_frame(svt_jpeg_xs_decoder_a
 
         *dec_output = input_buffer_ptr->dec_input; //Copy structure
         SvtJxsErrorType_t frame_error = input_buffer_ptr->frame_error;
+        if (dec_output->stats) {
+            dec_output->stats->output_ns = get_current_time_ns();
+        }
 
         //Release buffer back:
         svt_jxs_release_object(wrapper_ptr);
@@ -460,12 +702,15 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_eoc(svt_jpeg_xs_decoder_ap
     }
 
     svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
+    SvtJxsErrorType_t ret = decoder_check_not_sync_mode(dec_api_prv);
+    if (ret) {
+        return ret;
+    }
 
     if (dec_api_prv->packetization_mode) {
         ObjectWrapper_t* wrapper_ptr_decoder_ctx = NULL;
 
-        SvtJxsErrorType_t ret = svt_jxs_get_empty_object(dec_api_prv->internal_pool_decoder_instance_fifo_ptr,
-                                                         &wrapper_ptr_decoder_ctx);
+        ret = svt_jxs_get_empty_object(dec_api_prv->internal_pool_decoder_instance_fifo_ptr, &wrapper_ptr_decoder_ctx);
 
         if (ret != SvtJxsErrorNone || wrapper_ptr_decoder_ctx == NULL) {
             return ret;
@@ -475,6 +720,7 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_eoc(svt_jpeg_xs_decoder_ap
 
         dec_ctx->frame_num = dec_api_prv->slice_scheduler_ctx.frame_num;
         dec_ctx->sync_output_frame_idx = dec_api_prv->slice_scheduler_ctx.sync_output_frame_idx;
+        dec_ctx->dec_input.stats = NULL;
 
         dec_api_prv->slice_scheduler_ctx.sync_output_frame_idx = (dec_api_prv->slice_scheduler_ctx.sync_output_frame_idx + 1) %
             dec_api_prv->sync_output_ringbuffer_size;
@@ -501,7 +747,7 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_send_eoc(svt_jpeg_xs_decoder_ap
     }
     else {
         ObjectWrapper_t* input_wrapper_ptr = NULL;
-        SvtJxsErrorType_t ret = svt_jxs_get_empty_object(dec_api_prv->input_producer_fifo_ptr, &input_wrapper_ptr);
+        ret = svt_jxs_get_empty_object(dec_api_prv->input_producer_fifo_ptr, &input_wrapper_ptr);
         if (ret != SvtJxsErrorNone || input_wrapper_ptr == NULL) {
             return ret;
         }
@@ -11,6 +11,8 @@
 #include "Decoder.h"
 #include "DecThreads.h"
 #include "Threads/SystemResourceManager.h"
+#include "Threads/SvtThreadPool.h"
+#include "Threads/SvtArena.h"
 #include "SvtJpegxsImageBufferTools.h"
 #include "SvtJpegxsDec.h"
 
@@ -56,6 +58,8 @@ typedef struct svt_jpeg_xs_decoder_api_prv {
     uint32_t verbose;
     uint8_t packetization_mode;
     proxy_mode_t proxy_mode;
+    uint8_t sync_mode; /*Initialized by svt_jpeg_xs_decoder_sync_init(), no threads and queues are created*/
+    uint8_t statistics; /*Fill svt_jpeg_xs_frame_t::stats of every frame*/
 
     svt_jpeg_xs_decoder_common_t dec_common; /*Common decoder*/
 
@@ -80,6 +84,12 @@ typedef struct svt_jpeg_xs_decoder_api_prv {
     Fifo_t* input_producer_fifo_ptr;
     Fifo_t* input_consumer_fifo_ptr;
 
+    /*
+     * Placement of threads, thread_placement_ptr is NULL when placement is not set
+     */
+    svt_jpeg_xs_thread_placement_t thread_placement;
+    const svt_jpeg_xs_thread_placement_t* thread_placement_ptr;
+
     /*
      * Thread thread_init_stage_kernel()
      */
@@ -100,6 +110,7 @@ typedef struct svt_jpeg_xs_decoder_api_prv {
     uint32_t universal_threads_num;                      //Number of threads
     Handle_t* universal_stage_thread_handle_array;       //Threads
     ThreadContext_t** universal_stage_context_ptr_array; //Contexts for threads UniversalThreadContext
+    ThreadPoolClient_t* universal_stage_pool_client;     //Used instead of threads when shared thread pool is set
 
     /*
      * Buffers between thread_universal_stage_kernel() and thread_final_stage_kernel()
@@ -137,12 +148,24 @@ typedef struct svt_jpeg_xs_decoder_api_prv {
     * Holds the required data to properly schedule subsequent slices for processing
     */
     svt_jpeg_xs_slice_scheduler_ctx_t slice_scheduler_ctx;
+
+    /*
+     * Account of heap buffers allocated by instance, contexts of synchronous decoding included
+     */
+    MemoryAccount_t *memory_account;
+    /*
+     * Arena of all buffers when memory_flags are set, released after buffers on close
+     */
+    MemoryArena_t *arena;
 } svt_jpeg_xs_decoder_api_prv_t;
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*Validate that output image buffer is big enough for decoded frame.*/
+SvtJxsErrorType_t decoder_check_output_image(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, const svt_jpeg_xs_image_buffer_t* image);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,170 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "DecHandle.h"
+#include "DecThreadInit.h"
+#include "Decoder.h"
+#include "common_dsp_rtcd.h"
+#include "decoder_dsp_rtcd.h"
+
+/*Context of one caller of svt_jpeg_xs_decode_frame_sync(), keeps all buffers used to decode frame.*/
+struct svt_jpeg_xs_decoder_sync_ctx {
+    DctorCall dctor;
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv;
+    svt_jpeg_xs_decoder_instance_t* dec_ctx;
+    svt_jpeg_xs_decoder_thread_context* dec_thread_context;
+    // Own temporary buffer when hdr_Cpih is enabled, buffer of dec_common can not be shared between callers
+    int32_t* buffer_tmp_cpih[MAX_COMPONENTS_NUM];
+    uint64_t frame_num;
+};
+
+static void decoder_sync_ctx_dctor(void_ptr p) {
+    struct svt_jpeg_xs_decoder_sync_ctx* obj = (struct svt_jpeg_xs_decoder_sync_ctx*)p;
+    if (obj->dec_thread_context) {
+        svt_jpeg_xs_dec_thread_context_free(obj->dec_thread_context, &obj->dec_api_prv->dec_common.pi);
+    }
+    svt_jpeg_xs_dec_instance_free(obj->dec_ctx);
+    for (uint32_t c = 0; c < MAX_COMPONENTS_NUM; c++) {
+        SVT_FREE(obj->buffer_tmp_cpih[c]);
+    }
+}
+
+static SvtJxsErrorType_t decoder_sync_ctx_ctor(struct svt_jpeg_xs_decoder_sync_ctx* obj,
+                                               svt_jpeg_xs_decoder_api_prv_t* dec_api_prv) {
+    svt_jpeg_xs_decoder_common_t* dec_common = &dec_api_prv->dec_common;
+    obj->dctor = decoder_sync_ctx_dctor;
+    obj->dec_api_prv = dec_api_prv;
+
+    obj->dec_ctx = svt_jpeg_xs_dec_instance_alloc(dec_common);
+    if (obj->dec_ctx == NULL) {
+        return SvtJxsErrorInsufficientResources;
+    }
+    obj->dec_thread_context = svt_jpeg_xs_dec_thread_context_alloc(&dec_common->pi);
+    if (obj->dec_thread_context == NULL) {
+        return SvtJxsErrorInsufficientResources;
+    }
+    if (dec_common->picture_header_const.hdr_Cpih) {
+        for (uint32_t c = 0; c < dec_common->pi.comps_num; c++) {
+            SVT_MALLOC(obj->buffer_tmp_cpih[c], dec_common->pi.width * dec_common->pi.height * sizeof(int32_t));
+            obj->dec_ctx->buffer_tmp_cpih[c] = obj->buffer_tmp_cpih[c];
+        }
+    }
+    return SvtJxsErrorNone;
+}
+
+/*Decode all slices of frame in order, then IDWT between slices like Thread Final do for single slice thread.*/
+static SvtJxsErrorType_t decoder_sync_decode_frame(struct svt_jpeg_xs_decoder_sync_ctx* sync_ctx, svt_jpeg_xs_frame_t* frame) {
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = sync_ctx->dec_api_prv;
+    svt_jpeg_xs_decoder_instance_t* dec_ctx = sync_ctx->dec_ctx;
+    pi_t* pi = &dec_api_prv->dec_common.pi;
+    const uint8_t* bitstream_buf = frame->bitstream.buffer;
+    const uint32_t bitstream_buf_size = frame->bitstream.used_size;
+    const svt_jpeg_xs_stream_t* stream = dec_api_prv->dec_common.streaming ? frame->stream : NULL;
+
+    dec_ctx->frame_num = sync_ctx->frame_num++;
+    dec_ctx->dec_input = *frame;
+    dec_ctx->sync_num_slices_to_receive = pi->slice_num;
+    dec_ctx->sync_slices_idwt = 0;
+    if (stream) {
+        svt_jpeg_xs_decode_stream_begin(dec_ctx);
+    }
+
+    uint32_t offset = 0;
+    SvtJxsErrorType_t ret = svt_jpeg_xs_decode_header(dec_ctx, bitstream_buf, bitstream_buf_size, &offset, dec_api_prv->verbose);
+    for (uint32_t slice = 0; (ret == SvtJxsErrorNone) && (slice < pi->slice_num); slice++) {
+        uint32_t slice_size = 0;
+        ret = get_slice_size(pi, bitstream_buf + offset, bitstream_buf_size - offset, slice, &slice_size);
+        if (ret) {
+            break;
+        }
+        if (slice + 1 == pi->slice_num) {
+            ret = check_end_of_codestream(dec_api_prv, dec_ctx, bitstream_buf, bitstream_buf_size, offset + slice_size);
+            if (ret) {
+                break;
+            }
+        }
+
+        uint32_t out_slice_size;
+        ret = svt_jpeg_xs_decode_slice(dec_ctx,
+                                       sync_ctx->dec_thread_context,
+                                       bitstream_buf + offset,
+                                       bitstream_buf_size - offset,
+                                       slice,
+                                       &out_slice_size,
+                                       &frame->image,
+                                       dec_api_prv->verbose);
+        if (ret == SvtJxsErrorNone) {
+            ret = svt_jpeg_xs_decode_final_slice_overlap(dec_ctx, &frame->image, slice);
+        }
+        if (ret == SvtJxsErrorNone && stream) {
+            /*Lines of slice are finished, send them before precincts and lines are reused by next slice.*/
+            ret = svt_jpeg_xs_decode_stream_lines(dec_ctx, stream);
+        }
+        offset += slice_size;
+    }
+
+    if ((ret == SvtJxsErrorNone) && dec_api_prv->dec_common.picture_header_const.hdr_Cpih) {
+        ret = svt_jpeg_xs_decode_final(dec_ctx, &frame->image);
+    }
+    frame->bitstream.ready_to_release = 1;
+    frame->image.ready_to_release = 1;
+    return ret;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decoder_sync_ctx_create(svt_jpeg_xs_decoder_api_t* dec_api,
+                                                                 svt_jpeg_xs_decoder_sync_ctx_t** sync_ctx) {
+    if (dec_api == NULL || dec_api->private_ptr == NULL || sync_ctx == NULL) {
+        return SvtJxsErrorDecoderInvalidPointer;
+    }
+    *sync_ctx = NULL;
+
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)dec_api->private_ptr;
+    if (!dec_api_prv->sync_mode) {
+        if (dec_api_prv->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Decoder is not initialized by svt_jpeg_xs_decoder_sync_init()\n");
+        }
+        return SvtJxsErrorDecoderInvalidPointer;
+    }
+
+    /*Buffers of context are heap buffers of decoder, also with arena, which is used only in initialization.*/
+    struct svt_jpeg_xs_decoder_sync_ctx* ctx_ptr = NULL;
+    MemoryAccount_t* memory_account_prev = svt_jxs_memory_account_set_active(dec_api_prv->memory_account);
+    SVT_NO_THROW_NEW(ctx_ptr, decoder_sync_ctx_ctor, dec_api_prv);
+    svt_jxs_memory_account_set_active(memory_account_prev);
+    if (ctx_ptr == NULL) {
+        return SvtJxsErrorInsufficientResources;
+    }
+    *sync_ctx = ctx_ptr;
+    return SvtJxsErrorNone;
+}
+
+PREFIX_API void svt_jpeg_xs_decoder_sync_ctx_destroy(svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx) {
+    SVT_DELETE(sync_ctx);
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_decode_frame_sync(svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx, svt_jpeg_xs_frame_t* frame) {
+    if (sync_ctx == NULL || frame == NULL || frame->bitstream.buffer == NULL) {
+        return SvtJxsErrorDecoderInvalidPointer;
+    }
+
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = sync_ctx->dec_api_prv;
+    if (dec_api_prv->dec_common.streaming) {
+        /*Image buffer is not used, decoded lines are written by stream callback.*/
+        if (frame->stream == NULL || frame->stream->write_lines == NULL) {
+            return SvtJxsErrorDecoderInvalidPointer;
+        }
+    }
+    else {
+        SvtJxsErrorType_t ret = decoder_check_output_image(dec_api_prv, &frame->image);
+        if (ret) {
+            return ret;
+        }
+    }
+
+    /*Caller thread can run other decoders or encoders, so bind dispatch table of this decoder for every frame.*/
+    bind_common_rtcd(&dec_api_prv->dec_common.common_rtcd);
+    bind_decoder_rtcd(&dec_api_prv->dec_common.decoder_rtcd);
+    return decoder_sync_decode_frame(sync_ctx, frame);
+}
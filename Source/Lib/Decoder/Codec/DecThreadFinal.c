@@ -7,6 +7,8 @@
 #include "DecThreadFinal.h"
 #include "Threads/SvtThreads.h"
 #include "DecHandle.h"
+#include "SvtUtility.h"
+#include "SvtTrace.h"
 
 SvtJxsErrorType_t final_sync_creator(void_ptr* object_dbl_ptr, void_ptr object_init_data_ptr) {
     UNUSED(object_init_data_ptr);
@@ -24,12 +26,31 @@ void final_sync_destroyer(void_ptr p) {
     SVT_FREE(obj);
 }
 
+/*Statistics: collect slice, first slice of frame initialize range of slices time.*/
+static void final_statistics_slice(OutItem* item, const TaskFinalSync* input_buffer_ptr) {
+    svt_jpeg_xs_frame_stats_t* stats = item->dec_input.stats;
+    const svt_jpeg_xs_slice_stats_t* slice_stats = &input_buffer_ptr->slice_stats;
+    if (item->received_slices == 1) {
+        stats->slices_begin_ns = slice_stats->begin_ns;
+        stats->slices_end_ns = slice_stats->end_ns;
+    }
+    else {
+        stats->slices_begin_ns = MIN(stats->slices_begin_ns, slice_stats->begin_ns);
+        stats->slices_end_ns = MAX(stats->slices_end_ns, slice_stats->end_ns);
+    }
+    if (stats->slices && input_buffer_ptr->slice_id < stats->slices_size) {
+        stats->slices[input_buffer_ptr->slice_id] = *slice_stats;
+    }
+}
+
 void* thread_final_stage_kernel(void* input_ptr) {
     ThreadContext_t* thread_ctx = (ThreadContext_t*)input_ptr;
     svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)thread_ctx;
     OutItem* sync_output_ringbuffer = dec_api_prv->sync_output_ringbuffer;
     uint32_t sync_output_ringbuffer_size = dec_api_prv->sync_output_ringbuffer_size;
     CondVar* sync_output_ringbuffer_left = &dec_api_prv->sync_output_ringbuffer_left;
+    bind_common_rtcd(&dec_api_prv->dec_common.common_rtcd);
+    bind_decoder_rtcd(&dec_api_prv->dec_common.decoder_rtcd);
 
     /*Callback frame is ready to get.*/
     svt_jpeg_xs_decoder_api_t* callback_decoder_ctx = dec_api_prv->callback_decoder_ctx;
@@ -52,6 +73,7 @@ void* thread_final_stage_kernel(void* input_ptr) {
         picture_header_const_t* picture_header_const = &dec_api_prv->dec_common.picture_header_const;
 
         OutItem* item = &sync_output_ringbuffer[dec_ctx->sync_output_frame_idx];
+        SVT_TRACE_BEGIN("dec_final", dec_ctx->frame_num, input_buffer_ptr->slice_id);
 
         //If Slice thread exited with error, release thread that is waiting for it to be done
         if (!dec_ctx->sync_slices_idwt) {
@@ -90,6 +112,10 @@ void* thread_final_stage_kernel(void* input_ptr) {
             }
         }
 
+        if (item->dec_input.stats) {
+            final_statistics_slice(item, input_buffer_ptr);
+        }
+
         if (!dec_ctx->sync_slices_idwt) {
             /*IDWT between slices. Only when universal thread not calculate fully IDWT*/
             if (item->frame_error == 0) {
@@ -120,6 +146,9 @@ void* thread_final_stage_kernel(void* input_ptr) {
                 Release output buffer when error
                 item->image_buffer = NULL;
             }*/
+            if (item->dec_input.stats) {
+                item->dec_input.stats->final_ready_ns = get_current_time_ns();
+            }
             //Release Decoder Context
             svt_jxs_release_object(wrapper_ptr_decoder_ctx);
 
@@ -128,6 +157,7 @@ void* thread_final_stage_kernel(void* input_ptr) {
             }
         }
 
+        SVT_TRACE_END("dec_final", item->frame_num, input_buffer_ptr->slice_id);
         //Release actual input task
         svt_jxs_release_object(input_wrapper_ptr);
 
@@ -149,6 +179,9 @@ void* thread_final_stage_kernel(void* input_ptr) {
             buffer_output->dec_input.bitstream.ready_to_release = 1;
             buffer_output->dec_input.image.ready_to_release = 1;
             buffer_output->frame_error = item->frame_error;
+            if (buffer_output->dec_input.stats) {
+                buffer_output->dec_input.stats->final_send_ns = get_current_time_ns();
+            }
 
             if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
                 fprintf(stderr, "[%s] Send frame  %i Final thread\n", __FUNCTION__, (int)item->frame_num);
@@ -14,6 +14,7 @@ typedef struct {
     ObjectWrapper_t* wrapper_ptr_decoder_ctx;
     uint32_t slice_id;
     int32_t frame_error;
+    svt_jpeg_xs_slice_stats_t slice_stats; /*Valid when frame collect statistics*/
 } TaskFinalSync;
 
 void* thread_final_stage_kernel(void* input_ptr);
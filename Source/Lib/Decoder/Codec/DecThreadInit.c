@@ -7,6 +7,7 @@
 #include "DecThreadInit.h"
 #include "DecThreadSlice.h"
 #include "SvtUtility.h"
+#include "SvtTrace.h"
 #include "Codestream.h"
 #include "SvtJpegxsImageBufferTools.h"
 
@@ -26,14 +27,50 @@ void input_bitstream_destroyer(void_ptr p) {
     SVT_FREE(obj);
 }
 
+void decoder_statistics_send(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, svt_jpeg_xs_frame_t* frame) {
+    if (!dec_api_prv->statistics) {
+        frame->stats = NULL;
+    }
+    else if (frame->stats) {
+        memset(frame->stats, 0, offsetof(svt_jpeg_xs_frame_stats_t, slices));
+        frame->stats->send_ns = get_current_time_ns();
+    }
+}
+
+/*Statistics: header is parsed, all next writes to frame statistics are done by Final Thread.*/
+static void decoder_statistics_init_end(svt_jpeg_xs_decoder_instance_t* dec_ctx) {
+    svt_jpeg_xs_frame_stats_t* stats = dec_ctx->dec_input.stats;
+    if (stats) {
+        stats->slices_num = dec_ctx->dec_common->pi.slice_num;
+        stats->init_end_ns = get_current_time_ns();
+    }
+}
+
+/*Send task to thread_universal_stage_kernel() or to shared thread pool.*/
+static void post_universal_task(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, ObjectWrapper_t* universal_wrapper_ptr) {
+    svt_jxs_post_full_object(universal_wrapper_ptr);
+    if (dec_api_prv->universal_stage_pool_client) {
+        svt_jxs_thread_pool_submit(dec_api_prv->universal_stage_pool_client);
+    }
+}
+
+/*Slice threads synchronize IDWT of overlapped lines between slices, otherwise Thread Final recalculate it.
+ *Slice task waits there for next slice, that is not safe in shared thread pool where next slice can wait
+ *for free worker.*/
+static uint8_t use_sync_slices_idwt(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, svt_jpeg_xs_decoder_instance_t* dec_ctx) {
+    pi_t* pi = &dec_ctx->dec_common->pi;
+    return (pi->decom_v != 0) && (dec_api_prv->universal_threads_num > 1) && (dec_api_prv->universal_stage_pool_client == NULL) &&
+        (pi->precincts_per_slice > 2) && (dec_ctx->dec_common->picture_header_const.hdr_Cpih == 0);
+}
+
 static uint16_t get_16_bits(const uint8_t* buf) {
     uint16_t ret_val = (uint16_t)buf[0] << 8;
     return ret_val | buf[1];
 }
 
 //TODO: handle frame_size and error code
-static int32_t get_slice_size(pi_t* pi, const uint8_t* bitstream_buf, size_t bitstream_buf_size, uint32_t slice,
-                              uint32_t* out_slice_size) {
+int32_t get_slice_size(pi_t* pi, const uint8_t* bitstream_buf, size_t bitstream_buf_size, uint32_t slice,
+                       uint32_t* out_slice_size) {
     uint32_t offset_bytes = 0;
     uint32_t header_size = 0;
     uint16_t marker = 0;
@@ -130,6 +167,28 @@ static int32_t get_slice_size(pi_t* pi, const uint8_t* bitstream_buf, size_t bit
     return SvtJxsErrorDecoderInvalidBitstream;
 }
 
+/*Check End Of Codestream marker after last slice, offset is the end of last slice.*/
+int32_t check_end_of_codestream(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, svt_jpeg_xs_decoder_instance_t* dec_ctx,
+                                const uint8_t* bitstream_buf, size_t bitstream_buf_size, uint32_t offset) {
+    if (offset + 1 >= bitstream_buf_size) {
+        return SvtJxsErrorDecoderBitstreamTooShort;
+    }
+    if (get_16_bits(bitstream_buf + offset) != CODESTREAM_EOC) {
+        return SvtJxsErrorDecoderInvalidBitstream;
+    }
+    uint32_t frame_bitstream_size = offset + 2;
+    if (dec_ctx->picture_header_dynamic.hdr_Lcod != 0 && dec_ctx->picture_header_dynamic.hdr_Lcod != frame_bitstream_size) {
+        if (dec_api_prv->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr,
+                    "Warning: Frame decoded but may be broken! Decoded different stream size than expected from "
+                    "header get=%u, expected=%u\n",
+                    frame_bitstream_size,
+                    dec_ctx->picture_header_dynamic.hdr_Lcod);
+        }
+    }
+    return 0;
+}
+
 static void send_slices_tasks(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, TaskInputBitstream* input_buffer_ptr,
                               ObjectWrapper_t* wrapper_ptr_decoder_ctx, svt_jpeg_xs_image_buffer_t* image_buffer,
                               uint32_t header_size) {
@@ -138,8 +197,7 @@ static void send_slices_tasks(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, TaskIn
     pi_t* pi = &dec_ctx->dec_common->pi;
 
     dec_ctx->sync_num_slices_to_receive = pi->slice_num;
-    dec_ctx->sync_slices_idwt = (pi->decom_v != 0) && (dec_api_prv->universal_threads_num > 1) && (pi->precincts_per_slice > 2) &&
-        (dec_ctx->dec_common->picture_header_const.hdr_Cpih == 0);
+    dec_ctx->sync_slices_idwt = use_sync_slices_idwt(dec_api_prv, dec_ctx);
 
     for (uint32_t slice_idx = 0; slice_idx < pi->slice_num; slice_idx++) {
         svt_jxs_set_cond_var(&dec_ctx->map_slices_decode_done[slice_idx], SYNC_INIT);
@@ -158,7 +216,6 @@ static void send_slices_tasks(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, TaskIn
         buffer_output->bitstream_buf = input_buffer_ptr->dec_input.bitstream.buffer + offset;
         buffer_output->bitstream_buf_size = input_buffer_ptr->dec_input.bitstream.used_size - offset;
         buffer_output->slice_id = slice;
-        uint32_t frame_bitstream_size = header_size;
 
         uint32_t out_slice_size;
         int32_t ret = get_slice_size(
@@ -166,29 +223,11 @@ static void send_slices_tasks(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, TaskIn
         if (!ret) {
             offset += out_slice_size;
             if (slice + 1 == pi->slice_num) {
-                if (offset + 1 < input_buffer_ptr->dec_input.bitstream.used_size) {
-                    uint16_t val = get_16_bits(input_buffer_ptr->dec_input.bitstream.buffer + offset);
-                    if (val != CODESTREAM_EOC) {
-                        ret = SvtJxsErrorDecoderInvalidBitstream;
-                    }
-                }
-                else {
-                    ret = SvtJxsErrorDecoderBitstreamTooShort;
-                }
-                if (!ret) {
-                    frame_bitstream_size = offset + 2;
-
-                    if (dec_ctx->picture_header_dynamic.hdr_Lcod != 0 &&
-                        dec_ctx->picture_header_dynamic.hdr_Lcod != frame_bitstream_size) {
-                        if (dec_api_prv->verbose >= VERBOSE_ERRORS) {
-                            fprintf(stderr,
-                                    "Warning: Frame decoded but may be broken! Decoded different stream size than expected from "
-                                    "header get=%u, expected=%u\n",
-                                    frame_bitstream_size,
-                                    dec_ctx->picture_header_dynamic.hdr_Lcod);
-                        }
-                    }
-                }
+                ret = check_end_of_codestream(dec_api_prv,
+                                              dec_ctx,
+                                              input_buffer_ptr->dec_input.bitstream.buffer,
+                                              input_buffer_ptr->dec_input.bitstream.used_size,
+                                              offset);
             }
         }
 
@@ -196,7 +235,7 @@ static void send_slices_tasks(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, TaskIn
         if (ret) {
             dec_ctx->sync_num_slices_to_receive = slice + 1;
         }
-        svt_jxs_post_full_object(universal_wrapper_ptr);
+        post_universal_task(dec_api_prv, universal_wrapper_ptr);
         if (ret) {
             break;
         }
@@ -207,6 +246,8 @@ void* thread_init_stage_kernel(void* input_ptr) {
     ThreadContext_t* thread_ctx = (ThreadContext_t*)input_ptr;
     svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = (svt_jpeg_xs_decoder_api_prv_t*)thread_ctx;
     CondVar* sync_output_ringbuffer_left = &dec_api_prv->sync_output_ringbuffer_left;
+    bind_common_rtcd(&dec_api_prv->dec_common.common_rtcd);
+    bind_decoder_rtcd(&dec_api_prv->dec_common.decoder_rtcd);
 
     uint64_t frame_num = 0;
     uint32_t sync_output_frame_idx = 0;
@@ -230,6 +271,10 @@ void* thread_init_stage_kernel(void* input_ptr) {
 
         SVT_GET_FULL_OBJECT(dec_api_prv->input_consumer_fifo_ptr, &input_wrapper_ptr);
         TaskInputBitstream* input_buffer_ptr = (TaskInputBitstream*)input_wrapper_ptr->object_ptr;
+        if (input_buffer_ptr->dec_input.stats) {
+            input_buffer_ptr->dec_input.stats->init_begin_ns = get_current_time_ns();
+        }
+        SVT_TRACE_BEGIN("dec_init", frame_num, -1);
 
         if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
             fprintf(stderr,
@@ -270,6 +315,7 @@ void* thread_init_stage_kernel(void* input_ptr) {
         SvtJxsErrorType_t err = svt_jxs_get_empty_object(dec_api_prv->internal_pool_decoder_instance_fifo_ptr,
                                                          &wrapper_ptr_decoder_ctx);
         if (err != SvtJxsErrorNone || wrapper_ptr_decoder_ctx == NULL) {
+            SVT_TRACE_END("dec_init", frame_num, -1);
             continue;
         }
 
@@ -316,6 +362,7 @@ void* thread_init_stage_kernel(void* input_ptr) {
             ObjectWrapper_t* universal_wrapper_ptr = NULL;
             err = svt_jxs_get_empty_object(dec_api_prv->universal_producer_fifo_ptr, &universal_wrapper_ptr);
             if (err != SvtJxsErrorNone || universal_wrapper_ptr == NULL) {
+                SVT_TRACE_END("dec_init", frame_num - 1, -1);
                 continue;
             }
 
@@ -326,12 +373,15 @@ void* thread_init_stage_kernel(void* input_ptr) {
             buffer_output->frame_error = ret;
             buffer_output->slice_id = 0;
             dec_ctx->sync_num_slices_to_receive = 1;
-            svt_jxs_post_full_object(universal_wrapper_ptr);
+            post_universal_task(dec_api_prv, universal_wrapper_ptr);
         }
         else {
+            decoder_statistics_init_end(dec_ctx);
             send_slices_tasks(
                 dec_api_prv, input_buffer_ptr, wrapper_ptr_decoder_ctx, &input_buffer_ptr->dec_input.image, header_size);
         }
+        /*Decoder instance can be already released by Final thread, frame_num is incremented on assign.*/
+        SVT_TRACE_END("dec_init", frame_num - 1, -1);
         svt_jxs_release_object(input_wrapper_ptr);
         /*Callback available space in Input Queue*/
         if (callback_send) {
@@ -365,6 +415,11 @@ SvtJxsErrorType_t internal_svt_jpeg_xs_decoder_send_packet(svt_jpeg_xs_decoder_a
 
         memset(&dec_ctx->dec_input.bitstream, 0, sizeof(svt_jpeg_xs_bitstream_buffer_t));
         dec_ctx->dec_input.user_prv_ctx_ptr = dec_input->user_prv_ctx_ptr;
+        dec_ctx->dec_input.stats = dec_input->stats;
+        decoder_statistics_send(dec_api_prv, &dec_ctx->dec_input);
+        if (dec_ctx->dec_input.stats) {
+            dec_ctx->dec_input.stats->init_begin_ns = dec_ctx->dec_input.stats->send_ns;
+        }
 
         //Protect to overflow integer (frame_num) will not break output sync buffer.
         slice_scheduler_ctx->sync_output_frame_idx = (slice_scheduler_ctx->sync_output_frame_idx + 1) %
@@ -384,8 +439,7 @@ SvtJxsErrorType_t internal_svt_jpeg_xs_decoder_send_packet(svt_jpeg_xs_decoder_a
         }
 
         dec_ctx->sync_num_slices_to_receive = dec_ctx->dec_common->pi.slice_num;
-        dec_ctx->sync_slices_idwt = (dec_ctx->dec_common->pi.decom_v != 0) && (dec_api_prv->universal_threads_num > 1) &&
-            (dec_ctx->dec_common->pi.precincts_per_slice > 2) && (dec_ctx->dec_common->picture_header_const.hdr_Cpih == 0);
+        dec_ctx->sync_slices_idwt = use_sync_slices_idwt(dec_api_prv, dec_ctx);
     }
 
     svt_jpeg_xs_decoder_instance_t* dec_ctx = wrapper_ptr_decoder_ctx->object_ptr;
@@ -411,6 +465,9 @@ SvtJxsErrorType_t internal_svt_jpeg_xs_decoder_send_packet(svt_jpeg_xs_decoder_a
                                         &slice_scheduler_ctx->header_size,
                                         dec_api_prv->verbose);
         slice_scheduler_ctx->bytes_processed += slice_scheduler_ctx->header_size;
+        if (ret == SvtJxsErrorNone) {
+            decoder_statistics_init_end(dec_ctx);
+        }
     }
 
     //Process and schedule bitstream into slice-threads
@@ -446,7 +503,7 @@ SvtJxsErrorType_t internal_svt_jpeg_xs_decoder_send_packet(svt_jpeg_xs_decoder_a
             dec_ctx->sync_num_slices_to_receive = slice_scheduler_ctx->slices_sent + 1;
         }
 
-        svt_jxs_post_full_object(universal_wrapper_ptr);
+        post_universal_task(dec_api_prv, universal_wrapper_ptr);
 
         slice_scheduler_ctx->slices_sent++;
         slice_scheduler_ctx->bytes_processed += slice_size;
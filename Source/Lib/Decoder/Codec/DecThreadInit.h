@@ -21,6 +21,15 @@ void* thread_init_stage_kernel(void* input_ptr);
 SvtJxsErrorType_t input_bitstream_creator(void_ptr* object_dbl_ptr, void_ptr object_init_data_ptr);
 void input_bitstream_destroyer(void_ptr p);
 
+/*Parse size of slice in bitstream, return 0 on success or error code.*/
+int32_t get_slice_size(pi_t* pi, const uint8_t* bitstream_buf, size_t bitstream_buf_size, uint32_t slice,
+                       uint32_t* out_slice_size);
+int32_t check_end_of_codestream(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, svt_jpeg_xs_decoder_instance_t* dec_ctx,
+                                const uint8_t* bitstream_buf, size_t bitstream_buf_size, uint32_t offset);
+
+/*Reset statistics of frame received from application, or detach them when statistics are disabled.*/
+void decoder_statistics_send(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv, svt_jpeg_xs_frame_t* frame);
+
 SvtJxsErrorType_t internal_svt_jpeg_xs_decoder_send_packet(svt_jpeg_xs_decoder_api_prv_t* dec_api_prv,
                                                            svt_jpeg_xs_frame_t* dec_input, uint32_t* bytes_used);
 
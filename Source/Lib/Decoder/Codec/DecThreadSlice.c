@@ -6,6 +6,8 @@
 #include "DecThreads.h"
 #include "DecThreadSlice.h"
 #include "DecThreadFinal.h"
+#include "SvtUtility.h"
+#include "SvtTrace.h"
 
 /*Create input buffer item.*/
 SvtJxsErrorType_t universal_frame_task_creator(void_ptr* object_dbl_ptr, void_ptr object_init_data_ptr) {
@@ -55,94 +57,139 @@ SvtJxsErrorType_t universal_thread_context_ctor(ThreadContext_t* thread_context_
     return SvtJxsErrorNone;
 }
 
-void* thread_universal_stage_kernel(void* input_ptr) {
-    ThreadContext_t* thread_ctx = (ThreadContext_t*)input_ptr;
-    UniversalThreadContext* universal_ctx = (UniversalThreadContext*)thread_ctx->priv;
-    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv =
-        universal_ctx->dec_api_prv; //In future will receive universal_stage_context_ptr_array
+/*Decode one slice received from thread_init_stage_kernel().*/
+static void universal_stage_process_slice(UniversalThreadContext* universal_ctx, ObjectWrapper_t* input_wrapper_ptr) {
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = universal_ctx->dec_api_prv;
     svt_jpeg_xs_decoder_thread_context* dec_thread_context = universal_ctx->dec_thread_context;
+    TaskCalculateFrame* input_buffer_ptr = (TaskCalculateFrame*)input_wrapper_ptr->object_ptr;
+    svt_jpeg_xs_decoder_instance_t* dec_ctx = input_buffer_ptr->wrapper_ptr_decoder_ctx->object_ptr;
+
+    if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
+        fprintf(stderr,
+                "[%s][ThreadId %i] Get frame  %i from work thread\n",
+                __FUNCTION__,
+                universal_ctx->process_idx,
+                (int)dec_ctx->frame_num);
+    }
 
-    for (;;) {
-        ObjectWrapper_t* input_wrapper_ptr;
-        if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
-            fprintf(stderr, "[%s][ThreadId %i] Before SVT_GET_FULL_OBJECT\n", __FUNCTION__, universal_ctx->process_idx);
+    const uint8_t statistics = (dec_ctx->dec_input.stats != NULL);
+    svt_jpeg_xs_slice_stats_t slice_stats;
+    memset(&slice_stats, 0, sizeof(slice_stats));
+    if (statistics) {
+        slice_stats.begin_ns = get_current_time_ns();
+    }
+    SVT_TRACE_BEGIN("dec_slice", dec_ctx->frame_num, input_buffer_ptr->slice_id);
+
+    SvtJxsErrorType_t ret_decode = SvtJxsErrorNone;
+    /*Check that other slice or header did not have error while decoding.*/
+    if (input_buffer_ptr->frame_error == 0) {
+        uint32_t out_slice_size;
+        ret_decode = svt_jpeg_xs_decode_slice(dec_ctx,
+                                              dec_thread_context,
+                                              input_buffer_ptr->bitstream_buf,
+                                              input_buffer_ptr->bitstream_buf_size,
+                                              input_buffer_ptr->slice_id,
+                                              &out_slice_size,
+                                              &input_buffer_ptr->image_buffer,
+                                              dec_api_prv->verbose);
+        if (ret_decode < 0) {
+            input_buffer_ptr->frame_error = ret_decode;
         }
-        SVT_GET_FULL_OBJECT(/*dec_api_prv->universal_consumer_fifo_ptr*/ universal_ctx->universal_consumer_fifo_ptr,
-                            &input_wrapper_ptr);
-        TaskCalculateFrame* input_buffer_ptr = (TaskCalculateFrame*)input_wrapper_ptr->object_ptr;
-        svt_jpeg_xs_decoder_instance_t* dec_ctx = input_buffer_ptr->wrapper_ptr_decoder_ctx->object_ptr;
+        else if (statistics) {
+            slice_stats.quantization = dec_thread_context->slice_quantization;
+            slice_stats.refinement = dec_thread_context->slice_refinement == UINT8_MAX ? 0 : dec_thread_context->slice_refinement;
+            slice_stats.padding_bytes = dec_thread_context->slice_padding_bytes;
+        }
+    }
+    if (statistics) {
+        slice_stats.end_ns = get_current_time_ns();
+    }
 
-        if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
+    if (dec_api_prv->verbose >= VERBOSE_WARNINGS) {
+        if (ret_decode >= 0 && ret_decode != (int)input_buffer_ptr->bitstream_buf_size) {
             fprintf(stderr,
-                    "[%s][ThreadId %i] Get frame  %i from work thread\n",
+                    "[%s:Process ID: %i] WARNING frame %i !!! Unexpected size of frame, expected: %i get: %i\n",
                     __FUNCTION__,
                     universal_ctx->process_idx,
-                    (int)dec_ctx->frame_num);
+                    (int)dec_ctx->frame_num,
+                    (int)input_buffer_ptr->bitstream_buf_size,
+                    ret_decode);
         }
+    }
 
-        SvtJxsErrorType_t ret_decode = SvtJxsErrorNone;
-        /*Check that other slice or header did not have error while decoding.*/
-        if (input_buffer_ptr->frame_error == 0) {
-            uint32_t out_slice_size;
-            ret_decode = svt_jpeg_xs_decode_slice(dec_ctx,
-                                                  dec_thread_context,
-                                                  input_buffer_ptr->bitstream_buf,
-                                                  input_buffer_ptr->bitstream_buf_size,
-                                                  input_buffer_ptr->slice_id,
-                                                  &out_slice_size,
-                                                  &input_buffer_ptr->image_buffer,
-                                                  dec_api_prv->verbose);
-            if (ret_decode < 0) {
-                input_buffer_ptr->frame_error = ret_decode;
-            }
+    if (ret_decode < 0) {
+        if (dec_api_prv->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr,
+                    "[%s:Process ID: %i] %i, %p, %i HANDLE ERROR!!!\n",
+                    __FUNCTION__,
+                    universal_ctx->process_idx,
+                    (int)dec_ctx->frame_num,
+                    input_buffer_ptr->bitstream_buf,
+                    (int)input_buffer_ptr->bitstream_buf_size);
         }
+    }
 
-        if (dec_api_prv->verbose >= VERBOSE_WARNINGS) {
-            if (ret_decode >= 0 && ret_decode != (int)input_buffer_ptr->bitstream_buf_size) {
-                fprintf(stderr,
-                        "[%s:Process ID: %i] WARNING frame %i !!! Unexpected size of frame, expected: %i get: %i\n",
-                        __FUNCTION__,
-                        universal_ctx->process_idx,
-                        (int)dec_ctx->frame_num,
-                        (int)input_buffer_ptr->bitstream_buf_size,
-                        ret_decode);
-            }
-        }
+    ObjectWrapper_t* universal_wrapper_ptr = NULL;
+    SvtJxsErrorType_t ret = svt_jxs_get_empty_object(universal_ctx->final_producer_fifo_ptr, &universal_wrapper_ptr);
+    if (ret != SvtJxsErrorNone || universal_wrapper_ptr == NULL) {
+        SVT_TRACE_END("dec_slice", dec_ctx->frame_num, input_buffer_ptr->slice_id);
+        return;
+    }
 
-        if (ret_decode < 0) {
-            if (dec_api_prv->verbose >= VERBOSE_ERRORS) {
-                fprintf(stderr,
-                        "[%s:Process ID: %i] %i, %p, %i HANDLE ERROR!!!\n",
-                        __FUNCTION__,
-                        universal_ctx->process_idx,
-                        (int)dec_ctx->frame_num,
-                        input_buffer_ptr->bitstream_buf,
-                        (int)input_buffer_ptr->bitstream_buf_size);
-            }
-        }
+    TaskFinalSync* buffer_output = (TaskFinalSync*)universal_wrapper_ptr->object_ptr;
+    buffer_output->wrapper_ptr_decoder_ctx = input_buffer_ptr->wrapper_ptr_decoder_ctx;
+    buffer_output->slice_id = input_buffer_ptr->slice_id;
+    buffer_output->frame_error = input_buffer_ptr->frame_error;
+    buffer_output->slice_stats = slice_stats;
+
+    if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
+        fprintf(stderr,
+                "[%s][ThreadId %i] Send frame  %i from work thread\n",
+                __FUNCTION__,
+                universal_ctx->process_idx,
+                (int)dec_ctx->frame_num);
+    }
 
-        ObjectWrapper_t* universal_wrapper_ptr = NULL;
-        SvtJxsErrorType_t ret = svt_jxs_get_empty_object(universal_ctx->final_producer_fifo_ptr, &universal_wrapper_ptr);
-        if (ret != SvtJxsErrorNone || universal_wrapper_ptr == NULL) {
-            continue;
-        }
+    /*Decoder instance can be released by Final thread after post, finish event before.*/
+    SVT_TRACE_END("dec_slice", dec_ctx->frame_num, input_buffer_ptr->slice_id);
+    svt_jxs_post_full_object(universal_wrapper_ptr);
+    svt_jxs_release_object(input_wrapper_ptr);
+}
 
-        TaskFinalSync* buffer_output = (TaskFinalSync*)universal_wrapper_ptr->object_ptr;
-        buffer_output->wrapper_ptr_decoder_ctx = input_buffer_ptr->wrapper_ptr_decoder_ctx;
-        buffer_output->slice_id = input_buffer_ptr->slice_id;
-        buffer_output->frame_error = input_buffer_ptr->frame_error;
+void* thread_universal_stage_kernel(void* input_ptr) {
+    ThreadContext_t* thread_ctx = (ThreadContext_t*)input_ptr;
+    UniversalThreadContext* universal_ctx = (UniversalThreadContext*)thread_ctx->priv;
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv =
+        universal_ctx->dec_api_prv; //In future will receive universal_stage_context_ptr_array
+    bind_common_rtcd(&dec_api_prv->dec_common.common_rtcd);
+    bind_decoder_rtcd(&dec_api_prv->dec_common.decoder_rtcd);
 
+    for (;;) {
+        ObjectWrapper_t* input_wrapper_ptr;
         if (dec_api_prv->verbose >= VERBOSE_INFO_MULTITHREADING) {
-            fprintf(stderr,
-                    "[%s][ThreadId %i] Send frame  %i from work thread\n",
-                    __FUNCTION__,
-                    universal_ctx->process_idx,
-                    (int)dec_ctx->frame_num);
+            fprintf(stderr, "[%s][ThreadId %i] Before SVT_GET_FULL_OBJECT\n", __FUNCTION__, universal_ctx->process_idx);
         }
-
-        svt_jxs_post_full_object(universal_wrapper_ptr);
-        svt_jxs_release_object(input_wrapper_ptr);
+        SVT_GET_FULL_OBJECT(/*dec_api_prv->universal_consumer_fifo_ptr*/ universal_ctx->universal_consumer_fifo_ptr,
+                            &input_wrapper_ptr);
+        universal_stage_process_slice(universal_ctx, input_wrapper_ptr);
     }
 
     return NULL;
 }
+
+/*Thread pool task, decode one slice. Worker of pool can run tasks of other instances, so bind
+ *dispatch table of this decoder for every task.*/
+void universal_stage_pool_task(void* input_ptr) {
+    ThreadContext_t* thread_ctx = (ThreadContext_t*)input_ptr;
+    UniversalThreadContext* universal_ctx = (UniversalThreadContext*)thread_ctx->priv;
+    svt_jpeg_xs_decoder_api_prv_t* dec_api_prv = universal_ctx->dec_api_prv;
+    ObjectWrapper_t* input_wrapper_ptr;
+
+    svt_jxs_get_full_object_non_blocking(universal_ctx->universal_consumer_fifo_ptr, &input_wrapper_ptr);
+    if (input_wrapper_ptr == NULL) {
+        return;
+    }
+    bind_common_rtcd(&dec_api_prv->dec_common.common_rtcd);
+    bind_decoder_rtcd(&dec_api_prv->dec_common.decoder_rtcd);
+    universal_stage_process_slice(universal_ctx, input_wrapper_ptr);
+}
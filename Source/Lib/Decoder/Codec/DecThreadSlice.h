@@ -30,6 +30,7 @@ typedef struct UniversalThreadContext {
 } UniversalThreadContext;
 
 void* thread_universal_stage_kernel(void* input_ptr);
+void universal_stage_pool_task(void* input_ptr);
 
 /*Allocate queues and contexts for multithreading*/
 SvtJxsErrorType_t universal_frame_task_creator(void_ptr* object_dbl_ptr, void_ptr object_init_data_ptr);
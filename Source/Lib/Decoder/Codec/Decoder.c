@@ -153,6 +153,10 @@ svt_jpeg_xs_decoder_instance_t* svt_jpeg_xs_dec_instance_alloc(svt_jpeg_xs_decod
     pi_t* pi = &dec_common->pi;
     int ret = 0;
 
+    for (uint32_t c = 0; c < MAX_COMPONENTS_NUM; c++) {
+        ctx->buffer_tmp_cpih[c] = dec_common->buffer_tmp_cpih[c];
+    }
+
     ctx->precincts_line_coeff_size = 0;
     for (uint32_t c = 0; c < pi->comps_num; c++) {
         ctx->precincts_line_coeff_comp_offset[c] = ctx->precincts_line_coeff_size;
@@ -161,7 +165,22 @@ svt_jpeg_xs_decoder_instance_t* svt_jpeg_xs_dec_instance_alloc(svt_jpeg_xs_decod
         }
     }
 
-    uint32_t frame_coeff_size = ctx->precincts_line_coeff_size * pi->precincts_line_num;
+    ctx->coeff_precinct_lines_num = pi->precincts_line_num;
+    if (dec_common->streaming) {
+        ctx->coeff_precinct_lines_num = MIN(pi->precincts_line_num, pi->precincts_per_slice + 2);
+        const uint32_t pixel_size = dec_common->picture_header_const.hdr_bit_depth[0] <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+        for (uint32_t c = 0; c < pi->comps_num; c++) {
+            /*Lines of slice and lines delayed by vertical IDWT of previous slice*/
+            ctx->stream_band_lines[c] = MIN(pi->components[c].height,
+                                            (pi->precincts_per_slice + 2) * pi->components[c].precinct_height);
+            SVT_NO_THROW_MALLOC(ctx->stream_band[c], (size_t)ctx->stream_band_lines[c] * pi->components[c].width * pixel_size);
+            if (!ctx->stream_band[c]) {
+                ret |= 1;
+            }
+        }
+    }
+
+    uint32_t frame_coeff_size = ctx->precincts_line_coeff_size * ctx->coeff_precinct_lines_num;
 
     SVT_NO_THROW_MALLOC(ctx->coeff_buff_ptr_16bit, frame_coeff_size * sizeof(int16_t));
     if (!ctx->coeff_buff_ptr_16bit) {
@@ -226,6 +245,9 @@ void svt_jpeg_xs_dec_instance_free(svt_jpeg_xs_decoder_instance_t* ctx) {
         return;
     }
     SVT_FREE(ctx->coeff_buff_ptr_16bit);
+    for (uint32_t c = 0; c < MAX_COMPONENTS_NUM; c++) {
+        SVT_FREE(ctx->stream_band[c]);
+    }
     SVT_FREE(ctx->precinct_idwt_tmp_buffer);
     SVT_FREE(ctx->precinct_component_tmp_buffer);
 
@@ -394,7 +416,8 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_header(svt_jpeg_xs_decoder_instance_t* ctx,
 void decoder_get_precinct_bands_pointers(const pi_t* pi, svt_jpeg_xs_decoder_instance_t* ctx,
                                          int16_t* precicnt_bands_ptr[MAX_BANDS_PER_COMPONENT_NUM], uint32_t comp,
                                          uint32_t precinct_line_idx) {
-    int16_t* bands_offset = ctx->coeff_buff_ptr_16bit + precinct_line_idx * ctx->precincts_line_coeff_size +
+    int16_t* bands_offset = ctx->coeff_buff_ptr_16bit +
+        (precinct_line_idx % ctx->coeff_precinct_lines_num) * ctx->precincts_line_coeff_size +
         ctx->precincts_line_coeff_comp_offset[comp];
     for (uint32_t b = 0; b < pi->components[comp].bands_num; b++) {
         precicnt_bands_ptr[b] = bands_offset;
@@ -436,6 +459,18 @@ void transform_precinct_initialize(const pi_t* pi, svt_jpeg_xs_decoder_instance_
                                         shift);
 }
 
+/*Output line of component, in streaming line is kept in ring of decoded lines until sent by svt_jpeg_xs_decode_stream_lines().*/
+static void* decoder_get_output_line(svt_jpeg_xs_decoder_instance_t* ctx, svt_jpeg_xs_image_buffer_t* out, uint32_t c,
+                                     uint32_t line, uint32_t pixel_size) {
+    if (ctx->stream_band[c]) {
+        assert(line >= ctx->stream_lines_sent[c] && line < ctx->stream_lines_sent[c] + ctx->stream_band_lines[c]);
+        ctx->stream_lines_decoded[c] = MAX(ctx->stream_lines_decoded[c], line + 1);
+        return ctx->stream_band[c] +
+            (size_t)(line % ctx->stream_band_lines[c]) * ctx->dec_common->pi.components[c].width * pixel_size;
+    }
+    return (uint8_t*)out->data_yuv[c] + (size_t)line * out->stride[c] * pixel_size;
+}
+
 void transform_precinct(const pi_t* pi, svt_jpeg_xs_decoder_instance_t* ctx, uint32_t c, uint32_t precinct_line_idx,
                         int32_t* precinct_components_tmp_buffer, int32_t* precinct_idwt_tmp_buffer,
                         svt_jpeg_xs_image_buffer_t* out, uint8_t shift) {
@@ -443,6 +478,22 @@ void transform_precinct(const pi_t* pi, svt_jpeg_xs_decoder_instance_t* ctx, uin
     int16_t* buff_in_prev[MAX_BANDS_PER_COMPONENT_NUM] = {0};
     uint32_t width = pi->components[c].width;
     int32_t component_line_idx = precinct_line_idx * pi->components[c].precinct_height;
+    uint8_t bit_depth = ctx->dec_common->picture_header_const.hdr_bit_depth[0];
+
+    if (pi->components[c].decom_v == 0 && pi->components[c].decom_h > 1 && ctx->picture_header_dynamic.hdr_Tnlt == 0) {
+        const uint32_t pixel_size = bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+        void* out_buf = decoder_get_output_line(ctx, out, c, component_line_idx, pixel_size);
+        decoder_get_precinct_bands_pointers(pi, ctx, buff_in, c, precinct_line_idx);
+        transform_component_line_V0_output_linear(&pi->components[c],
+                                                  buff_in,
+                                                  precinct_components_tmp_buffer,
+                                                  precinct_idwt_tmp_buffer,
+                                                  out_buf,
+                                                  shift,
+                                                  ctx->picture_header_dynamic.hdr_Bw,
+                                                  bit_depth);
+        return;
+    }
 
     transform_lines_t out_lines;
     memset(&out_lines, 0, sizeof(transform_lines_t));
@@ -472,6 +523,20 @@ void transform_precinct(const pi_t* pi, svt_jpeg_xs_decoder_instance_t* ctx, uin
         decoder_get_precinct_bands_pointers(pi, ctx, buff_in_prev, c, precinct_line_idx - 1);
     }
 
+    /*Last vertical level of precinct that is not first or last writes lines directly with linear output scaling.*/
+    idwt_output_t output;
+    if (pi->components[c].decom_v > 0 && precinct_line_idx > 0 && precinct_line_idx < (pi->precincts_line_num - 1) &&
+        ctx->picture_header_dynamic.hdr_Tnlt == 0) {
+        const uint32_t pixel_size = bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+        const uint32_t lines_num = 2 * pi->components[c].decom_v;
+        for (uint32_t i = 0; i < lines_num; i++) {
+            output.lines[i] = decoder_get_output_line(ctx, out, c, component_line_idx + 1 - lines_num + i, pixel_size);
+        }
+        output.bw = ctx->picture_header_dynamic.hdr_Bw;
+        output.depth = bit_depth;
+        out_lines.output = &output;
+    }
+
     new_transform_component_line(&pi->components[c],
                                  buff_in,
                                  buff_in_prev,
@@ -481,19 +546,20 @@ void transform_precinct(const pi_t* pi, svt_jpeg_xs_decoder_instance_t* ctx, uin
                                  pi->precincts_line_num,
                                  shift);
 
+    if (out_lines.output) {
+        return;
+    }
+
     component_line_idx += out_lines.offset;
 
     for (uint32_t line = out_lines.line_start; line <= out_lines.line_stop; line++) {
         int32_t* in = out_lines.buffer_out[line];
-        void* out_buf = out->data_yuv[c];
-        uint32_t out_stride = out->stride[c];
-        uint8_t bit_depth = ctx->dec_common->picture_header_const.hdr_bit_depth[0];
         if (bit_depth == 8) {
-            uint8_t* out_buf_8 = ((uint8_t*)out_buf) + component_line_idx * out_stride;
+            uint8_t* out_buf_8 = (uint8_t*)decoder_get_output_line(ctx, out, c, component_line_idx, sizeof(uint8_t));
             nlt_inverse_transform_line_8bit(in, bit_depth, &ctx->picture_header_dynamic, out_buf_8, width);
         }
         else {
-            uint16_t* out_buf_16 = ((uint16_t*)out_buf) + component_line_idx * out_stride;
+            uint16_t* out_buf_16 = (uint16_t*)decoder_get_output_line(ctx, out, c, component_line_idx, sizeof(uint16_t));
             nlt_inverse_transform_line_16bit(in, bit_depth, &ctx->picture_header_dynamic, out_buf_16, width);
         }
         component_line_idx++;
@@ -528,6 +594,9 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_slice(svt_jpeg_xs_decoder_instance_t* ctx,
 
     const uint32_t is_last_slice = (slice == (pi->slice_num - 1));
     const uint32_t lines_per_slice = is_last_slice ? lines_per_slice_last : pi->precincts_per_slice;
+    thread_ctx->slice_quantization = 0;
+    thread_ctx->slice_refinement = UINT8_MAX;
+    thread_ctx->slice_padding_bytes = 0;
 
     for (uint32_t line = 0; line < lines_per_slice; line++) {
         const uint32_t precinct_line_idx = slice * pi->precincts_per_slice + line;
@@ -569,6 +638,13 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_slice(svt_jpeg_xs_decoder_instance_t* ctx,
             }
 
             inv_precinct_calculate_data(precinct, pi, picture_header_dynamic->hdr_Qpih);
+            if (precinct->quantization > thread_ctx->slice_quantization ||
+                (precinct->quantization == thread_ctx->slice_quantization &&
+                 precinct->refinement < thread_ctx->slice_refinement)) {
+                thread_ctx->slice_quantization = precinct->quantization;
+                thread_ctx->slice_refinement = precinct->refinement;
+            }
+            thread_ctx->slice_padding_bytes += precinct->padding_bytes;
 
             //Swap pointers in precincts_top
             thread_ctx->precincts_top[pi->precincts_col_num] = thread_ctx->precincts_top[column];
@@ -700,6 +776,38 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_final_slice_overlap(svt_jpeg_xs_decoder_ins
     return SvtJxsErrorNone;
 }
 
+void svt_jpeg_xs_decode_stream_begin(svt_jpeg_xs_decoder_instance_t* ctx) {
+    memset(ctx->stream_lines_decoded, 0, sizeof(ctx->stream_lines_decoded));
+    memset(ctx->stream_lines_sent, 0, sizeof(ctx->stream_lines_sent));
+}
+
+/*Send lines finished by IDWT, call after slice and IDWT between slices are calculated. Lines wrapped in ring
+ *are sent in two bands.*/
+SvtJxsErrorType_t svt_jpeg_xs_decode_stream_lines(svt_jpeg_xs_decoder_instance_t* ctx, const svt_jpeg_xs_stream_t* stream) {
+    pi_t* pi = &ctx->dec_common->pi;
+    const uint32_t pixel_size = ctx->dec_common->picture_header_const.hdr_bit_depth[0] <= 8 ? sizeof(uint8_t)
+                                                                                           : sizeof(uint16_t);
+    for (uint32_t c = 0; c < pi->comps_num; c++) {
+        const uint32_t width = pi->components[c].width;
+        while (ctx->stream_lines_sent[c] < ctx->stream_lines_decoded[c]) {
+            const uint32_t band_line = ctx->stream_lines_sent[c] % ctx->stream_band_lines[c];
+            const uint32_t lines_num = MIN(ctx->stream_lines_decoded[c] - ctx->stream_lines_sent[c],
+                                           ctx->stream_band_lines[c] - band_line);
+            SvtJxsErrorType_t ret = stream->write_lines(stream->context,
+                                                        c,
+                                                        ctx->stream_lines_sent[c],
+                                                        lines_num,
+                                                        ctx->stream_band[c] + (size_t)band_line * width * pixel_size,
+                                                        width);
+            if (ret) {
+                return ret;
+            }
+            ctx->stream_lines_sent[c] += lines_num;
+        }
+    }
+    return SvtJxsErrorNone;
+}
+
 SvtJxsErrorType_t svt_jpeg_xs_decode_final(svt_jpeg_xs_decoder_instance_t* ctx, svt_jpeg_xs_image_buffer_t* out) {
     pi_t* pi = &ctx->dec_common->pi;
     picture_header_dynamic_t* picture_header_dynamic = &ctx->picture_header_dynamic;
@@ -733,7 +841,7 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_final(svt_jpeg_xs_decoder_instance_t* ctx,
                 }
 
                 uint32_t width = pi->components[comp_id].width;
-                int32_t* buff_out = ctx->dec_common->buffer_tmp_cpih[comp_id] +
+                int32_t* buff_out = ctx->buffer_tmp_cpih[comp_id] +
                     precinct_idx * pi->components[comp_id].precinct_height * width;
                 transform_lines_t out_lines;
                 memset(&out_lines, 0, sizeof(transform_lines_t));
@@ -773,7 +881,7 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_final(svt_jpeg_xs_decoder_instance_t* ctx,
                 decoder_get_precinct_bands_pointers(pi, ctx, buff_in, comp_id, precinct_idx);
                 uint32_t width = pi->components[comp_id].width;
                 uint32_t component_precinct_height = pi->components[comp_id].precinct_height;
-                int32_t* buff_out = ctx->dec_common->buffer_tmp_cpih[comp_id] + precinct_idx * component_precinct_height * width;
+                int32_t* buff_out = ctx->buffer_tmp_cpih[comp_id] + precinct_idx * component_precinct_height * width;
 
                 if (pi->decom_v && precinct_idx == (pi->precincts_line_num - 1)) {
                     component_precinct_height = pi->components[comp_id].height % pi->components[comp_id].precinct_height;
@@ -786,9 +894,9 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_final(svt_jpeg_xs_decoder_instance_t* ctx,
         }
 
         mct_inverse_transform(
-            ctx->dec_common->buffer_tmp_cpih, pi, picture_header_dynamic, ctx->dec_common->picture_header_const.hdr_Cpih);
+            ctx->buffer_tmp_cpih, pi, picture_header_dynamic, ctx->dec_common->picture_header_const.hdr_Cpih);
         nlt_inverse_transform(
-            ctx->dec_common->buffer_tmp_cpih, pi, &ctx->dec_common->picture_header_const, picture_header_dynamic, out);
+            ctx->buffer_tmp_cpih, pi, &ctx->dec_common->picture_header_const, picture_header_dynamic, out);
     }
     return SvtJxsErrorNone;
 }
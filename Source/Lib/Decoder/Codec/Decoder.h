@@ -9,6 +9,7 @@
 #include "SvtJpegxsDec.h"
 #include "Definitions.h"
 #include "Threads/SvtThreads.h"
+#include "decoder_dsp_rtcd.h"
 
 #define MAX_PRECINCT_IN_LINE (130)
 
@@ -23,12 +24,22 @@ typedef struct svt_jpeg_xs_decoder_common {
 
     // max_frame_bitstream_size is used only when packetization_mode is enabled
     uint32_t max_frame_bitstream_size;
+    // Decoded lines are sent by stream callback, instances keep only precincts and lines of slice in progress
+    uint8_t streaming;
+
+    // Kernels resolved for use_cpu_flags of this instance, bound to every decoder thread when it starts
+    common_rtcd_t common_rtcd;
+    decoder_rtcd_t decoder_rtcd;
 } svt_jpeg_xs_decoder_common_t;
 
 typedef struct svt_jpeg_xs_decoder_thread_context {
     precinct_t* precincts_top[MAX_PRECINCT_IN_LINE];
     int32_t* precinct_components_tmp_buffer[MAX_COMPONENTS_NUM];
     int32_t* precinct_idwt_tmp_buffer[MAX_COMPONENTS_NUM];
+    /* Coarsest quantization and padding of last decoded slice, for statistics */
+    uint8_t slice_quantization;
+    uint8_t slice_refinement;
+    uint32_t slice_padding_bytes;
 } svt_jpeg_xs_decoder_thread_context;
 
 /*TODO Decoder instance Per frame, rename to decoder per frame.*/
@@ -86,6 +97,16 @@ precinct X |  comp-n, band6        |
     int16_t* coeff_buff_ptr_16bit;
     uint32_t precincts_line_coeff_size;
     uint32_t precincts_line_coeff_comp_offset[MAX_COMPONENTS_NUM];
+    /*Number of precinct lines in coeff_buff_ptr_16bit, in streaming precinct lines are kept in ring of slice
+     *and 2 precinct lines above used by IDWT between slices, otherwise whole frame.*/
+    uint32_t coeff_precinct_lines_num;
+
+    /*Streaming: ring of decoded lines of every component, lines from stream_lines_sent to stream_lines_decoded
+     *are waiting to be sent by svt_jpeg_xs_decode_stream_lines().*/
+    uint8_t* stream_band[MAX_COMPONENTS_NUM];
+    uint32_t stream_band_lines[MAX_COMPONENTS_NUM];
+    uint32_t stream_lines_decoded[MAX_COMPONENTS_NUM];
+    uint32_t stream_lines_sent[MAX_COMPONENTS_NUM];
 
     uint32_t sync_output_frame_idx;
     uint32_t sync_num_slices_to_receive;
@@ -99,6 +120,9 @@ precinct X |  comp-n, band6        |
     int32_t* precinct_idwt_tmp_buffer;
     int32_t* precinct_component_tmp_buffer;
 
+    // Temporary buffer when hdr_Cpih is enabled, by default buffer of dec_common shared by instances finished in one thread
+    int32_t* buffer_tmp_cpih[MAX_COMPONENTS_NUM];
+
     // Buffer allocated only when packetization_mode is enabled
     uint8_t* frame_bitstream_ptr;
 } svt_jpeg_xs_decoder_instance_t;
@@ -112,6 +136,7 @@ SvtJxsErrorType_t svt_jpeg_xs_decoder_probe(const uint8_t* bitstream_buf, size_t
                                             picture_header_dynamic_t* picture_header_dynamic, uint32_t verbose);
 ColourFormat_t svt_jpeg_xs_get_format_from_params(uint32_t comps_num, uint32_t sx[MAX_COMPONENTS_NUM],
                                                   uint32_t sy[MAX_COMPONENTS_NUM]);
+void copy_weights_table(pi_t* pi, picture_header_const_t* picture_header_static);
 
 SvtJxsErrorType_t svt_jpeg_xs_dec_init_common(svt_jpeg_xs_decoder_common_t* dec_common,
                                               svt_jpeg_xs_image_config_t* out_image_config, proxy_mode_t proxy_mode,
@@ -133,6 +158,9 @@ SvtJxsErrorType_t svt_jpeg_xs_decode_final(svt_jpeg_xs_decoder_instance_t* ctx,
 SvtJxsErrorType_t svt_jpeg_xs_decode_final_slice_overlap(svt_jpeg_xs_decoder_instance_t* ctx, svt_jpeg_xs_image_buffer_t* out,
                                                          uint32_t slice_idx);
 
+void svt_jpeg_xs_decode_stream_begin(svt_jpeg_xs_decoder_instance_t* ctx);
+SvtJxsErrorType_t svt_jpeg_xs_decode_stream_lines(svt_jpeg_xs_decoder_instance_t* ctx, const svt_jpeg_xs_stream_t* stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,35 @@ inv_transform_V0_ptr_t inv_transform_V0_get_function_ptr(uint8_t decom_h) {
     return NULL;
 }
 
+/* Last vertical IDWT level of precinct that is not first or last in component, even and odd line are written to
+ * output->lines[line + 1] and output->lines[line], even line is also kept in out[2] for next precinct.
+ */
+static void idwt_vertical_line_output(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                      const idwt_output_t* output, uint32_t line, uint32_t len) {
+    if (output->depth == 8) {
+        idwt_vertical_line_output_8bit(in_lf,
+                                       in_hf0,
+                                       in_hf1,
+                                       out,
+                                       (uint8_t*)output->lines[line],
+                                       (uint8_t*)output->lines[line + 1],
+                                       len,
+                                       output->bw,
+                                       output->depth);
+    }
+    else {
+        idwt_vertical_line_output_16bit(in_lf,
+                                        in_hf0,
+                                        in_hf1,
+                                        out,
+                                        (uint16_t*)output->lines[line],
+                                        (uint16_t*)output->lines[line + 1],
+                                        len,
+                                        output->bw,
+                                        output->depth);
+    }
+}
+
 /*
   * n- max band number
                                                 STAGE 1               STAGE 2
@@ -61,7 +90,8 @@ buffer_tmp Required size: 3 * component->width
 */
 void transform_component_line_V1_Hx(const pi_component_t* const component, int16_t* buffer_in[MAX_BANDS_PER_COMPONENT_NUM],
                                     int32_t* buffer_out[4], uint32_t precinct_line_idx, int32_t* buffer_tmp,
-                                    uint32_t precinct_num, uint32_t idwt_idx, uint32_t len, uint8_t shift) {
+                                    uint32_t precinct_num, uint32_t idwt_idx, uint32_t len, uint8_t shift,
+                                    const idwt_output_t* output) {
     inv_transform_V0_ptr_t inv_transform_V0_Hn = inv_transform_V0_get_function_ptr(idwt_idx);
     int32_t height = component->bands[0].height + component->bands[idwt_idx + 1].height;
     uint32_t if_first_precinct = (precinct_line_idx == 0);
@@ -81,6 +111,11 @@ void transform_component_line_V1_Hx(const pi_component_t* const component, int16
         idwt_horizontal_line_lf16_hf16(buf_hf_1, buf_hf_2, hf_1, len, shift);
     }
     //STAGE 2
+    if (output) {
+        assert(!if_first_precinct && !if_last_precinct);
+        idwt_vertical_line_output(lf, hf_0, hf_1, buffer_out, output, 0, len);
+        return;
+    }
     idwt_vertical_line(lf, hf_0, hf_1, buffer_out, len, if_first_precinct, if_last_precinct, height);
 }
 
@@ -149,7 +184,7 @@ buffer_tmp Required size:
 void transform_component_line_V2_Hx(const pi_component_t* const component, int16_t* buffer_in[MAX_BANDS_PER_COMPONENT_NUM],
                                     int16_t* buffer_in_prev[MAX_BANDS_PER_COMPONENT_NUM], int32_t* buffer_out[8],
                                     uint32_t precinct_line_idx, int32_t* buffer_tmp, uint32_t precinct_num, uint32_t idwt_idx,
-                                    uint8_t shift) {
+                                    uint8_t shift, const idwt_output_t* output) {
     uint32_t V1_len = (component->width / 2) + (component->width & 1);
     int32_t* tmp_buffer_out = buffer_tmp + 3 * V1_len;
 
@@ -165,7 +200,7 @@ void transform_component_line_V2_Hx(const pi_component_t* const component, int16
     //V1_buffer_out Required size: 4 * V1_len, ~2 * component->width
     //DO NOT MODIFY tmp_buffer_out 1st and 2nd line!!!!!
     transform_component_line_V1_Hx(
-        component, buffer_in, V1_buffer_out, precinct_line_idx, buffer_tmp, precinct_num, idwt_idx, V1_len, shift);
+        component, buffer_in, V1_buffer_out, precinct_line_idx, buffer_tmp, precinct_num, idwt_idx, V1_len, shift, NULL);
 
     tmp_buffer_out += 4 * V1_len;
 
@@ -306,7 +341,13 @@ void transform_component_line_V2_Hx(const pi_component_t* const component, int16
         int32_t* hf_l1 = tmp_buffer_out + (1 + ((i + 1) % 2)) * component->width;
 
         //stage 4
-        idwt_vertical_line(lf_l0, hf_l0, hf_l1, buffer_out, component->width, 0 /*1st prec*/, 0 /*last prec*/, component->height);
+        if (output) {
+            idwt_vertical_line_output(lf_l0, hf_l0, hf_l1, buffer_out, output, 2 * i, component->width);
+        }
+        else {
+            idwt_vertical_line(
+                lf_l0, hf_l0, hf_l1, buffer_out, component->width, 0 /*1st prec*/, 0 /*last prec*/, component->height);
+        }
 
         int16_t* hf_hf_l0 = buffer_in[component->bands_num - 1] + i * component->bands[component->bands_num - 1].width;
         int16_t* lf_hf_l0 = buffer_in[component->bands_num - 2] + i * component->bands[component->bands_num - 2].width;
@@ -316,6 +357,28 @@ void transform_component_line_V2_Hx(const pi_component_t* const component, int16
     }
 }
 
+/* Last horizontal level of V0 transform is fused with linear output scaling and written directly to output line.
+ * buffer_lf and buffer_tmp required size: component->width
+ */
+void transform_component_line_V0_output_linear(const pi_component_t* const component,
+                                               int16_t* buffer_in[MAX_BANDS_PER_COMPONENT_NUM], int32_t* buffer_lf,
+                                               int32_t* buffer_tmp, void* out, uint8_t shift, uint8_t bw, uint8_t depth) {
+    const uint32_t decom_h = component->decom_h;
+    assert(component->decom_v == 0 && decom_h > 1);
+
+    inv_transform_V0_ptr_t inv_transform_V0_Hn = inv_transform_V0_get_function_ptr(decom_h - 1);
+    inv_transform_V0_Hn(component, buffer_in, buffer_lf, buffer_tmp, shift);
+
+    if (depth == 8) {
+        idwt_horizontal_line_lf32_hf16_output_8bit(
+            buffer_lf, buffer_in[decom_h], (uint8_t*)out, component->width, shift, bw, depth);
+    }
+    else {
+        idwt_horizontal_line_lf32_hf16_output_16bit(
+            buffer_lf, buffer_in[decom_h], (uint16_t*)out, component->width, shift, bw, depth);
+    }
+}
+
 void new_transform_component_line(const pi_component_t* const component, int16_t* buffer_in[MAX_BANDS_PER_COMPONENT_NUM],
                                   int16_t* buffer_in_prev[MAX_BANDS_PER_COMPONENT_NUM], transform_lines_t* lines,
                                   uint32_t precinct_line_idx, int32_t* buffer_tmp, uint32_t precinct_num, uint8_t shift) {
@@ -346,7 +409,8 @@ void new_transform_component_line(const pi_component_t* const component, int16_t
                                        precinct_num,
                                        decom_h,
                                        component->width,
-                                       shift);
+                                       shift,
+                                       lines->output);
         if (precinct_line_idx == 0) {
             lines->line_start = 2;
             if (component->height == 2) {
@@ -377,7 +441,8 @@ void new_transform_component_line(const pi_component_t* const component, int16_t
                                        buffer_tmp,
                                        precinct_num,
                                        (decom_h - 1),
-                                       shift);
+                                       shift,
+                                       lines->output);
         if (precinct_line_idx == 0) {
             lines->line_start = 4;
             if (component->height <= 4) {
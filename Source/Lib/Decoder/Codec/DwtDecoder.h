@@ -12,18 +12,33 @@
 extern "C" {
 #endif
 
+/* Output lines [line_start .. line_stop] of precinct that is not first or last in component,
+ * written by last vertical IDWT level with linear output scaling, see linear_output_scaling_8bit_line_c().
+ */
+typedef struct idwt_output {
+    void* lines[4];
+    uint8_t bw;
+    uint8_t depth;
+} idwt_output_t;
+
 typedef struct transform_lines {
     //buffer_out indexing [line_start .. line_stop]
     uint32_t line_start;
     uint32_t line_stop;
     int32_t offset;
     int32_t* buffer_out[8];
+    //When set, odd lines are written only to output and not to buffer_out
+    const idwt_output_t* output;
 } transform_lines_t;
 
 void new_transform_component_line(const pi_component_t* const component, int16_t* buffer_in[MAX_BANDS_PER_COMPONENT_NUM],
                                   int16_t* buffer_in_prev[MAX_BANDS_PER_COMPONENT_NUM], transform_lines_t* lines,
                                   uint32_t line_idx, int32_t* buffer_tmp, uint32_t precinct_num, uint8_t shift);
 
+void transform_component_line_V0_output_linear(const pi_component_t* const component,
+                                               int16_t* buffer_in[MAX_BANDS_PER_COMPONENT_NUM], int32_t* buffer_lf,
+                                               int32_t* buffer_tmp, void* out, uint8_t shift, uint8_t bw, uint8_t depth);
+
 void new_transform_component_line_recalc(const pi_component_t* const component,
                                          int16_t* buffer_in_prev_2[MAX_BANDS_PER_COMPONENT_NUM],
                                          int16_t* buffer_in_prev_1[MAX_BANDS_PER_COMPONENT_NUM], int32_t** buffer_out,
@@ -50,6 +50,23 @@ void idwt_horizontal_line_lf32_hf16_c(const int32_t* in_lf, const int16_t* in_hf
     }
 }
 
+/* Last horizontal IDWT level with linear output scaling, see linear_output_scaling_8bit_line_c().
+ * Output samples are written directly to the image, so previous even sample is kept in register.
+ */
+void idwt_horizontal_line_lf32_hf16_output_8bit_c(const int32_t* in_lf, const int16_t* in_hf, uint8_t* out, uint32_t len,
+                                                  uint8_t shift, uint8_t bw, uint8_t depth) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    const int32_t even = in_lf[0] - ((((int32_t)in_hf[0] << shift) + 1) >> 1);
+    idwt_horizontal_line_lf32_hf16_output_end(in_lf, in_hf, out, len, 0, even, shift, bw, depth, 0);
+}
+
+void idwt_horizontal_line_lf32_hf16_output_16bit_c(const int32_t* in_lf, const int16_t* in_hf, uint16_t* out, uint32_t len,
+                                                   uint8_t shift, uint8_t bw, uint8_t depth) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    const int32_t even = in_lf[0] - ((((int32_t)in_hf[0] << shift) + 1) >> 1);
+    idwt_horizontal_line_lf32_hf16_output_end(in_lf, in_hf, out, len, 0, even, shift, bw, depth, 1);
+}
+
 void inv_transform_V0_H1(const pi_component_t* const component, int16_t* buff_in[MAX_BANDS_PER_COMPONENT_NUM], int32_t* buf_out,
                          int32_t* buf_out_tmp, uint8_t shift) {
     UNUSED(buf_out_tmp);
@@ -260,6 +277,18 @@ void idwt_vertical_line_c(const int32_t* in_lf, const int32_t* in_hf0, const int
     }
 }
 
+void idwt_vertical_line_output_8bit_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                      uint8_t* out_odd, uint8_t* out_even, uint32_t len, uint8_t bw, uint8_t depth) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    idwt_vertical_line_output_end(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, 0, bw, depth, 0);
+}
+
+void idwt_vertical_line_output_16bit_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                       uint16_t* out_odd, uint16_t* out_even, uint32_t len, uint8_t bw, uint8_t depth) {
+    assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
+    idwt_vertical_line_output_end(in_lf, in_hf0, in_hf1, out, out_odd, out_even, len, 0, bw, depth, 1);
+}
+
 void idwt_vertical_line_recalc_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
                                  uint32_t len, uint32_t precinct_line_idx) {
     assert((len >= 2) && "[idwt_c()] ERROR: Length is too small!");
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include "Pi.h"
+#include "Definitions.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -15,6 +16,59 @@ extern "C" {
 
 void idwt_horizontal_line_lf16_hf16_c(const int16_t* in_lf, const int16_t* in_hf, int32_t* out, uint32_t len, uint8_t shift);
 void idwt_horizontal_line_lf32_hf16_c(const int32_t* in_lf, const int16_t* in_hf, int32_t* out, uint32_t len, uint8_t shift);
+void idwt_horizontal_line_lf32_hf16_output_8bit_c(const int32_t* in_lf, const int16_t* in_hf, uint8_t* out, uint32_t len,
+                                                  uint8_t shift, uint8_t bw, uint8_t depth);
+void idwt_horizontal_line_lf32_hf16_output_16bit_c(const int32_t* in_lf, const int16_t* in_hf, uint16_t* out, uint32_t len,
+                                                   uint8_t shift, uint8_t bw, uint8_t depth);
+
+/* Linear output scaling of single sample, see linear_output_scaling_8bit_line_c().*/
+static INLINE int32_t idwt_output_linear_clamp(int32_t v, int32_t round, int32_t dzeta, int32_t m) {
+    v = (v + round) >> dzeta;
+    return (v > m ? m : v < 0 ? 0 : v);
+}
+
+/* Store sample to 8bit (output_16bit == 0) or 16bit output line.*/
+static INLINE void idwt_output_store(void* out, uint32_t id, int32_t v, uint8_t output_16bit) {
+    if (output_16bit) {
+        ((uint16_t*)out)[id] = (uint16_t)v;
+    }
+    else {
+        ((uint8_t*)out)[id] = (uint8_t)v;
+    }
+}
+
+/* Common scalar part of idwt_horizontal_line_lf32_hf16_output_[8,16]bit kernels, SIMD versions run vector loop before it.
+ * Calculate output samples from even sample id to end of line, even is value of sample id before scaling.
+ */
+static INLINE void idwt_horizontal_line_lf32_hf16_output_end(const int32_t* in_lf, const int16_t* in_hf, void* out, uint32_t len,
+                                                             uint32_t id, int32_t even, uint8_t shift, uint8_t bw, uint8_t depth,
+                                                             uint8_t output_16bit) {
+    const int32_t dzeta = bw - depth;
+    const int32_t round = ((1 << bw) >> 1) + ((1 << dzeta) >> 1);
+    const int32_t m = (1 << depth) - 1;
+    in_lf += id / 2;
+    in_hf += id / 2;
+
+    for (; id + 3 < len; id += 2) {
+        const int32_t hf = (int32_t)in_hf[0] << shift;
+        const int32_t even_next = in_lf[1] - ((hf + ((int32_t)in_hf[1] << shift) + 2) >> 2);
+        idwt_output_store(out, id, idwt_output_linear_clamp(even, round, dzeta, m), output_16bit);
+        idwt_output_store(out, id + 1, idwt_output_linear_clamp(hf + ((even + even_next) >> 1), round, dzeta, m), output_16bit);
+        even = even_next;
+        in_lf++;
+        in_hf++;
+    }
+    const int32_t hf = (int32_t)in_hf[0] << shift;
+    idwt_output_store(out, id, idwt_output_linear_clamp(even, round, dzeta, m), output_16bit);
+    if (len & 1) {
+        const int32_t even_next = in_lf[1] - ((hf + 1) >> 1);
+        idwt_output_store(out, id + 1, idwt_output_linear_clamp(hf + ((even + even_next) >> 1), round, dzeta, m), output_16bit);
+        idwt_output_store(out, id + 2, idwt_output_linear_clamp(even_next, round, dzeta, m), output_16bit);
+    }
+    else { //!(len & 1)
+        idwt_output_store(out, id + 1, idwt_output_linear_clamp(hf + even, round, dzeta, m), output_16bit);
+    }
+}
 
 typedef void (*inv_transform_V0_ptr_t)(const pi_component_t* const component, int16_t* buff_in[MAX_BANDS_PER_COMPONENT_NUM],
                                        int32_t* buf_out, int32_t* buf_out_tmp, uint8_t shift);
@@ -32,6 +86,32 @@ void inv_transform_V0_H5(const pi_component_t* const component, int16_t* buff_in
 void idwt_vertical_line_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4], uint32_t len,
                           int32_t first_precinct, int32_t last_precinct, int32_t height);
 
+/* Vertical IDWT of precinct that is not first or last in component, fused with linear output scaling.
+ * Even line is also stored to out[2] because next precinct need it as out[0], odd line is written only to out_odd.
+ */
+void idwt_vertical_line_output_8bit_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                      uint8_t* out_odd, uint8_t* out_even, uint32_t len, uint8_t bw, uint8_t depth);
+void idwt_vertical_line_output_16bit_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                       uint16_t* out_odd, uint16_t* out_even, uint32_t len, uint8_t bw, uint8_t depth);
+
+/* Common scalar part of idwt_vertical_line_output_[8,16]bit kernels, calculate samples from id to end of line.*/
+static INLINE void idwt_vertical_line_output_end(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1,
+                                                 int32_t* out[4], void* out_odd, void* out_even, uint32_t len, uint32_t id,
+                                                 uint8_t bw, uint8_t depth, uint8_t output_16bit) {
+    const int32_t dzeta = bw - depth;
+    const int32_t round = ((1 << bw) >> 1) + ((1 << dzeta) >> 1);
+    const int32_t m = (1 << depth) - 1;
+    const int32_t* out_0 = out[0];
+    int32_t* out_2 = out[2];
+    for (; id < len; id++) {
+        const int32_t even = in_lf[id] - ((in_hf0[id] + in_hf1[id] + 2) >> 2);
+        const int32_t odd = in_hf0[id] + ((out_0[id] + even) >> 1);
+        out_2[id] = even;
+        idwt_output_store(out_even, id, idwt_output_linear_clamp(even, round, dzeta, m), output_16bit);
+        idwt_output_store(out_odd, id, idwt_output_linear_clamp(odd, round, dzeta, m), output_16bit);
+    }
+}
+
 void idwt_vertical_line_recalc_c(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
                                  uint32_t len, uint32_t precinct_line_idx);
 
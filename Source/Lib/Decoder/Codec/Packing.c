@@ -526,6 +526,8 @@ SvtJxsErrorType_t unpack_precinct(bitstream_reader_t* bitstream, precinct_t* pre
     }
     const uint8_t quantization = read_8_bits(bitstream);
     const uint8_t refinement = read_8_bits(bitstream);
+    prec->quantization = quantization;
+    prec->refinement = refinement;
     const int32_t long_hdr = picture_header_dynamic->hdr_Lh || (!pi->use_short_header);
 
     for (uint32_t band = 0; band < pi->bands_num_all; ++band) {
@@ -848,5 +850,6 @@ SvtJxsErrorType_t unpack_precinct(bitstream_reader_t* bitstream, precinct_t* pre
     }
 
     bitstream_reader_add_padding(bitstream, padding_len_bytes);
+    prec->padding_bytes = (uint32_t)padding_len_bytes;
     return SvtJxsErrorNone;
 }
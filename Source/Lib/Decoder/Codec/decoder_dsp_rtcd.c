@@ -90,11 +90,10 @@
 #define SET_AVX2(ptr, c, avx2)                              SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, 0)
 #define SET_AVX2_AVX512(ptr, c, avx2, avx512)               SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, avx512)
 
-void setup_decoder_rtcd_internal(CPU_FLAGS flags) {
-    /* Avoid check that pointer is set double, after first  setup. */
-    static uint8_t first_call_setup = 1;
-    uint8_t check_pointer_was_set = first_call_setup;
-    first_call_setup = 0;
+void setup_decoder_rtcd(decoder_rtcd_t* rtcd, CPU_FLAGS flags) {
+    /* Table is always resolved from scratch, so check that no pointer is set twice. */
+    uint8_t check_pointer_was_set = 1;
+    memset(rtcd, 0, sizeof(*rtcd));
 #ifdef ARCH_X86_64
     /** Should be done during library initialization,
       but for safe limiting cpu flags again. */
@@ -104,39 +103,81 @@ void setup_decoder_rtcd_internal(CPU_FLAGS flags) {
     (void)flags;
 #endif
 
-    SET_SSE41_AVX2_AVX512(dequant, dequant_c, dequant_sse4_1, NULL, dequant_avx512);
-    SET_AVX2(linear_output_scaling_8bit, linear_output_scaling_8bit_c, linear_output_scaling_8bit_avx2);
-    SET_AVX2_AVX512(linear_output_scaling_8bit_line,
+    SET_SSE41_AVX2_AVX512(rtcd->dequant, dequant_c, dequant_sse4_1, NULL, dequant_avx512);
+    SET_AVX2(rtcd->linear_output_scaling_8bit, linear_output_scaling_8bit_c, linear_output_scaling_8bit_avx2);
+    SET_AVX2_AVX512(rtcd->linear_output_scaling_8bit_line,
                     linear_output_scaling_8bit_line_c,
                     linear_output_scaling_8bit_line_avx2,
                     linear_output_scaling_8bit_line_avx512);
-    SET_AVX2(linear_output_scaling_16bit, linear_output_scaling_16bit_c, linear_output_scaling_16bit_avx2);
-    SET_AVX2_AVX512(linear_output_scaling_16bit_line,
+    SET_AVX2(rtcd->linear_output_scaling_16bit, linear_output_scaling_16bit_c, linear_output_scaling_16bit_avx2);
+    SET_AVX2_AVX512(rtcd->linear_output_scaling_16bit_line,
                     linear_output_scaling_16bit_line_c,
                     linear_output_scaling_16bit_line_avx2,
                     linear_output_scaling_16bit_line_avx512);
 
-    SET_AVX2(inv_sign, inv_sign_c, inv_sign_avx2);
-    SET_AVX2(unpack_data, unpack_data_c, unpack_data_avx2);
-    SET_AVX2_AVX512(idwt_horizontal_line_lf16_hf16,
+    SET_AVX2(rtcd->inv_sign, inv_sign_c, inv_sign_avx2);
+    SET_AVX2(rtcd->unpack_data, unpack_data_c, unpack_data_avx2);
+    SET_AVX2_AVX512(rtcd->idwt_horizontal_line_lf16_hf16,
                     idwt_horizontal_line_lf16_hf16_c,
                     idwt_horizontal_line_lf16_hf16_avx2,
                     idwt_horizontal_line_lf16_hf16_avx512);
-    SET_AVX2_AVX512(idwt_horizontal_line_lf32_hf16,
+    SET_AVX2_AVX512(rtcd->idwt_horizontal_line_lf32_hf16,
                     idwt_horizontal_line_lf32_hf16_c,
                     idwt_horizontal_line_lf32_hf16_avx2,
                     idwt_horizontal_line_lf32_hf16_avx512);
-    SET_AVX2_AVX512(idwt_vertical_line, idwt_vertical_line_c, idwt_vertical_line_avx2, idwt_vertical_line_avx512);
-    SET_AVX2_AVX512(
-        idwt_vertical_line_recalc, idwt_vertical_line_recalc_c, idwt_vertical_line_recalc_avx2, idwt_vertical_line_recalc_avx512);
+    SET_AVX2_AVX512(rtcd->idwt_vertical_line, idwt_vertical_line_c, idwt_vertical_line_avx2, idwt_vertical_line_avx512);
+    SET_AVX2_AVX512(rtcd->idwt_vertical_line_recalc,
+                    idwt_vertical_line_recalc_c,
+                    idwt_vertical_line_recalc_avx2,
+                    idwt_vertical_line_recalc_avx512);
+    SET_AVX2_AVX512(rtcd->idwt_horizontal_line_lf32_hf16_output_8bit,
+                    idwt_horizontal_line_lf32_hf16_output_8bit_c,
+                    idwt_horizontal_line_lf32_hf16_output_8bit_avx2,
+                    idwt_horizontal_line_lf32_hf16_output_8bit_avx512);
+    SET_AVX2_AVX512(rtcd->idwt_horizontal_line_lf32_hf16_output_16bit,
+                    idwt_horizontal_line_lf32_hf16_output_16bit_c,
+                    idwt_horizontal_line_lf32_hf16_output_16bit_avx2,
+                    idwt_horizontal_line_lf32_hf16_output_16bit_avx512);
+    SET_AVX2_AVX512(rtcd->idwt_vertical_line_output_8bit,
+                    idwt_vertical_line_output_8bit_c,
+                    idwt_vertical_line_output_8bit_avx2,
+                    idwt_vertical_line_output_8bit_avx512);
+    SET_AVX2_AVX512(rtcd->idwt_vertical_line_output_16bit,
+                    idwt_vertical_line_output_16bit_c,
+                    idwt_vertical_line_output_16bit_avx2,
+                    idwt_vertical_line_output_16bit_avx512);
 
 #if defined(__aarch64__) || defined(_M_ARM64)
     if (flags & CPU_FLAGS_NEON) {
-        idwt_horizontal_line_lf16_hf16 = idwt_horizontal_line_lf16_hf16_neon;
-        idwt_horizontal_line_lf32_hf16 = idwt_horizontal_line_lf32_hf16_neon;
-        idwt_vertical_line = idwt_vertical_line_neon;
-        idwt_vertical_line_recalc = idwt_vertical_line_recalc_neon;
-        dequant = dequant_neon;
+        rtcd->idwt_horizontal_line_lf16_hf16 = idwt_horizontal_line_lf16_hf16_neon;
+        rtcd->idwt_horizontal_line_lf32_hf16 = idwt_horizontal_line_lf32_hf16_neon;
+        rtcd->idwt_vertical_line = idwt_vertical_line_neon;
+        rtcd->idwt_vertical_line_recalc = idwt_vertical_line_recalc_neon;
+        rtcd->dequant = dequant_neon;
     }
 #endif
 }
+
+void bind_decoder_rtcd(const decoder_rtcd_t* rtcd) {
+    dequant = rtcd->dequant;
+    linear_output_scaling_8bit = rtcd->linear_output_scaling_8bit;
+    linear_output_scaling_16bit = rtcd->linear_output_scaling_16bit;
+    inv_sign = rtcd->inv_sign;
+    unpack_data = rtcd->unpack_data;
+    linear_output_scaling_8bit_line = rtcd->linear_output_scaling_8bit_line;
+    idwt_horizontal_line_lf16_hf16 = rtcd->idwt_horizontal_line_lf16_hf16;
+    idwt_horizontal_line_lf32_hf16 = rtcd->idwt_horizontal_line_lf32_hf16;
+    linear_output_scaling_16bit_line = rtcd->linear_output_scaling_16bit_line;
+    idwt_vertical_line = rtcd->idwt_vertical_line;
+    idwt_vertical_line_recalc = rtcd->idwt_vertical_line_recalc;
+    idwt_horizontal_line_lf32_hf16_output_8bit = rtcd->idwt_horizontal_line_lf32_hf16_output_8bit;
+    idwt_horizontal_line_lf32_hf16_output_16bit = rtcd->idwt_horizontal_line_lf32_hf16_output_16bit;
+    idwt_vertical_line_output_8bit = rtcd->idwt_vertical_line_output_8bit;
+    idwt_vertical_line_output_16bit = rtcd->idwt_vertical_line_output_16bit;
+}
+
+void setup_decoder_rtcd_internal(CPU_FLAGS flags) {
+    decoder_rtcd_t rtcd;
+    setup_decoder_rtcd(&rtcd, flags);
+    bind_decoder_rtcd(&rtcd);
+}
@@ -23,15 +23,48 @@
 
 #undef RTCD_EXTERN
 #ifdef DECODER_RTCD_C
-#define RTCD_EXTERN // CHKN RTCD call in effect. declare the function pointers encHandle.
+#define RTCD_EXTERN RTCD_THREAD_LOCAL // CHKN RTCD call in effect. declare the function pointers encHandle.
 #else
-#define RTCD_EXTERN extern // CHKN run time externing the function pointers.
+#define RTCD_EXTERN extern RTCD_THREAD_LOCAL // CHKN run time externing the function pointers.
 #endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+typedef struct decoder_rtcd {
+    void (*dequant)(uint16_t* buf, uint32_t buf_len, uint8_t* gclis, uint32_t group_size, uint8_t gtli, QUANT_TYPE dq_type);
+    void (*linear_output_scaling_8bit)(const pi_t* const pi, int32_t* comps[MAX_COMPONENTS_NUM], uint32_t bw, uint32_t depth,
+                                       svt_jpeg_xs_image_buffer_t* out);
+    void (*linear_output_scaling_16bit)(const pi_t* const pi, int32_t* comps[MAX_COMPONENTS_NUM], uint32_t bw, uint32_t depth,
+                                        svt_jpeg_xs_image_buffer_t* out);
+    void (*inv_sign)(uint16_t* in_out, uint32_t width);
+    SvtJxsErrorType_t (*unpack_data)(bitstream_reader_t* bitstream, uint16_t* buf, uint32_t w, uint8_t* gclis,
+                                     uint32_t group_size, uint8_t gtli, uint8_t sign_flag, uint8_t* leftover_signs_num,
+                                     int32_t* precinct_bits_left);
+    void (*linear_output_scaling_8bit_line)(int32_t* in, uint32_t bw, uint32_t depth, uint8_t* out, uint32_t w);
+    void (*idwt_horizontal_line_lf16_hf16)(const int16_t* in_lf, const int16_t* in_hf, int32_t* out, uint32_t len, uint8_t shift);
+    void (*idwt_horizontal_line_lf32_hf16)(const int32_t* in_lf, const int16_t* in_hf, int32_t* out, uint32_t len, uint8_t shift);
+    void (*linear_output_scaling_16bit_line)(int32_t* in, uint32_t bw, uint32_t depth, uint16_t* out, uint32_t w);
+    void (*idwt_vertical_line)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4], uint32_t len,
+                               int32_t first_precinct, int32_t last_precinct, int32_t height);
+    void (*idwt_vertical_line_recalc)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                      uint32_t len, uint32_t precinct_line_idx);
+    void (*idwt_horizontal_line_lf32_hf16_output_8bit)(const int32_t* in_lf, const int16_t* in_hf, uint8_t* out, uint32_t len,
+                                                       uint8_t shift, uint8_t bw, uint8_t depth);
+    void (*idwt_horizontal_line_lf32_hf16_output_16bit)(const int32_t* in_lf, const int16_t* in_hf, uint16_t* out, uint32_t len,
+                                                        uint8_t shift, uint8_t bw, uint8_t depth);
+    void (*idwt_vertical_line_output_8bit)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                           uint8_t* out_odd, uint8_t* out_even, uint32_t len, uint8_t bw, uint8_t depth);
+    void (*idwt_vertical_line_output_16bit)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
+                                            uint16_t* out_odd, uint16_t* out_even, uint32_t len, uint8_t bw, uint8_t depth);
+} decoder_rtcd_t;
+
+/* Resolve table for flags, no global state is modified. */
+void setup_decoder_rtcd(decoder_rtcd_t* rtcd, CPU_FLAGS flags);
+/* Bind table to kernel pointers of calling thread. */
+void bind_decoder_rtcd(const decoder_rtcd_t* rtcd);
+/* Resolve and bind on calling thread. */
 void setup_decoder_rtcd_internal(CPU_FLAGS flags);
 
 RTCD_EXTERN void (*dequant)(uint16_t* buf, uint32_t buf_len, uint8_t* gclis, uint32_t group_size, uint8_t gtli,
@@ -56,6 +89,16 @@ RTCD_EXTERN void (*idwt_vertical_line)(const int32_t* in_lf, const int32_t* in_h
                                        uint32_t len, int32_t first_precinct, int32_t last_precinct, int32_t height);
 RTCD_EXTERN void (*idwt_vertical_line_recalc)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1, int32_t* out[4],
                                               uint32_t len, uint32_t precinct_line_idx);
+RTCD_EXTERN void (*idwt_horizontal_line_lf32_hf16_output_8bit)(const int32_t* in_lf, const int16_t* in_hf, uint8_t* out,
+                                                               uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth);
+RTCD_EXTERN void (*idwt_horizontal_line_lf32_hf16_output_16bit)(const int32_t* in_lf, const int16_t* in_hf, uint16_t* out,
+                                                                uint32_t len, uint8_t shift, uint8_t bw, uint8_t depth);
+RTCD_EXTERN void (*idwt_vertical_line_output_8bit)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1,
+                                                   int32_t* out[4], uint8_t* out_odd, uint8_t* out_even, uint32_t len, uint8_t bw,
+                                                   uint8_t depth);
+RTCD_EXTERN void (*idwt_vertical_line_output_16bit)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1,
+                                                    int32_t* out[4], uint16_t* out_odd, uint16_t* out_even, uint32_t len,
+                                                    uint8_t bw, uint8_t depth);
 #ifdef __cplusplus
 } // extern "C"
 #endif
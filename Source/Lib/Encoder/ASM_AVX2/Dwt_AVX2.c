@@ -69,6 +69,152 @@ void dwt_horizontal_line_avx2(int32_t* out_lf, int32_t* out_hf, const int32_t* i
     }
 }
 
+/* Scale 8 pairs of input samples, even sample in low 16 bits and odd sample in high 16 bits of every 32 bits.*/
+static INLINE void input_pairs_avx2(__m256i pairs, __m256i mask, uint8_t shift, __m256i offset, __m256i* even, __m256i* odd) {
+    *even = _mm256_sub_epi32(_mm256_slli_epi32(_mm256_and_si256(pairs, mask), shift), offset);
+    *odd = _mm256_sub_epi32(_mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(pairs, 16), mask), shift), offset);
+}
+
+/* Horizontal DWT for 8 pairs of scaled input samples: in_m2 start 2 samples before in_0 and in_2 start 2 samples after.
+ * High frequency of previous pair is calculated again, so there is no dependency between iterations.
+ */
+static INLINE void dwt_pairs_avx2(__m256i in_m2, __m256i in_m1, __m256i in_0, __m256i in_1, __m256i in_2, __m256i* lf,
+                                  __m256i* hf) {
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i hf_m1 = _mm256_sub_epi32(in_m1, _mm256_srai_epi32(_mm256_add_epi32(in_m2, in_0), 1));
+    *hf = _mm256_sub_epi32(in_1, _mm256_srai_epi32(_mm256_add_epi32(in_0, in_2), 1));
+    *lf = _mm256_add_epi32(in_0, _mm256_srai_epi32(_mm256_add_epi32(_mm256_add_epi32(hf_m1, *hf), two), 2));
+}
+
+static INLINE void dwt_input_pairs_avx2(__m256i pairs_m2, __m256i pairs_0, __m256i pairs_2, __m256i mask, uint8_t shift,
+                                        __m256i offset, __m256i* lf, __m256i* hf) {
+    __m256i in_m2, in_m1, in_0, in_1, in_2, in_3;
+    input_pairs_avx2(pairs_m2, mask, shift, offset, &in_m2, &in_m1);
+    input_pairs_avx2(pairs_0, mask, shift, offset, &in_0, &in_1);
+    input_pairs_avx2(pairs_2, mask, shift, offset, &in_2, &in_3);
+    dwt_pairs_avx2(in_m2, in_m1, in_0, in_1, in_2, lf, hf);
+}
+
+/* Load 8 pairs of input samples from pair id, 8bit input is extended to 16 bits.*/
+static INLINE __m256i load_pairs_avx2(const void* in, uint32_t id, uint8_t input_16bit) {
+    if (input_16bit) {
+        return _mm256_loadu_si256((const __m256i*)((const uint16_t*)in + id * 2));
+    }
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)((const uint8_t*)in + id * 2)));
+}
+
+static INLINE void dwt_horizontal_line_input_avx2(int32_t* out_lf, int32_t* out_hf, const void* in, uint32_t len,
+                                                  uint8_t input_16bit, uint8_t shift, int32_t offset, uint16_t input_mask) {
+    if (!dwt_horizontal_line_input_begin(out_lf, out_hf, in, len, input_16bit, shift, offset, input_mask)) {
+        return;
+    }
+
+    const uint32_t count = ((len - 1) / 2);
+    const __m256i mask = _mm256_set1_epi32(input_mask);
+    const __m256i offset_avx2 = _mm256_set1_epi32(offset);
+
+    uint32_t id = 1;
+    for (; id + 8 < count; id += 8) {
+        __m256i lf, hf;
+        dwt_input_pairs_avx2(load_pairs_avx2(in, id - 1, input_16bit),
+                             load_pairs_avx2(in, id, input_16bit),
+                             load_pairs_avx2(in, id + 1, input_16bit),
+                             mask,
+                             shift,
+                             offset_avx2,
+                             &lf,
+                             &hf);
+        _mm256_storeu_si256((__m256i*)(out_hf + id), hf);
+        _mm256_storeu_si256((__m256i*)(out_lf + id), lf);
+    }
+
+    dwt_horizontal_line_input_end(out_lf, out_hf, in, len, id, input_16bit, shift, offset, input_mask);
+}
+
+void dwt_horizontal_line_input_8bit_avx2(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                         int32_t offset) {
+    dwt_horizontal_line_input_avx2(out_lf, out_hf, in, len, 0, shift, offset, 0xff);
+}
+
+void dwt_horizontal_line_input_16bit_avx2(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                          int32_t offset, uint8_t bit_depth) {
+    dwt_horizontal_line_input_avx2(out_lf, out_hf, in, len, 1, shift, offset, (1 << bit_depth) - 1);
+}
+
+/* 16 pairs of 8bit input samples are 16 bits, even sample in low 8 bits and odd sample in high 8 bits,
+ * so whole DWT is calculated in 16 bits lanes without any shuffle.
+ */
+static INLINE void input_pairs_8bit_int16_avx2(const uint8_t* in, uint8_t shift, __m256i offset, __m256i* even, __m256i* odd) {
+    const __m256i pairs = _mm256_loadu_si256((const __m256i*)in);
+    *even = _mm256_sub_epi16(_mm256_slli_epi16(_mm256_and_si256(pairs, _mm256_set1_epi16(0xff)), shift), offset);
+    *odd = _mm256_sub_epi16(_mm256_slli_epi16(_mm256_srli_epi16(pairs, 8), shift), offset);
+}
+
+void dwt_horizontal_line_int16_input_8bit_avx2(int16_t* out_lf, int16_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                               int16_t offset) {
+    if (!dwt_horizontal_line_int16_input_begin(out_lf, out_hf, in, len, 0, shift, offset, 0xff)) {
+        return;
+    }
+
+    const uint32_t count = ((len - 1) / 2);
+    const __m256i two = _mm256_set1_epi16(2);
+    const __m256i offset_avx2 = _mm256_set1_epi16(offset);
+
+    uint32_t id = 1;
+    for (; id + 16 < count; id += 16) {
+        __m256i in_m2, in_m1, in_0, in_1, in_2, in_3;
+        input_pairs_8bit_int16_avx2(in + id * 2 - 2, shift, offset_avx2, &in_m2, &in_m1);
+        input_pairs_8bit_int16_avx2(in + id * 2, shift, offset_avx2, &in_0, &in_1);
+        input_pairs_8bit_int16_avx2(in + id * 2 + 2, shift, offset_avx2, &in_2, &in_3);
+
+        const __m256i hf_m1 = _mm256_sub_epi16(in_m1, _mm256_srai_epi16(_mm256_add_epi16(in_m2, in_0), 1));
+        const __m256i hf = _mm256_sub_epi16(in_1, _mm256_srai_epi16(_mm256_add_epi16(in_0, in_2), 1));
+        const __m256i lf = _mm256_add_epi16(in_0, _mm256_srai_epi16(_mm256_add_epi16(_mm256_add_epi16(hf_m1, hf), two), 2));
+        _mm256_storeu_si256((__m256i*)(out_hf + id), hf);
+        _mm256_storeu_si256((__m256i*)(out_lf + id), lf);
+    }
+
+    dwt_horizontal_line_int16_input_end(out_lf, out_hf, in, len, id, 0, shift, offset, 0xff);
+}
+
+/* For 16bit input calculate in 32 bits lanes like dwt_horizontal_line_input_16bit_avx2() and pack output to 16 bits.*/
+void dwt_horizontal_line_int16_input_16bit_avx2(int16_t* out_lf, int16_t* out_hf, const uint16_t* in, uint32_t len,
+                                                uint8_t shift, int16_t offset, uint8_t bit_depth) {
+    const uint16_t input_mask = (1 << bit_depth) - 1;
+    if (!dwt_horizontal_line_int16_input_begin(out_lf, out_hf, in, len, 1, shift, offset, input_mask)) {
+        return;
+    }
+
+    const uint32_t count = ((len - 1) / 2);
+    const __m256i mask = _mm256_set1_epi32(input_mask);
+    const __m256i offset_avx2 = _mm256_set1_epi32(offset);
+
+    uint32_t id = 1;
+    for (; id + 16 < count; id += 16) {
+        __m256i lf_A, hf_A, lf_B, hf_B;
+        dwt_input_pairs_avx2(load_pairs_avx2(in, id - 1, 1),
+                             load_pairs_avx2(in, id, 1),
+                             load_pairs_avx2(in, id + 1, 1),
+                             mask,
+                             shift,
+                             offset_avx2,
+                             &lf_A,
+                             &hf_A);
+        dwt_input_pairs_avx2(load_pairs_avx2(in, id + 7, 1),
+                             load_pairs_avx2(in, id + 8, 1),
+                             load_pairs_avx2(in, id + 9, 1),
+                             mask,
+                             shift,
+                             offset_avx2,
+                             &lf_B,
+                             &hf_B);
+        _mm256_storeu_si256((__m256i*)(out_hf + id), _mm256_permute4x64_epi64(_mm256_packs_epi32(hf_A, hf_B), 0xd8));
+        _mm256_storeu_si256((__m256i*)(out_lf + id), _mm256_permute4x64_epi64(_mm256_packs_epi32(lf_A, lf_B), 0xd8));
+    }
+
+    dwt_horizontal_line_int16_input_end(out_lf, out_hf, in, len, id, 1, shift, offset, input_mask);
+}
+
 /*Optimization Vertical lines loops to AVX*/
 void transform_vertical_loop_hf_line_0_avx2(uint32_t width, int32_t* out_hf, const int32_t* line_0, const int32_t* line_1) {
     uint32_t i = 0;
@@ -13,6 +13,14 @@ extern "C" {
 #endif
 
 void dwt_horizontal_line_avx2(int32_t* out_lf, int32_t* out_hf, const int32_t* in, uint32_t len);
+void dwt_horizontal_line_input_8bit_avx2(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                         int32_t offset);
+void dwt_horizontal_line_input_16bit_avx2(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                          int32_t offset, uint8_t bit_depth);
+void dwt_horizontal_line_int16_input_8bit_avx2(int16_t* out_lf, int16_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                               int16_t offset);
+void dwt_horizontal_line_int16_input_16bit_avx2(int16_t* out_lf, int16_t* out_hf, const uint16_t* in, uint32_t len,
+                                                uint8_t shift, int16_t offset, uint8_t bit_depth);
 
 /*Optimization Vertical lines loops to AVX*/
 void transform_vertical_loop_hf_line_0_avx2(uint32_t width, int32_t* out_hf, const int32_t* line_0, const int32_t* line_1);
@@ -124,3 +124,41 @@ void linear_input_scaling_line_16bit_avx2(const uint16_t* src, int32_t* dst, uin
         dst[i] = ((src[i] & input_mask) << shift) - offset;
     }
 }
+
+void image_shift_int16_avx2(uint16_t* out_coeff_16bit, const int16_t* in_coeff_16bit, uint32_t width, int32_t shift,
+                            int32_t offset) {
+    const __m256i offset_avx2 = _mm256_set1_epi16((int16_t)offset);
+    const __m256i sign_mask_epi16 = _mm256_set1_epi16((int16_t)BITSTREAM_MASK_SIGN);
+    const __m256i zero = _mm256_setzero_si256();
+    const uint32_t simd_batch = width / 16;
+    const uint32_t remaining = width % 16;
+
+    for (uint32_t i = 0; i < simd_batch; i++) {
+        __m256i data = _mm256_loadu_si256((__m256i*)in_coeff_16bit);
+        __m256i sign = _mm256_and_si256(data, sign_mask_epi16);
+
+        data = _mm256_abs_epi16(data);
+        data = _mm256_add_epi16(data, offset_avx2);
+        data = _mm256_srli_epi16(data, shift);
+        sign = _mm256_and_si256(sign, _mm256_cmpgt_epi16(data, zero));
+        data = _mm256_or_si256(data, sign);
+
+        _mm256_storeu_si256((__m256i*)out_coeff_16bit, data);
+        in_coeff_16bit += 16;
+        out_coeff_16bit += 16;
+    }
+
+    for (uint32_t i = 0; i < remaining; i++) {
+        int32_t val = in_coeff_16bit[i];
+        if (val >= 0) {
+            val = (val + offset) >> shift;
+        }
+        else {
+            val = ((-val + offset) >> shift);
+            if (val) {
+                val |= BITSTREAM_MASK_SIGN;
+            }
+        }
+        out_coeff_16bit[i] = val;
+    }
+}
@@ -240,6 +240,99 @@ void linear_input_scaling_line_16bit_avx512(const uint16_t* src, int32_t* dst, u
     }
 }
 
+/* Scale 16 pairs of input samples, even sample in low 16 bits and odd sample in high 16 bits of every 32 bits.*/
+static INLINE void input_pairs_avx512(__m512i pairs, __m512i mask, uint8_t shift, __m512i offset, __m512i* even, __m512i* odd) {
+    *even = _mm512_sub_epi32(_mm512_slli_epi32(_mm512_and_si512(pairs, mask), shift), offset);
+    *odd = _mm512_sub_epi32(_mm512_slli_epi32(_mm512_and_si512(_mm512_srli_epi32(pairs, 16), mask), shift), offset);
+}
+
+/* High frequency of previous pair is taken from last lane of previous iteration.*/
+static INLINE void dwt_input_pairs_avx512(__m512i pairs_0, __m512i pairs_2, __m512i mask, uint8_t shift, __m512i offset,
+                                          __m512i* lf, __m512i* hf) {
+    const __m512i two = _mm512_set1_epi32(2);
+    __m512i in_0, in_1, in_2, in_3;
+    input_pairs_avx512(pairs_0, mask, shift, offset, &in_0, &in_1);
+    input_pairs_avx512(pairs_2, mask, shift, offset, &in_2, &in_3);
+
+    const __m512i hf_m1 = *hf;
+    *hf = _mm512_sub_epi32(in_1, _mm512_srai_epi32(_mm512_add_epi32(in_0, in_2), 1));
+    const __m512i hf_prev = _mm512_alignr_epi32(*hf, hf_m1, 15);
+    *lf = _mm512_add_epi32(in_0, _mm512_srai_epi32(_mm512_add_epi32(_mm512_add_epi32(hf_prev, *hf), two), 2));
+}
+
+/* Load 16 pairs of input samples from pair id, 8bit input is extended to 16 bits.*/
+static INLINE __m512i load_pairs_avx512(const void* in, uint32_t id, uint8_t input_16bit) {
+    if (input_16bit) {
+        return _mm512_loadu_si512((const __m512i*)((const uint16_t*)in + id * 2));
+    }
+    return _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)((const uint8_t*)in + id * 2)));
+}
+
+static INLINE void dwt_horizontal_line_input_avx512(int32_t* out_lf, int32_t* out_hf, const void* in, uint32_t len,
+                                                    uint8_t input_16bit, uint8_t shift, int32_t offset, uint16_t input_mask) {
+    if (!dwt_horizontal_line_input_begin(out_lf, out_hf, in, len, input_16bit, shift, offset, input_mask)) {
+        return;
+    }
+
+    const uint32_t count = ((len - 1) / 2);
+    const __m512i mask = _mm512_set1_epi32(input_mask);
+    const __m512i offset_avx512 = _mm512_set1_epi32(offset);
+
+    uint32_t id = 1;
+    __m512i lf, hf = _mm512_set1_epi32(out_hf[0]);
+    for (; id + 16 < count; id += 16) {
+        dwt_input_pairs_avx512(load_pairs_avx512(in, id, input_16bit),
+                               load_pairs_avx512(in, id + 1, input_16bit),
+                               mask,
+                               shift,
+                               offset_avx512,
+                               &lf,
+                               &hf);
+        _mm512_storeu_si512((__m512i*)(out_hf + id), hf);
+        _mm512_storeu_si512((__m512i*)(out_lf + id), lf);
+    }
+
+    dwt_horizontal_line_input_end(out_lf, out_hf, in, len, id, input_16bit, shift, offset, input_mask);
+}
+
+void dwt_horizontal_line_input_8bit_avx512(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                           int32_t offset) {
+    dwt_horizontal_line_input_avx512(out_lf, out_hf, in, len, 0, shift, offset, 0xff);
+}
+
+void dwt_horizontal_line_input_16bit_avx512(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                            int32_t offset, uint8_t bit_depth) {
+    dwt_horizontal_line_input_avx512(out_lf, out_hf, in, len, 1, shift, offset, (1 << bit_depth) - 1);
+}
+
+void image_shift_int16_avx512(uint16_t* out_coeff_16bit, const int16_t* in_coeff_16bit, uint32_t width, int32_t shift,
+                              int32_t offset) {
+    const __m512i offset_avx512 = _mm512_set1_epi16((int16_t)offset);
+    const __m512i sign_mask_epi16 = _mm512_set1_epi16((int16_t)BITSTREAM_MASK_SIGN);
+    const __m512i zero = _mm512_setzero_si512();
+    const uint32_t simd_batch = width / 32;
+    const uint32_t remaining = width % 32;
+
+    for (uint32_t i = 0; i < simd_batch; i++) {
+        __m512i data = _mm512_loadu_si512((__m512i*)in_coeff_16bit);
+        __m512i sign = _mm512_and_si512(data, sign_mask_epi16);
+
+        data = _mm512_abs_epi16(data);
+        data = _mm512_add_epi16(data, offset_avx512);
+        data = _mm512_srli_epi16(data, shift);
+        __mmask32 mask = _mm512_cmpgt_epi16_mask(data, zero);
+        data = _mm512_or_si512(data, _mm512_maskz_mov_epi16(mask, sign));
+
+        _mm512_storeu_si512((__m512i*)out_coeff_16bit, data);
+        in_coeff_16bit += 32;
+        out_coeff_16bit += 32;
+    }
+
+    if (remaining) {
+        image_shift_int16_avx2(out_coeff_16bit, in_coeff_16bit, remaining, shift, offset);
+    }
+}
+
 /*Optimization Vertical lines loops to AVX*/
 void transform_vertical_loop_hf_line_0_avx512(uint32_t width, int32_t* out_hf, const int32_t* line_0, const int32_t* line_1) {
     uint32_t i = 0;
@@ -18,6 +18,12 @@ void linear_input_scaling_line_8bit_avx512(const uint8_t* src, int32_t* dst, uin
 void linear_input_scaling_line_16bit_avx512(const uint16_t* src, int32_t* dst, uint32_t w, uint8_t shift, int32_t offset,
                                             uint8_t bit_depth);
 void image_shift_avx512(uint16_t* out_coeff_16bit, int32_t* in_coeff_32bit, uint32_t width, int32_t shift, int32_t offset);
+void dwt_horizontal_line_input_8bit_avx512(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                           int32_t offset);
+void dwt_horizontal_line_input_16bit_avx512(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                            int32_t offset, uint8_t bit_depth);
+void image_shift_int16_avx512(uint16_t* out_coeff_16bit, const int16_t* in_coeff_16bit, uint32_t width, int32_t shift,
+                              int32_t offset);
 
 /*Optimization Vertical lines loops to AVX*/
 void transform_vertical_loop_hf_line_0_avx512(uint32_t width, int32_t* out_hf, const int32_t* line_0, const int32_t* line_1);
@@ -0,0 +1,107 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include "CoeffSlice.h"
+#include "Encoder.h"
+
+static void coeff_slice_dctor(void_ptr p) {
+    CoeffSlice_t* obj = (CoeffSlice_t*)p;
+    pi_t* pi = &obj->enc_common->pi;
+    for (uint32_t c = 0; c < pi->comps_num; ++c) {
+        if (pi->components[c].decom_v == 1 || pi->components[c].decom_v == 2) {
+            SVT_FREE_ALIGNED_ARRAY(obj->coeff_buff_ptr_16bit[c]);
+        }
+    }
+}
+
+static SvtJxsErrorType_t coeff_slice_ctor(CoeffSlice_t* obj, void_ptr object_init_data_ptr) {
+    svt_jpeg_xs_encoder_common_t* enc_common = (svt_jpeg_xs_encoder_common_t*)object_init_data_ptr;
+    pi_t* pi = &enc_common->pi;
+    pi_enc_t* pi_enc = &enc_common->pi_enc;
+
+    obj->dctor = coeff_slice_dctor;
+    obj->enc_common = enc_common;
+
+    for (uint32_t c = 0; c < pi->comps_num; ++c) {
+        obj->coeff_buff_ptr_16bit[c] = NULL;
+        if (pi->components[c].decom_v == 1 || pi->components[c].decom_v == 2) {
+            SVT_MALLOC_ALIGNED_ARRAY(obj->coeff_buff_ptr_16bit[c],
+                                     (size_t)pi_enc->coeff_buff_tmp_size_precinct[c] * pi->precincts_per_slice);
+        }
+    }
+    return SvtJxsErrorNone;
+}
+
+SvtJxsErrorType_t coeff_slice_creator(void_ptr* object_dbl_ptr, void_ptr object_init_data_ptr) {
+    CoeffSlice_t* obj;
+
+    *object_dbl_ptr = NULL;
+    SVT_NEW(obj, coeff_slice_ctor, object_init_data_ptr);
+    *object_dbl_ptr = obj;
+
+    return SvtJxsErrorNone;
+}
+
+/*Tickets wrap to non negative values, negative value of next ticket wakes waiting threads on shutdown.*/
+static INLINE int32_t coeff_slice_ring_ticket_next(int32_t ticket) {
+    return (int32_t)(((uint32_t)ticket + 1) & INT32_MAX);
+}
+
+static void coeff_slice_ring_dctor(void_ptr p) {
+    CoeffSliceRing_t* obj = (CoeffSliceRing_t*)p;
+    svt_jxs_free_cond_var(&obj->next_ticket);
+}
+
+SvtJxsErrorType_t coeff_slice_ring_ctor(CoeffSliceRing_t* obj, SystemResource_t* coeff_slice_pool_ptr) {
+    obj->dctor = coeff_slice_ring_dctor;
+    obj->empty_fifo_ptr = svt_jxs_system_resource_get_producer_fifo(coeff_slice_pool_ptr, 0);
+    obj->tickets_issued = 0;
+    obj->taking = 0;
+    obj->quit = 0;
+    return svt_jxs_create_cond_var(&obj->next_ticket);
+}
+
+int32_t coeff_slice_ring_ticket(CoeffSliceRing_t* obj) {
+    int32_t ticket = obj->tickets_issued;
+    obj->tickets_issued = coeff_slice_ring_ticket_next(ticket);
+    return ticket;
+}
+
+SvtJxsErrorType_t coeff_slice_ring_get(CoeffSliceRing_t* obj, int32_t ticket, ObjectWrapper_t* volatile* wrapper_dbl_ptr) {
+    while (*wrapper_dbl_ptr == NULL) {
+        if (svt_jxs_atomic_load_i32(&obj->quit)) {
+            return SvtJxsErrorNoErrorFifoShutdown;
+        }
+        int32_t next_ticket = svt_jxs_atomic_load_i32(&obj->next_ticket.val);
+        int32_t expected = 0;
+        if (next_ticket == ticket && svt_jxs_atomic_cas_i32(&obj->taking, &expected, 1)) {
+            /*Other component could take buffer and move ticket between load and CAS.*/
+            if (*wrapper_dbl_ptr != NULL) {
+                svt_jxs_atomic_store_i32(&obj->taking, 0);
+                continue;
+            }
+            ObjectWrapper_t* wrapper_ptr = NULL;
+            SvtJxsErrorType_t ret = svt_jxs_get_empty_object(obj->empty_fifo_ptr, &wrapper_ptr);
+            *wrapper_dbl_ptr = wrapper_ptr;
+            /*Threads that lost CAS wait for move of ticket, so flag is cleared before ticket is moved.*/
+            svt_jxs_atomic_store_i32(&obj->taking, 0);
+            if (ret != SvtJxsErrorNone) {
+                return ret;
+            }
+            svt_jxs_set_cond_var(&obj->next_ticket, coeff_slice_ring_ticket_next(ticket));
+        }
+        else if (next_ticket == ticket || *wrapper_dbl_ptr == NULL) {
+            /*Buffer is set before ticket is moved, so ticket of slice without buffer is not served yet.*/
+            svt_jxs_wait_cond_var(&obj->next_ticket, next_ticket);
+        }
+    }
+    return SvtJxsErrorNone;
+}
+
+void coeff_slice_ring_shutdown(CoeffSliceRing_t* obj) {
+    svt_jxs_atomic_store_i32(&obj->quit, 1);
+    svt_jxs_set_cond_var(&obj->next_ticket, -1);
+}
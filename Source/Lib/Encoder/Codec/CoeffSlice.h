@@ -0,0 +1,58 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _COEFF_SLICE_H_
+#define _COEFF_SLICE_H_
+
+#include "Definitions.h"
+#include "Threads/SvtObject.h"
+#include "Threads/SystemResourceManager.h"
+#include "Threads/SvtThreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************
+ * Coefficients of one slice, written by DWT Stage and read by Pack Stage.
+ * Used only in profile: CPU, buffers are recycled after Pack Stage finish slice.
+ **************************************/
+typedef struct CoeffSlice {
+    DctorCall dctor;
+    struct svt_jpeg_xs_encoder_common *enc_common;
+    uint16_t *coeff_buff_ptr_16bit[MAX_COMPONENTS_NUM]; //Only for components with vertical decomposition
+} CoeffSlice_t;
+
+/**************************************
+ * Ring of slice coefficient buffers. Buffer is taken by first DWT Stage thread that reach slice,
+ * slices take buffers in order of tickets given by Init Stage, so slice never waits for buffer held by later slice.
+ * Ring smaller than frame works only when every component with vertical decomposition has own DWT Stage thread.
+ **************************************/
+typedef struct CoeffSliceRing {
+    DctorCall dctor;
+    Fifo_t *empty_fifo_ptr;
+    int32_t tickets_issued;  //Written only by Init Stage
+    CondVar next_ticket;     //Ticket of slice that can take next buffer
+    volatile int32_t taking; //Set when thread take buffer for next_ticket
+    volatile int32_t quit;
+} CoeffSliceRing_t;
+
+/**************************************
+ * Extern Function Declarations
+ **************************************/
+extern SvtJxsErrorType_t coeff_slice_creator(void_ptr *object_dbl_ptr, void_ptr object_init_data_ptr);
+extern SvtJxsErrorType_t coeff_slice_ring_ctor(CoeffSliceRing_t *obj, SystemResource_t *coeff_slice_pool_ptr);
+/*Ticket of next slice, slices of frames have to get tickets in order of encoding.*/
+extern int32_t coeff_slice_ring_ticket(CoeffSliceRing_t *obj);
+/*Wait for turn of ticket and free buffer, return buffer already taken for slice by other component.*/
+extern SvtJxsErrorType_t coeff_slice_ring_get(CoeffSliceRing_t *obj, int32_t ticket, ObjectWrapper_t *volatile *wrapper_dbl_ptr);
+/*Wake threads waiting for buffers on encoder close.*/
+extern void coeff_slice_ring_shutdown(CoeffSliceRing_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_COEFF_SLICE_H_*/
@@ -7,6 +7,8 @@
 #include <assert.h>
 #include "encoder_dsp_rtcd.h"
 #include "NltEnc.h"
+#include "SvtUtility.h"
+#include <string.h>
 
 /* Cacluate Horizontal DWT for one line.
  * For one line stride is not required, becasue in line step is always 1.
@@ -39,6 +41,79 @@ void dwt_horizontal_line_c(int32_t* out_lf, int32_t* out_hf, const int32_t* in,
     }
 }
 
+/* Linear input scaling of 8bit input and Horizontal DWT for one line in one pass,
+ * the same like linear_input_scaling_line_8bit_c() and dwt_horizontal_line_c().
+ */
+void dwt_horizontal_line_input_8bit_c(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                      int32_t offset) {
+    assert((len >= 2) && "[dwt_horizontal_line_input_8bit_c()] ERROR: Length is too small!");
+    if (dwt_horizontal_line_input_begin(out_lf, out_hf, in, len, 0, shift, offset, 0xff)) {
+        dwt_horizontal_line_input_end(out_lf, out_hf, in, len, 1, 0, shift, offset, 0xff);
+    }
+}
+
+/* Linear input scaling of 16bit input and Horizontal DWT for one line in one pass,
+ * the same like linear_input_scaling_line_16bit_c() and dwt_horizontal_line_c().
+ */
+void dwt_horizontal_line_input_16bit_c(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                       int32_t offset, uint8_t bit_depth) {
+    assert((len >= 2) && "[dwt_horizontal_line_input_16bit_c()] ERROR: Length is too small!");
+    const uint16_t mask = (1 << bit_depth) - 1;
+    if (dwt_horizontal_line_input_begin(out_lf, out_hf, in, len, 1, shift, offset, mask)) {
+        dwt_horizontal_line_input_end(out_lf, out_hf, in, len, 1, 1, shift, offset, mask);
+    }
+}
+
+/* Linear input scaling of 8bit input and Horizontal DWT for one line in 16 bits,
+ * caller have to guarantee that calculation not overflow 16 bits, see dwt_16bit_params_init().
+ */
+void dwt_horizontal_line_int16_input_8bit_c(int16_t* out_lf, int16_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                            int16_t offset) {
+    assert((len >= 2) && "[dwt_horizontal_line_int16_input_8bit_c()] ERROR: Length is too small!");
+    if (dwt_horizontal_line_int16_input_begin(out_lf, out_hf, in, len, 0, shift, offset, 0xff)) {
+        dwt_horizontal_line_int16_input_end(out_lf, out_hf, in, len, 1, 0, shift, offset, 0xff);
+    }
+}
+
+/* Linear input scaling of 16bit input and Horizontal DWT for one line in 16 bits,
+ * caller have to guarantee that calculation not overflow 16 bits, see dwt_16bit_params_init().
+ */
+void dwt_horizontal_line_int16_input_16bit_c(int16_t* out_lf, int16_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                             int16_t offset, uint8_t bit_depth) {
+    assert((len >= 2) && "[dwt_horizontal_line_int16_input_16bit_c()] ERROR: Length is too small!");
+    const uint16_t mask = (1 << bit_depth) - 1;
+    if (dwt_horizontal_line_int16_input_begin(out_lf, out_hf, in, len, 1, shift, offset, mask)) {
+        dwt_horizontal_line_int16_input_end(out_lf, out_hf, in, len, 1, 1, shift, offset, mask);
+    }
+}
+
+/* Check if first horizontal DWT level can be calculated in 16 bits bit exact with 32 bits.
+ * Linear input of depth B is X = (v << (Bw - B)) - 2^(Bw - 1), 16 bit input is Y = X >> k.
+ * When Y keep at least 3 zero LSB (Bw - B - k >= 3) then rounding of first level (>> 1 for high pass
+ * and (+ 2) >> 2 for low pass) not drop any bit and 16 bit output is exactly 32 bit output >> k.
+ * |Y| <= 2^(Bw - 1 - k) <= 2^13 keep sum of two high pass samples in 16 bits.
+ * k <= Fq allow to get coefficients directly from 16 bit output.
+ * For default Bw = 20, Fq = 8 that is true for input 8 bit (k = 8) and 10 bit (k = 7).
+ */
+void dwt_16bit_params_init(dwt_16bit_params_t* params, const picture_header_dynamic_t* picture_hdr, uint8_t input_bit_depth) {
+    memset(params, 0, sizeof(*params));
+    const int32_t Bw = picture_hdr->hdr_Bw;
+    const int32_t Fq = picture_hdr->hdr_Fq;
+    if (picture_hdr->hdr_Tnlt != 0 || input_bit_depth == 0 || input_bit_depth > Bw) {
+        return;
+    }
+    const int32_t k = MIN(Fq, Bw - input_bit_depth - 3);
+    if (k < 1 || (Bw - 1 - k) > 13) {
+        return;
+    }
+    params->enable = 1;
+    params->shift_in = (uint8_t)(Bw - input_bit_depth - k);
+    params->offset_in = (int16_t)(1 << (Bw - 1 - k));
+    params->shift_32bit = (uint8_t)k;
+    params->shift_out = (uint8_t)(Fq - k);
+    params->offset_out = params->shift_out ? (int16_t)(1 << (params->shift_out - 1)) : 0;
+}
+
 transform_V0_ptr_t transform_V0_get_function_ptr(uint8_t decom_h) {
     transform_V0_ptr_t ptrs[] = {NULL, transform_V0_H1, transform_V0_H2, transform_V0_H3, transform_V0_H4, transform_V0_H5};
     if (decom_h < sizeof(ptrs) / sizeof(ptrs[0])) {
@@ -83,8 +158,7 @@ void transform_V0_H1(const pi_component_t* const component, const pi_enc_compone
         image_shift(out_ptr_lf, buffer_tmp, width_0, shift_out, offset_out);
     }
     else {
-        nlt_input_scaling_line(buff_in, buffer_tmp, width, picture_hdr, input_bit_depth);
-        dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width);
+        nlt_input_dwt_horizontal_line(buff_in, buffer_tmp, out32_bit, width, picture_hdr, input_bit_depth);
         image_shift(out_ptr_hf, out32_bit, width_1, shift_out, offset_out);
         image_shift(out_ptr_lf, buffer_tmp, width_0, shift_out, offset_out);
     }
@@ -121,8 +195,7 @@ void transform_V0_H2(const pi_component_t* const component, const pi_enc_compone
         image_shift(out_ptr_0, buffer_tmp, width_0, shift_out, offset_out);
     }
     else {
-        nlt_input_scaling_line(buff_in, buffer_tmp, width, picture_hdr, input_bit_depth);
-        dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width);
+        nlt_input_dwt_horizontal_line(buff_in, buffer_tmp, out32_bit, width, picture_hdr, input_bit_depth);
         image_shift(out_ptr_2, out32_bit, width_2, shift_out, offset_out);
         dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width_01);
         image_shift(out_ptr_1, out32_bit, width_1, shift_out, offset_out);
@@ -166,8 +239,7 @@ void transform_V0_H3(const pi_component_t* const component, const pi_enc_compone
         image_shift(out_ptr_0, buffer_tmp, width_0, shift_out, offset_out);
     }
     else {
-        nlt_input_scaling_line(buff_in, buffer_tmp, width, picture_hdr, input_bit_depth);
-        dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width);
+        nlt_input_dwt_horizontal_line(buff_in, buffer_tmp, out32_bit, width, picture_hdr, input_bit_depth);
         image_shift(out_ptr_3, out32_bit, width_3, shift_out, offset_out);
         dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width_012);
         image_shift(out_ptr_2, out32_bit, width_2, shift_out, offset_out);
@@ -218,8 +290,7 @@ void transform_V0_H4(const pi_component_t* const component, const pi_enc_compone
         image_shift(out_ptr_0, buffer_tmp, width_0, shift_out, offset_out);
     }
     else {
-        nlt_input_scaling_line(buff_in, buffer_tmp, width, picture_hdr, input_bit_depth);
-        dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width);
+        nlt_input_dwt_horizontal_line(buff_in, buffer_tmp, out32_bit, width, picture_hdr, input_bit_depth);
         image_shift(out_ptr_4, out32_bit, width_4, shift_out, offset_out);
         dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width_0123);
         image_shift(out_ptr_3, out32_bit, width_3, shift_out, offset_out);
@@ -277,8 +348,7 @@ void transform_V0_H5(const pi_component_t* const component, const pi_enc_compone
         image_shift(out_ptr_0, buffer_tmp, width_0, shift_out, offset_out);
     }
     else {
-        nlt_input_scaling_line(buff_in, buffer_tmp, width, picture_hdr, input_bit_depth);
-        dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width);
+        nlt_input_dwt_horizontal_line(buff_in, buffer_tmp, out32_bit, width, picture_hdr, input_bit_depth);
         image_shift(out_ptr_5, out32_bit, width_5, shift_out, offset_out);
         dwt_horizontal_line(buffer_tmp, out32_bit, buffer_tmp, width_01234);
         image_shift(out_ptr_4, out32_bit, width_4, shift_out, offset_out);
@@ -292,6 +362,56 @@ void transform_V0_H5(const pi_component_t* const component, const pi_enc_compone
     }
 }
 
+/*DWT Calculate Precinct 1 line for Vertical 0 Horizontal X, first horizontal level in 16 bits, and convert output to 16bit.
+ * Output is bit exact with transform_V0_H[1,2,3,4,5](), next levels are calculated by transform_V0_H[1,2,3,4]().
+ * buff_in              - Pointer on 8 or 16bit input line
+ * input_bit_depth      - Input bit depth
+ * params               - Parameters of 16 bit path, have to be enabled
+ * width                - Width of line, minimum DWT_16BIT_WIDTH_MIN
+ * buffer_tmp           - Temp buffer, required size: (1.5 * width) == (3*width/2)
+ */
+void transform_V0_Hx_16bit(const pi_component_t* const component, const pi_enc_component_t* const component_enc,
+                           const void* buff_in, uint8_t input_bit_depth, const dwt_16bit_params_t* params,
+                           uint16_t* buffer_out_16bit, uint8_t param_out_Fq, uint32_t width, int32_t* buffer_tmp) {
+    const uint8_t decom_h = component->decom_h;
+    assert(params->enable && input_bit_depth);
+    assert((width >= DWT_16BIT_WIDTH_MIN) && "[transform_V0_Hx_16bit()] ERROR: Length is too small!");
+    assert(decom_h >= 1 && component->bands_num >= (uint32_t)decom_h + 1);
+    assert(component_enc->bands[0].coeff_buff_tmp_pos_offset_16bit == 0);
+    const uint32_t width_lf = width - component->bands[decom_h].width;
+    const uint32_t width_hf = component->bands[decom_h].width;
+
+    /*buffer_tmp 1 line size 3*width/2, low frequency of next levels in 32 bits on begin,
+     *16 bit low frequency and high frequency after it.*/
+    int16_t* line_16bit = (int16_t*)buffer_tmp + 2 * width_lf;
+    int16_t* hf_16bit = line_16bit + width_lf;
+
+    uint16_t* out_ptr_hf = buffer_out_16bit + component_enc->bands[decom_h].coeff_buff_tmp_pos_offset_16bit;
+
+    if (input_bit_depth <= 8) {
+        dwt_horizontal_line_int16_input_8bit(
+            line_16bit, hf_16bit, (const uint8_t*)buff_in, width, params->shift_in, params->offset_in);
+    }
+    else {
+        dwt_horizontal_line_int16_input_16bit(
+            line_16bit, hf_16bit, (const uint16_t*)buff_in, width, params->shift_in, params->offset_in, input_bit_depth);
+    }
+    image_shift_int16(out_ptr_hf, hf_16bit, width_hf, params->shift_out, params->offset_out);
+    if (decom_h == 1) {
+        image_shift_int16(buffer_out_16bit, line_16bit, width_lf, params->shift_out, params->offset_out);
+        return;
+    }
+
+    /*Next levels in 32 bits.*/
+    for (uint32_t i = 0; i < width_lf; i++) {
+        buffer_tmp[i] = (int32_t)line_16bit[i] << params->shift_32bit;
+    }
+    transform_V0_ptr_t transform_V0_Hn_sub_1 = transform_V0_get_function_ptr(decom_h - 1);
+    assert(transform_V0_Hn_sub_1 != NULL);
+    transform_V0_Hn_sub_1(
+        component, component_enc, buffer_tmp, 0, NULL, buffer_out_16bit, param_out_Fq, width_lf, buffer_tmp + width_lf);
+}
+
 /*DWT horizontal 1 time for High Frequency (down part) after Vertical transofrmation with convert output to 16bit
  * component            - Info about DWT component
  * component_enc        - Info about DWT component
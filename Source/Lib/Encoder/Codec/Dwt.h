@@ -9,12 +9,126 @@
 #include <stdint.h>
 #include "Pi.h"
 #include "PiEnc.h"
+#include "Definitions.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 void dwt_horizontal_line_c(int32_t* out_lf, int32_t* out_hf, const int32_t* in, uint32_t len);
+void dwt_horizontal_line_input_8bit_c(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                      int32_t offset);
+void dwt_horizontal_line_input_16bit_c(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                       int32_t offset, uint8_t bit_depth);
+void dwt_horizontal_line_int16_input_8bit_c(int16_t* out_lf, int16_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift,
+                                            int16_t offset);
+void dwt_horizontal_line_int16_input_16bit_c(int16_t* out_lf, int16_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift,
+                                             int16_t offset, uint8_t bit_depth);
+
+/*Minimum width of line to calculate first horizontal DWT level in 16 bits.*/
+#define DWT_16BIT_WIDTH_MIN 16
+
+/*Parameters of first horizontal DWT level calculated in 16 bits, see dwt_16bit_params_init().
+ * 16 bit input is 32 bit wavelet input (Bw) shifted right by shift_32bit.
+ */
+typedef struct dwt_16bit_params {
+    uint8_t enable;      /*Input range allow to calculate first level in 16 bits bit exact with 32 bits*/
+    uint8_t shift_in;    /*Shift of input sample to 16 bit DWT input*/
+    int16_t offset_in;   /*Offset of 16 bit DWT input*/
+    uint8_t shift_32bit; /*Shift of 16 bit DWT output to 32 bit wavelet domain*/
+    uint8_t shift_out;   /*Shift of 16 bit DWT output to 16 bit coefficients*/
+    int16_t offset_out;  /*Rounding offset of shift_out*/
+} dwt_16bit_params_t;
+
+void dwt_16bit_params_init(dwt_16bit_params_t* params, const picture_header_dynamic_t* picture_hdr, uint8_t input_bit_depth);
+
+/* Sample of 8bit (input_16bit == 0) or 16bit input line scaled like linear_input_scaling_line_[8,16]bit_c(),
+ * input_mask is 0xff for 8bit input.
+ */
+static INLINE int32_t dwt_input_sample(const void* in, uint32_t id, uint8_t input_16bit, uint8_t shift, int32_t offset,
+                                       uint16_t input_mask) {
+    const uint32_t val = input_16bit ? ((const uint16_t*)in)[id] : ((const uint8_t*)in)[id];
+    return ((val & input_mask) << shift) - offset;
+}
+
+/* Common scalar parts of dwt_horizontal_line_input_[8,16]bit kernels, SIMD versions run vector loop between them.
+ * dwt_horizontal_line_input_begin() calculate first pair and return 0 when line of 2 samples is already done.
+ */
+static INLINE uint8_t dwt_horizontal_line_input_begin(int32_t* out_lf, int32_t* out_hf, const void* in, uint32_t len,
+                                                      uint8_t input_16bit, uint8_t shift, int32_t offset, uint16_t input_mask) {
+    const int32_t in_0 = dwt_input_sample(in, 0, input_16bit, shift, offset, input_mask);
+    const int32_t in_1 = dwt_input_sample(in, 1, input_16bit, shift, offset, input_mask);
+    if (len == 2) {
+        out_hf[0] = in_1 - in_0;
+        out_lf[0] = in_0 + ((out_hf[0] + 1) >> 1);
+        return 0;
+    }
+    out_hf[0] = in_1 - ((in_0 + dwt_input_sample(in, 2, input_16bit, shift, offset, input_mask)) >> 1);
+    out_lf[0] = in_0 + ((out_hf[0] + 1) >> 1);
+    return 1;
+}
+
+/* Calculate pairs from id to end of line, previous pairs have to be already calculated.*/
+static INLINE void dwt_horizontal_line_input_end(int32_t* out_lf, int32_t* out_hf, const void* in, uint32_t len, uint32_t id,
+                                                 uint8_t input_16bit, uint8_t shift, int32_t offset, uint16_t input_mask) {
+    const uint32_t count = ((len - 1) / 2);
+    for (; id < count; id++) {
+        const int32_t in_0 = dwt_input_sample(in, id * 2, input_16bit, shift, offset, input_mask);
+        out_hf[id] = dwt_input_sample(in, id * 2 + 1, input_16bit, shift, offset, input_mask) -
+            ((in_0 + dwt_input_sample(in, id * 2 + 2, input_16bit, shift, offset, input_mask)) >> 1);
+        out_lf[id] = in_0 + ((out_hf[id - 1] + out_hf[id] + 2) >> 2);
+    }
+
+    if (!(len & 1)) {
+        const int32_t in_0 = dwt_input_sample(in, len - 2, input_16bit, shift, offset, input_mask);
+        out_hf[len / 2 - 1] = dwt_input_sample(in, len - 1, input_16bit, shift, offset, input_mask) - in_0;
+        out_lf[len / 2 - 1] = in_0 + ((out_hf[len / 2 - 2] + out_hf[len / 2 - 1] + 2) >> 2);
+    }
+    else { //if (len & 1){
+        const int32_t in_0 = dwt_input_sample(in, len - 1, input_16bit, shift, offset, input_mask);
+        out_lf[len / 2] = in_0 + ((out_hf[len / 2 - 1] + 1) >> 1);
+    }
+}
+
+/* The same like dwt_horizontal_line_input_begin() and dwt_horizontal_line_input_end() for output in 16 bits,
+ * used by dwt_horizontal_line_int16_input_[8,16]bit kernels, range is checked by dwt_16bit_params_init().
+ */
+static INLINE uint8_t dwt_horizontal_line_int16_input_begin(int16_t* out_lf, int16_t* out_hf, const void* in, uint32_t len,
+                                                            uint8_t input_16bit, uint8_t shift, int16_t offset,
+                                                            uint16_t input_mask) {
+    const int32_t in_0 = dwt_input_sample(in, 0, input_16bit, shift, offset, input_mask);
+    const int32_t in_1 = dwt_input_sample(in, 1, input_16bit, shift, offset, input_mask);
+    if (len == 2) {
+        out_hf[0] = in_1 - in_0;
+        out_lf[0] = in_0 + ((out_hf[0] + 1) >> 1);
+        return 0;
+    }
+    out_hf[0] = in_1 - ((in_0 + dwt_input_sample(in, 2, input_16bit, shift, offset, input_mask)) >> 1);
+    out_lf[0] = in_0 + ((out_hf[0] + 1) >> 1);
+    return 1;
+}
+
+static INLINE void dwt_horizontal_line_int16_input_end(int16_t* out_lf, int16_t* out_hf, const void* in, uint32_t len,
+                                                       uint32_t id, uint8_t input_16bit, uint8_t shift, int16_t offset,
+                                                       uint16_t input_mask) {
+    const uint32_t count = ((len - 1) / 2);
+    for (; id < count; id++) {
+        const int32_t in_0 = dwt_input_sample(in, id * 2, input_16bit, shift, offset, input_mask);
+        out_hf[id] = dwt_input_sample(in, id * 2 + 1, input_16bit, shift, offset, input_mask) -
+            ((in_0 + dwt_input_sample(in, id * 2 + 2, input_16bit, shift, offset, input_mask)) >> 1);
+        out_lf[id] = in_0 + ((out_hf[id - 1] + out_hf[id] + 2) >> 2);
+    }
+
+    if (!(len & 1)) {
+        const int32_t in_0 = dwt_input_sample(in, len - 2, input_16bit, shift, offset, input_mask);
+        out_hf[len / 2 - 1] = dwt_input_sample(in, len - 1, input_16bit, shift, offset, input_mask) - in_0;
+        out_lf[len / 2 - 1] = in_0 + ((out_hf[len / 2 - 2] + out_hf[len / 2 - 1] + 2) >> 2);
+    }
+    else { //if (len & 1){
+        const int32_t in_0 = dwt_input_sample(in, len - 1, input_16bit, shift, offset, input_mask);
+        out_lf[len / 2] = in_0 + ((out_hf[len / 2 - 1] + 1) >> 1);
+    }
+}
 
 /*DWT transform_V0_H[1,2,3,4,5]() calculate precinct with 1 line.
 * When (input_bit_depth == 0) do not convert input.
@@ -46,6 +160,10 @@ void transform_V0_H5(const pi_component_t* const component, const pi_enc_compone
                      uint8_t input_bit_depth, picture_header_dynamic_t* picture_hdr, uint16_t* buffer_out_16bit,
                      uint8_t param_out_Fq, uint32_t width, int32_t* buffer_tmp);
 
+void transform_V0_Hx_16bit(const pi_component_t* const component, const pi_enc_component_t* const component_enc,
+                           const void* buff_in, uint8_t input_bit_depth, const dwt_16bit_params_t* params,
+                           uint16_t* buffer_out_16bit, uint8_t param_out_Fq, uint32_t width, int32_t* buffer_tmp);
+
 void transform_V1_Hx_precinct_recalc_HF_prev_c(uint32_t width, int32_t* out_tmp_line_HF_next, const int32_t* line_0,
                                                const int32_t* line_1, const int32_t* line_2);
 
@@ -10,11 +10,13 @@
 #include "DwtStageProcess.h"
 #include "EncHandle.h"
 #include "PictureControlSet.h"
+#include "CoeffSlice.h"
 #include "Threads/SystemResourceManager.h"
 #include "SvtLog.h"
 #include "Threads/SvtObject.h"
 #include "Threads/SvtThreads.h"
 #include "SvtUtility.h"
+#include "SvtTrace.h"
 #include "encoder_dsp_rtcd.h"
 #include "Codestream.h"
 #include "NltEnc.h"
@@ -89,12 +91,30 @@ SvtJxsErrorType_t dwt_stage_context_ctor(ThreadContext_t* thread_context_ptr, sv
     return SvtJxsErrorNone;
 }
 
+/*First component that reach slice take its buffer from coefficients ring, return NULL on encoder close.*/
+static INLINE uint16_t* slice_coeff_buffer(CoeffSliceRing_t* ring, volatile PackInput_t* slice, uint32_t component_id) {
+    if (coeff_slice_ring_get(ring, slice->coeff_slice_ticket, &slice->coeff_slice_wrapper_ptr) != SvtJxsErrorNone) {
+        return NULL;
+    }
+    return ((CoeffSlice_t*)slice->coeff_slice_wrapper_ptr->object_ptr)->coeff_buff_ptr_16bit[component_id];
+}
+
 /************************************************
  * dwt transformation Kernel
  *************************************************/
+/*Statistics and trace: finish time of component DWT, must be written before last slice is marked as done.*/
+static INLINE void dwt_statistics_end(PictureControlSet* pcs_ptr, uint32_t component_id) {
+    SVT_TRACE_END("enc_dwt", pcs_ptr->frame_number, -1);
+    if (pcs_ptr->enc_input.stats) {
+        pcs_ptr->dwt_end_ns[component_id] = get_current_time_ns();
+    }
+}
+
 void* dwt_stage_kernel(void* input_ptr) {
     ThreadContext_t* enc_contxt_ptr = (ThreadContext_t*)input_ptr;
     DwtStageContext_t* context_ptr = (DwtStageContext_t*)enc_contxt_ptr->priv;
+    bind_common_rtcd(&context_ptr->enc_common->common_rtcd);
+    bind_encoder_rtcd(&context_ptr->enc_common->encoder_rtcd);
 
     ObjectWrapper_t* input_wrapper;
     int32_t* buffers_tmp = context_ptr->buffers_tmp;
@@ -108,10 +128,13 @@ void* dwt_stage_kernel(void* input_ptr) {
         volatile PackInput_t* list_slice_next = in->list_slices;
 
         PictureControlSet* pcs_ptr = (PictureControlSet*)in_pcs_wrapper_ptr->object_ptr;
+        if (pcs_ptr->enc_input.stats) {
+            pcs_ptr->dwt_begin_ns[component_id] = get_current_time_ns();
+        }
+        SVT_TRACE_BEGIN("enc_dwt", pcs_ptr->frame_number, -1);
         svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
         const pi_t* const pi = &enc_common->pi;
 
-        uint16_t* buffer_out_16bit = pcs_ptr->coeff_buff_ptr_16bit[component_id];
         svt_jpeg_xs_image_buffer_t* image_buffer = &pcs_ptr->enc_input.image;
 
         const uint8_t* plane_buffer_in = image_buffer->data_yuv[component_id];
@@ -129,6 +152,15 @@ void* dwt_stage_kernel(void* input_ptr) {
         const uint32_t slice_height = pi->precincts_per_slice * precinct_height;
         int decom_h = component->decom_h;
         int decom_v = component->decom_v;
+        /*Coefficients are written to ring buffer of actual slice, precincts offsets are relative to slice.*/
+        const uint32_t precincts_per_slice = pi->precincts_per_slice;
+        uint16_t* buffer_out_16bit = NULL;
+        if (list_slice_next) {
+            buffer_out_16bit = slice_coeff_buffer(enc_common->coeff_slice_ring, list_slice_next, component_id);
+            if (buffer_out_16bit == NULL) {
+                return NULL;
+            }
+        }
 
         // Release the Input Results
         svt_jxs_release_object(input_wrapper);
@@ -211,7 +243,7 @@ void* dwt_stage_kernel(void* input_ptr) {
                                          line_x[(line_begin + 0) % 3],
                                          line_x[(line_begin + 1) % 3],
                                          line_x[(line_begin + 2) % 3],
-                                         buffer_out_16bit + (line_idx / 2) * precinct_offset,
+                                         buffer_out_16bit + ((line_idx / 2) % precincts_per_slice) * precinct_offset,
                                          enc_common->picture_header_dynamic.hdr_Fq,
                                          in_tmp_line_HF_prev,
                                          out_tmp_line_HF_next,
@@ -227,9 +259,18 @@ void* dwt_stage_kernel(void* input_ptr) {
                     volatile PackInput_t* list_slice_next_old = list_slice_next;
                     list_slice_next = list_slice_next->sync_dwt_list_next;
                     Handle_t sync_dwt_semaphore = list_slice_next_old->sync_dwt_semaphore;
+                    if (list_slice_next == NULL) {
+                        dwt_statistics_end(pcs_ptr, component_id);
+                    }
                     //After set flag list item can be not longer actual for last component. First get next item
                     list_slice_next_old->sync_dwt_component_done_flag[component_id] = 1;
                     svt_jxs_post_semaphore(sync_dwt_semaphore);
+                    if (list_slice_next) {
+                        buffer_out_16bit = slice_coeff_buffer(enc_common->coeff_slice_ring, list_slice_next, component_id);
+                        if (buffer_out_16bit == NULL) {
+                            return NULL;
+                        }
+                    }
                 }
             }
             //Send sync after finish last Slice
@@ -237,6 +278,9 @@ void* dwt_stage_kernel(void* input_ptr) {
                 volatile PackInput_t* list_slice_next_old = list_slice_next;
                 list_slice_next = list_slice_next->sync_dwt_list_next;
                 Handle_t sync_dwt_semaphore = list_slice_next_old->sync_dwt_semaphore;
+                if (list_slice_next == NULL) {
+                    dwt_statistics_end(pcs_ptr, component_id);
+                }
                 //After set flag list item can be not longer actual for last component. First get next item
                 list_slice_next_old->sync_dwt_component_done_flag[component_id] = 1;
                 svt_jxs_post_semaphore(sync_dwt_semaphore);
@@ -328,7 +372,7 @@ void* dwt_stage_kernel(void* input_ptr) {
                                      line_5,
                                      line_6,
 
-                                     buffer_out_16bit + (line_idx / 4) * precinct_offset,
+                                     buffer_out_16bit + ((line_idx / 4) % precincts_per_slice) * precinct_offset,
 
                                      enc_common->picture_header_dynamic.hdr_Fq,
                                      buffer_prev,
@@ -346,9 +390,18 @@ void* dwt_stage_kernel(void* input_ptr) {
                 volatile PackInput_t* list_slice_next_old = list_slice_next;
                 list_slice_next = list_slice_next->sync_dwt_list_next;
                 Handle_t sync_dwt_semaphore = list_slice_next_old->sync_dwt_semaphore;
+                if (list_slice_next == NULL) {
+                    dwt_statistics_end(pcs_ptr, component_id);
+                }
                 //After set flag list item can be not longer actual for last component. First get next item
                 list_slice_next_old->sync_dwt_component_done_flag[component_id] = 1;
                 svt_jxs_post_semaphore(sync_dwt_semaphore);
+                if (list_slice_next) {
+                    buffer_out_16bit = slice_coeff_buffer(enc_common->coeff_slice_ring, list_slice_next, component_id);
+                    if (buffer_out_16bit == NULL) {
+                        return NULL;
+                    }
+                }
             }
         }
         //Send sync after finish last Slice
@@ -356,6 +409,9 @@ void* dwt_stage_kernel(void* input_ptr) {
             volatile PackInput_t* list_slice_next_old = list_slice_next;
             list_slice_next = list_slice_next->sync_dwt_list_next;
             Handle_t sync_dwt_semaphore = list_slice_next_old->sync_dwt_semaphore;
+            if (list_slice_next == NULL) {
+                dwt_statistics_end(pcs_ptr, component_id);
+            }
             //After set flag list item can be not longer actual for last component. First get next item
             list_slice_next_old->sync_dwt_component_done_flag[component_id] = 1;
             svt_jxs_post_semaphore(sync_dwt_semaphore);
@@ -4,17 +4,24 @@
 */
 
 #include "EncHandle.h"
+#include "CoeffSlice.h"
 #include "DwtInput.h"
 #include "DwtStageProcess.h"
 #include "FinalStageProcess.h"
 #include "InitStageProcess.h"
 #include "PackOut.h"
 #include "PackStageProcess.h"
+#include "Transcode.h"
+#include "SliceReuse.h"
 #include "WeightTable.h"
 #include "encoder_dsp_rtcd.h"
 #include "SvtLog.h"
 #include "Codestream.h"
 #include "EncDec.h"
+#include <stddef.h>
+
+/*Parameters added after private_ptr have to fit in padding, so size of configuration does not change with new parameters.*/
+SVT_STATIC_ASSERT(sizeof(svt_jpeg_xs_encoder_api_t) == offsetof(svt_jpeg_xs_encoder_api_t, thread_pool) + 128, encoder_api_size);
 
 /**********************************
  * Encoder Library Handle Deconstructor
@@ -32,10 +39,12 @@ static void svt_enc_handle_dctor(void_ptr p) {
     }
     // pack Stage
     SVT_DESTROY_THREAD_ARRAY(enc_api_prv->pack_stage_thread_handle_array, enc_api_prv->pack_stage_threads_num);
+    SVT_DELETE(enc_common->pack_stage_pool_client);
     // final Stage
     SVT_DESTROY_THREAD(enc_api_prv->final_stage_thread_handle);
 
     SVT_DELETE(enc_api_prv->picture_control_set_pool_ptr);
+    SVT_DELETE(enc_api_prv->coeff_slice_pool_ptr);
     SVT_DELETE(enc_api_prv->input_image_resource_ptr);
     SVT_DELETE(enc_api_prv->output_queue_resource_ptr);
     SVT_DELETE(enc_api_prv->pack_input_resource_ptr);
@@ -50,6 +59,11 @@ static void svt_enc_handle_dctor(void_ptr p) {
         SVT_FREE(enc_api_prv->enc_common.slice_sizes);
     }
     SVT_DELETE_PTR_ARRAY(enc_api_prv->pack_stage_context_ptr_array, enc_api_prv->pack_stage_threads_num);
+    SVT_DELETE(enc_common->transcode);
+    SVT_DELETE(enc_common->slice_reuse);
+    SVT_DELETE(enc_common->coeff_slice_ring);
+    SVT_FREE(enc_api_prv->pack_stage_context_busy_array);
+    SVT_DESTROY_SEMAPHORE(enc_api_prv->pack_stage_context_free_semaphore);
     SVT_FREE(enc_api_prv->sync_output_ringbuffer);
     svt_jxs_free_cond_var(&enc_api_prv->sync_output_ringbuffer_left);
 }
@@ -82,7 +96,11 @@ static void print_lib_params(svt_jpeg_xs_encoder_api_t* enc_api) {
     const char* quantization_names[2] = {"Deadzone", "Uniform"};
     const char* rc_names[RC_MODE_SIZE] = {
         "CBR per precinct", "CBR per precinct, move padding", "CBR per slice", "CBR per slice max RATE"};
+    const char* preset_names[encoder_preset_max] = {"Custom", "Best quality", "Balanced", "Fastest"};
 
+    if (enc_api->preset != encoder_preset_custom) {
+        SVT_LOG("\nSVT [config]: Preset                              \t: %u:%s", enc_api->preset, preset_names[enc_api->preset]);
+    }
     SVT_LOG("\nSVT [config]: Rate Control                        \t: %u:%s",
             enc_common->rate_control_mode,
             rc_names[enc_common->rate_control_mode]);
@@ -113,11 +131,52 @@ static void print_lib_params(svt_jpeg_xs_encoder_api_t* enc_api) {
                 enc_api_prv->pack_stage_threads_num,
                 enc_api_prv->dwt_stage_threads_num);
     }
+    if (enc_common->streaming) {
+        SVT_LOG("\nSVT [config]: Streaming line bands                \t: Enabled");
+    }
+    if (enc_common->transcode) {
+        SVT_LOG("\nSVT [config]: Transcoding / Proxy mode           \t: Enabled / %d", enc_common->transcode->proxy_mode);
+    }
+    if (enc_api->reuse_unchanged_slices) {
+        SVT_LOG("\nSVT [config]: Reuse unchanged slices             \t: Enabled");
+    }
     SVT_LOG("\n");
 
     fflush(stdout);
 }
 
+/* Coding tools and rate control of encoder_preset_t, index is preset - 1.
+ * Order follows measured speed, see "Encoder Presets" in encoder design document.
+ * Rate control per slice is not used, it was measured slower than per precinct without better quality,
+ * and rate control per precinct without padding movement was not faster and lost quality.*/
+typedef struct encoder_preset_tools {
+    RateControlType rate_control_mode;
+    SignHandlingStrategy coding_signs_handling;
+    uint8_t coding_significance;
+    VerticalPredictionMode coding_vertical_prediction_mode;
+} encoder_preset_tools_t;
+
+static const encoder_preset_tools_t encoder_preset_tools[encoder_preset_max - 1] = {
+    /*encoder_preset_best_quality*/
+    {RC_CBR_PER_PRECINCT_MOVE_PADDING, SIGN_HANDLING_STRATEGY_FULL, 1, METHOD_PRED_ZERO_RESIDUAL},
+    /*encoder_preset_balanced*/
+    {RC_CBR_PER_PRECINCT_MOVE_PADDING, SIGN_HANDLING_STRATEGY_OFF, 1, METHOD_PRED_ZERO_RESIDUAL},
+    /*encoder_preset_fastest*/
+    {RC_CBR_PER_PRECINCT_MOVE_PADDING, SIGN_HANDLING_STRATEGY_OFF, 1, METHOD_PRED_DISABLE},
+};
+
+/* Preset overrides parameters in enc_api, so values printed and validated later are these used by encoder.*/
+static void encoder_apply_preset(svt_jpeg_xs_encoder_api_t* enc_api) {
+    if (enc_api->preset == encoder_preset_custom) {
+        return;
+    }
+    const encoder_preset_tools_t* tools = &encoder_preset_tools[enc_api->preset - 1];
+    enc_api->rate_control_mode = tools->rate_control_mode;
+    enc_api->coding_signs_handling = tools->coding_signs_handling;
+    enc_api->coding_significance = tools->coding_significance;
+    enc_api->coding_vertical_prediction_mode = tools->coding_vertical_prediction_mode;
+}
+
 #define WAVELET_IN_DEPTH_BW_DEFAULT      20 //TODO: Move this somewhere else
 #define WAVELET_FRACTION_BITS_FQ_DEFAULT 8
 
@@ -235,6 +294,22 @@ static SvtJxsErrorType_t encoder_init_configuration(svt_jpeg_xs_encoder_common_t
         enc_common->cpu_profile = CPU_PROFILE_LOW_LATENCY; //Force Low latency for V0
     }
 
+    if (config_struct->streaming && enc_common->cpu_profile != CPU_PROFILE_LOW_LATENCY) {
+        //DWT Stage of profile CPU transform whole component, streaming reads lines per slice in Pack Stage
+        if (config_struct->verbose >= VERBOSE_WARNINGS) {
+            fprintf(stderr, "Warning: streaming works only in Low latency threading model, cpu_profile is changed to 0!\n");
+        }
+        enc_common->cpu_profile = CPU_PROFILE_LOW_LATENCY;
+    }
+
+    if (config_struct->transcode && enc_common->cpu_profile != CPU_PROFILE_LOW_LATENCY) {
+        //Coefficients are unpacked per precinct in Pack Stage, DWT Stage of profile CPU has nothing to do
+        if (config_struct->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Error: transcode works only in Low latency threading model, set cpu_profile to 0!\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+
     if (config_struct->coding_vertical_prediction_mode >= METHOD_PRED_SIZE) {
         if (config_struct->verbose >= VERBOSE_ERRORS) {
             //Invalid VPrediction mode
@@ -445,6 +520,8 @@ static SvtJxsErrorType_t encoder_init_configuration(svt_jpeg_xs_encoder_common_t
         return return_error;
     }
 
+    dwt_16bit_params_init(&enc_common->dwt_16bit, &enc_common->picture_header_dynamic, enc_common->bit_depth);
+
     SVT_DEBUG("%s, prec_num_in_slice %u, prec_num_in_frame %u\n", __func__, pi->precincts_per_slice, pi->precincts_line_num);
     return SvtJxsErrorNone;
 }
@@ -523,6 +600,24 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_load_default_parameters(uint64_
 
     enc_api->slice_packetization_mode = 0;
     enc_api->private_ptr = NULL;
+    enc_api->thread_pool = NULL;
+    enc_api->thread_placement = NULL;
+    enc_api->callback_task_available = NULL;
+    enc_api->callback_task_available_context = NULL;
+    enc_api->external_tasks = 0;
+    enc_api->picture_pool_size = 0;
+    enc_api->coeff_slice_ring_size = 0;
+    enc_api->input_queue_size = 0;
+    enc_api->output_queue_size = 0;
+    enc_api->slice_queue_size = 0;
+    enc_api->pipeline_preset = pipeline_preset_default;
+    enc_api->statistics = 0;
+    enc_api->memory_flags = SVT_JPEGXS_MEMORY_DEFAULT;
+    enc_api->preset = encoder_preset_custom;
+    enc_api->streaming = 0;
+    enc_api->transcode = 0;
+    enc_api->transcode_proxy_mode = proxy_mode_full;
+    enc_api->reuse_unchanged_slices = 0;
 
     return SvtJxsErrorNone;
 }
@@ -603,24 +698,25 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_image_config(uint64_t versi
     return SvtJxsErrorNone;
 }
 
-/**********************************
- * Initialize Encoder Library
- **********************************/
-PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major, uint64_t version_api_minor,
-                                                      svt_jpeg_xs_encoder_api_t* enc_api) {
+/* start_threads is 0 when only memory requirements are measured, then buffers are allocated but threads are not started.
+ * arena and memory_account are owned by instance also on error, svt_jpeg_xs_encoder_close() releases buffers
+ * and destroys them.*/
+static SvtJxsErrorType_t encoder_init_instance(svt_jpeg_xs_encoder_api_t* enc_api, MemoryArena_t* arena,
+                                               MemoryAccount_t* memory_account, uint8_t start_threads) {
     SvtJxsErrorType_t return_error = SvtJxsErrorNone;
-    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
-        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
-        return SvtJxsErrorInvalidApiVersion;
-    }
-    if (enc_api == NULL) {
-        return SvtJxsErrorBadParameter;
-    }
     enc_api->private_ptr = NULL;
     svt_log_init();
     // Init Component OS objects (threads, semaphores, etc.)
     // also links the various Component control functions
     return_error = encoder_allocate_handle(enc_api);
+    if (enc_api->private_ptr) {
+        ((svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr)->arena = arena;
+        ((svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr)->memory_account = memory_account;
+    }
+    else {
+        svt_jxs_arena_destroy(arena);
+        svt_jxs_memory_account_destroy(memory_account);
+    }
     if (return_error != SvtJxsErrorNone) {
         svt_jpeg_xs_encoder_close(enc_api);
         return return_error;
@@ -632,6 +728,12 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
     svt_jpeg_xs_encoder_common_t* enc_common = &enc_api_prv->enc_common;
     svt_jxs_increase_component_count();
 
+    if (enc_api->thread_placement) {
+        enc_api_prv->thread_placement = *enc_api->thread_placement;
+        svt_jxs_thread_placement_resolve(&enc_api_prv->thread_placement);
+        enc_api_prv->thread_placement_ptr = &enc_api_prv->thread_placement;
+    }
+
     enc_api_prv->callback_encoder_ctx = enc_api;
     enc_api_prv->callback_send_data_available = enc_api->callback_send_data_available;
     enc_api_prv->callback_send_data_available_context = enc_api->callback_send_data_available_context;
@@ -645,6 +747,60 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
         return SvtJxsErrorBadParameter;
     }
     enc_common->slice_packetization_mode = enc_api->slice_packetization_mode;
+    enc_common->statistics = enc_api->statistics;
+
+    if (enc_api->streaming > 1 || (enc_api->streaming && enc_api->slice_packetization_mode)) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("Streaming can not be used with slice packetization mode\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    enc_common->streaming = enc_api->streaming;
+
+    if (enc_api->transcode > 1 || (enc_api->transcode && enc_api->streaming)) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("Transcode can not be used with streaming\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    if (enc_api->transcode_proxy_mode >= proxy_mode_max || (enc_api->transcode_proxy_mode && !enc_api->transcode)) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("Unrecognized transcode proxy mode or transcode disabled\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    if (enc_api->reuse_unchanged_slices > 1 || (enc_api->reuse_unchanged_slices && (enc_api->streaming || enc_api->transcode))) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("Reuse of unchanged slices can not be used with streaming or transcode\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+
+    if (enc_api->pipeline_preset >= pipeline_preset_max) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("Unrecognized pipeline preset\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+
+    if (enc_api->preset >= encoder_preset_max) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("Unrecognized encoder preset\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    encoder_apply_preset(enc_api);
+
+    if (enc_api->external_tasks > 1 || (enc_api->external_tasks && enc_api->thread_pool)) {
+        if (enc_api->verbose >= VERBOSE_ERRORS) {
+            SVT_LOG("External tasks mode can not be used with thread pool\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    enc_common->external_tasks = enc_api->external_tasks;
+    enc_common->callback_task_encoder_ctx = enc_api;
+    enc_common->callback_task_available = enc_api->callback_task_available;
+    enc_common->callback_task_available_context = enc_api->callback_task_available_context;
 
     const CPU_FLAGS cpu_flags = get_cpu_flags();
     enc_api->use_cpu_flags &= cpu_flags;
@@ -652,8 +808,8 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
         SVT_LOG("[asm level on system : up to %s]\n", get_asm_level_name_str(cpu_flags));
         SVT_LOG("[asm level selected : up to %s]\n", get_asm_level_name_str(enc_api->use_cpu_flags));
     }
-    setup_common_rtcd_internal(enc_api->use_cpu_flags);
-    setup_encoder_rtcd_internal(enc_api->use_cpu_flags);
+    setup_common_rtcd(&enc_common->common_rtcd, enc_api->use_cpu_flags);
+    setup_encoder_rtcd(&enc_common->encoder_rtcd, enc_api->use_cpu_flags);
 
     return_error = encoder_init_configuration(&enc_api_prv->enc_common, enc_api);
     if (return_error != SvtJxsErrorNone) {
@@ -661,6 +817,16 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
         return return_error;
     }
 
+    if (enc_api->transcode) {
+        /*Created before Picture Control Set pool, slice offsets of source are allocated in every frame.*/
+        SVT_NEW(enc_common->transcode,
+                transcode_ctor,
+                enc_common,
+                (proxy_mode_t)enc_api->transcode_proxy_mode,
+                enc_api->use_cpu_flags,
+                enc_api->verbose);
+    }
+
     if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
         if (enc_api->threads_num > 12) {
             enc_api_prv->dwt_stage_threads_num = 3;
@@ -682,21 +848,72 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
     else {
         assert(0);
     }
+    if (enc_api->thread_pool) {
+        /*Slice tasks are executed by shared pool, one Pack Stage context per pool worker.*/
+        enc_api_prv->pack_stage_threads_num = svt_jxs_thread_pool_get_threads_num(enc_api->thread_pool);
+    }
 
+    /*Queue depths from pipeline preset, explicit sizes from configuration override preset.*/
     uint32_t pack_input_fifo_count = 2 * enc_api_prv->pack_stage_threads_num;
+    uint32_t input_buffer_fifo_count = 10;
+    uint32_t picture_control_set_pool_count = 10;
+    uint32_t sync_output_ringbuffer_add = 10;
+    if (enc_api->pipeline_preset == pipeline_preset_min_latency) {
+        pack_input_fifo_count = enc_api_prv->pack_stage_threads_num;
+        input_buffer_fifo_count = 1;
+        picture_control_set_pool_count = 1;
+        sync_output_ringbuffer_add = 0;
+    }
+    else if (enc_api->pipeline_preset == pipeline_preset_max_throughput) {
+        pack_input_fifo_count = 4 * enc_api_prv->pack_stage_threads_num;
+        input_buffer_fifo_count = 20;
+        picture_control_set_pool_count = 20;
+    }
+    if (enc_api->slice_queue_size) {
+        pack_input_fifo_count = enc_api->slice_queue_size;
+    }
+    if (enc_api->input_queue_size) {
+        input_buffer_fifo_count = enc_api->input_queue_size;
+    }
+    if (enc_api->picture_pool_size) {
+        picture_control_set_pool_count = enc_api->picture_pool_size;
+    }
+
     if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
-        /*Set minimum 2 frames to schedule.
-         *If size of queue is smaller than number of slices then deadlock.*/
-        pack_input_fifo_count = MAX(pack_input_fifo_count, 2 * enc_common->pi.slice_num);
-        pack_input_fifo_count = MAX(pack_input_fifo_count,
-                                    (enc_api_prv->dwt_stage_threads_num / enc_common->pi.comps_num) * enc_common->pi.slice_num);
+        /*If size of queue is smaller than number of slices then deadlock.*/
+        uint32_t pack_input_fifo_min = enc_common->pi.slice_num;
+        if (!enc_api->slice_queue_size && enc_api->pipeline_preset != pipeline_preset_min_latency) {
+            /*Set minimum 2 frames to schedule.*/
+            pack_input_fifo_min = MAX(2 * enc_common->pi.slice_num,
+                                      (enc_api_prv->dwt_stage_threads_num / enc_common->pi.comps_num) * enc_common->pi.slice_num);
+        }
+        pack_input_fifo_count = MAX(pack_input_fifo_count, pack_input_fifo_min);
     }
 
     const uint32_t init_stage_process_threads_num = 1;
     uint32_t dwt_input_fifo_count = enc_api_prv->dwt_stage_threads_num * 3; /* Using only for CPU_PROFILE_CPU! */
-    uint32_t input_buffer_fifo_count = 10;
-    uint32_t picture_control_set_pool_count = input_buffer_fifo_count; //TODO: 3 will be enough for latency mode???
-    enc_api_prv->sync_output_ringbuffer_size = picture_control_set_pool_count + 10;
+    /*Coefficients buffer is kept by slice task, more buffers than tasks will be never used.
+     *DWT Stage calculate whole component before next one. When components share DWT Stage thread,
+     *later component needs buffers of all slices of frame, so ring smaller than frame will deadlock.
+     *When every component has own thread, ring holds only slices in flight: one packed by every Pack Stage thread
+     *and one calculated by DWT Stage ahead of them.*/
+    uint32_t coeff_slice_ring_min = enc_common->pi.slice_num;
+    uint32_t coeff_slice_ring_size = pack_input_fifo_count;
+    uint32_t dwt_components_num = 0;
+    for (uint32_t c = 0; c < enc_common->pi.comps_num; ++c) {
+        dwt_components_num += (enc_common->pi.components[c].decom_v != 0);
+    }
+    if (enc_api_prv->dwt_stage_threads_num >= dwt_components_num) {
+        coeff_slice_ring_min = 1;
+        coeff_slice_ring_size = MIN(enc_api_prv->pack_stage_threads_num + 1, pack_input_fifo_count);
+    }
+    if (enc_api->coeff_slice_ring_size) {
+        coeff_slice_ring_size = MIN(MAX(enc_api->coeff_slice_ring_size, coeff_slice_ring_min), pack_input_fifo_count);
+    }
+    enc_api_prv->sync_output_ringbuffer_size = picture_control_set_pool_count + sync_output_ringbuffer_add;
+    if (enc_api->output_queue_size) {
+        enc_api_prv->sync_output_ringbuffer_size = enc_api->output_queue_size;
+    }
     uint32_t output_buffer_fifo_count = enc_api_prv->sync_output_ringbuffer_size + 8;
     uint32_t pack_output_fifo_count = pack_input_fifo_count;
 
@@ -714,8 +931,11 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
             "Number of logical cores available: %u\nNumber of PPCS %u\n", enc_api->threads_num, picture_control_set_pool_count);
         if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
             SVT_LOG("dwt input count %d\n", dwt_input_fifo_count);
+            SVT_LOG("coefficients slice ring size %d\n", coeff_slice_ring_size);
         }
         SVT_LOG("slice pack input count %d\n", pack_input_fifo_count);
+        SVT_LOG("input queue count %d\n", input_buffer_fifo_count);
+        SVT_LOG("output ring buffer size %d\n", enc_api_prv->sync_output_ringbuffer_size);
         SVT_LOG("slice pack output count %d\n", pack_output_fifo_count);
 
         print_lib_params(enc_api);
@@ -839,6 +1059,17 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
                                                                                         0);
 
     if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
+        // Slice coefficients from DWT, INIT -> DWT -> PACK
+        SVT_NEW(enc_api_prv->coeff_slice_pool_ptr,
+                svt_jxs_system_resource_ctor,
+                coeff_slice_ring_size,
+                1,
+                0,
+                coeff_slice_creator,
+                enc_common,
+                NULL);
+        SVT_NEW(enc_common->coeff_slice_ring, coeff_slice_ring_ctor, enc_api_prv->coeff_slice_pool_ptr);
+
         // Wavelet Vertical Transform Input
         DwtInputInitData dwt_input_init_data;
 
@@ -888,6 +1119,10 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
         }
     }
 
+    if (enc_api->reuse_unchanged_slices) {
+        SVT_NEW(enc_common->slice_reuse, slice_reuse_ctor, enc_common->slice_sizes, enc_common->pi.slice_num);
+    }
+
     // Pack Stage Context
     SVT_ALLOC_PTR_ARRAY(enc_api_prv->pack_stage_context_ptr_array, enc_api_prv->pack_stage_threads_num);
     for (process_index = 0; process_index < enc_api_prv->pack_stage_threads_num; ++process_index) {
@@ -897,43 +1132,204 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major
     // Final Stage Context
     SVT_NEW(enc_api_prv->final_stage_context_ptr, final_stage_context_ctor, enc_api_prv);
 
+    if (!start_threads) {
+        return SvtJxsErrorNone;
+    }
+
     // Init Stage Kernel
-    SVT_CREATE_THREAD(enc_api_prv->init_stage_thread_handle, init_stage_kernel, enc_api_prv->init_stage_context_ptr);
+    SVT_CREATE_THREAD_PLACED(enc_api_prv->init_stage_thread_handle,
+                             init_stage_kernel,
+                             enc_api_prv->init_stage_context_ptr,
+                             enc_api_prv->thread_placement_ptr,
+                             0);
 
     if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
         // Dwt Ver Stage Kernel
-        SVT_CREATE_THREAD_ARRAY(enc_api_prv->dwt_stage_thread_handle_array,
-                                enc_api_prv->dwt_stage_threads_num,
-                                dwt_stage_kernel,
-                                enc_api_prv->dwt_stage_context_ptr_array);
+        SVT_CREATE_THREAD_ARRAY_PLACED(enc_api_prv->dwt_stage_thread_handle_array,
+                                       enc_api_prv->dwt_stage_threads_num,
+                                       dwt_stage_kernel,
+                                       enc_api_prv->dwt_stage_context_ptr_array,
+                                       enc_api_prv->thread_placement_ptr,
+                                       1);
     }
 
     // Pack Stage Kernel
-    SVT_CREATE_THREAD_ARRAY(enc_api_prv->pack_stage_thread_handle_array,
-                            enc_api_prv->pack_stage_threads_num,
-                            pack_stage_kernel,
-                            enc_api_prv->pack_stage_context_ptr_array);
+    if (enc_common->external_tasks) {
+        /*Tasks are executed by caller threads in svt_jpeg_xs_encoder_run_task().*/
+        enc_api_prv->pack_input_consumer_fifo_ptr = svt_jxs_system_resource_get_consumer_fifo(
+            enc_api_prv->pack_input_resource_ptr, 0);
+        SVT_CALLOC(enc_api_prv->pack_stage_context_busy_array, enc_api_prv->pack_stage_threads_num, sizeof(int32_t));
+        SVT_CREATE_SEMAPHORE(enc_api_prv->pack_stage_context_free_semaphore,
+                             enc_api_prv->pack_stage_threads_num,
+                             enc_api_prv->pack_stage_threads_num);
+        if (enc_api_prv->pack_stage_context_free_semaphore == NULL) {
+            return SvtJxsErrorInsufficientResources;
+        }
+    }
+    else if (enc_api->thread_pool) {
+        SVT_NEW(enc_common->pack_stage_pool_client,
+                svt_jxs_thread_pool_client_ctor,
+                enc_api->thread_pool,
+                pack_stage_pool_task,
+                (void**)enc_api_prv->pack_stage_context_ptr_array);
+    }
+    else {
+        SVT_CREATE_THREAD_ARRAY_PLACED(enc_api_prv->pack_stage_thread_handle_array,
+                                       enc_api_prv->pack_stage_threads_num,
+                                       pack_stage_kernel,
+                                       enc_api_prv->pack_stage_context_ptr_array,
+                                       enc_api_prv->thread_placement_ptr,
+                                       1);
+    }
     // Final Stage Kernel
-    SVT_CREATE_THREAD(enc_api_prv->final_stage_thread_handle, final_stage_kernel, enc_api_prv->final_stage_context_ptr);
+    SVT_CREATE_THREAD_PLACED(enc_api_prv->final_stage_thread_handle,
+                             final_stage_kernel,
+                             enc_api_prv->final_stage_context_ptr,
+                             enc_api_prv->thread_placement_ptr,
+                             0);
 
     svt_jxs_print_memory_usage();
     return return_error;
 }
 
+/* All buffers are allocated in calling thread, so arena is active only here and in svt_jpeg_xs_encoder_close(),
+ * account is active only here.*/
+static SvtJxsErrorType_t encoder_init_with_arena(svt_jpeg_xs_encoder_api_t* enc_api, uint8_t start_threads) {
+    MemoryArena_t* arena = svt_jxs_arena_create(enc_api->memory_flags);
+    MemoryAccount_t* memory_account = svt_jxs_memory_account_create();
+    if (memory_account == NULL) {
+        svt_jxs_arena_destroy(arena);
+        enc_api->private_ptr = NULL;
+        return SvtJxsErrorInsufficientResources;
+    }
+    MemoryArena_t* arena_prev = svt_jxs_arena_set_active(arena);
+    MemoryAccount_t* memory_account_prev = svt_jxs_memory_account_set_active(memory_account);
+    SvtJxsErrorType_t return_error = encoder_init_instance(enc_api, arena, memory_account, start_threads);
+    svt_jxs_memory_account_set_active(memory_account_prev);
+    svt_jxs_arena_set_active(arena_prev);
+    return return_error;
+}
+
+/*Regions mapped by arena and heap buffers live now.*/
+static uint64_t encoder_memory_usage(svt_jpeg_xs_encoder_api_prv_t* enc_api_prv) {
+    const uint64_t mapped_bytes = enc_api_prv->arena ? svt_jxs_arena_get_mapped_bytes(enc_api_prv->arena) : 0;
+    return mapped_bytes + svt_jxs_memory_account_get_live_bytes(enc_api_prv->memory_account);
+}
+
+/**********************************
+ * Initialize Encoder Library
+ **********************************/
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_init(uint64_t version_api_major, uint64_t version_api_minor,
+                                                      svt_jpeg_xs_encoder_api_t* enc_api) {
+    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
+        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
+        return SvtJxsErrorInvalidApiVersion;
+    }
+    if (enc_api == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+
+    /*Buffers allocated and first touched in initialization are placed on selected NUMA node.*/
+    const int32_t numa_node = enc_api->thread_placement ? enc_api->thread_placement->numa_node : -1;
+    NumaPolicy_t numa_policy;
+    if (numa_node >= 0) {
+        svt_jxs_numa_prefer_node(numa_node, &numa_policy);
+    }
+    SvtJxsErrorType_t return_error = encoder_init_with_arena(enc_api, 1);
+    if (numa_node >= 0) {
+        svt_jxs_numa_restore(&numa_policy);
+    }
+    return return_error;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_memory_requirements(uint64_t version_api_major, uint64_t version_api_minor,
+                                                                         svt_jpeg_xs_encoder_api_t* enc_api,
+                                                                         uint64_t* out_bytes) {
+    if ((version_api_major > SVT_JPEGXS_API_VER_MAJOR) ||
+        (version_api_major == SVT_JPEGXS_API_VER_MAJOR && version_api_minor > SVT_JPEGXS_API_VER_MINOR)) {
+        return SvtJxsErrorInvalidApiVersion;
+    }
+    if (enc_api == NULL || out_bytes == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+
+    /*Allocate all buffers of configuration on copy of handle, without starting threads, and release them.
+     *Arena of memory_flags is created too, so value is the same as svt_jpeg_xs_encoder_get_memory_usage() after init.*/
+    svt_jpeg_xs_encoder_api_t enc_api_query = *enc_api;
+    if (enc_api_query.verbose > VERBOSE_ERRORS) {
+        enc_api_query.verbose = VERBOSE_ERRORS;
+    }
+    SvtJxsErrorType_t return_error = encoder_init_with_arena(&enc_api_query, 0);
+    *out_bytes = 0;
+    if (enc_api_query.private_ptr) {
+        *out_bytes = encoder_memory_usage((svt_jpeg_xs_encoder_api_prv_t*)enc_api_query.private_ptr);
+    }
+    svt_jpeg_xs_encoder_close(&enc_api_query);
+    return return_error;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_memory_usage(svt_jpeg_xs_encoder_api_t* enc_api, uint64_t* out_bytes) {
+    if (enc_api == NULL || enc_api->private_ptr == NULL || out_bytes == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+    *out_bytes = encoder_memory_usage((svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr);
+    return SvtJxsErrorNone;
+}
+
 PREFIX_API void svt_jpeg_xs_encoder_close(svt_jpeg_xs_encoder_api_t* enc_api) {
     if (enc_api && enc_api->private_ptr) {
         svt_jpeg_xs_encoder_api_prv_t* enc_api_prv = (svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr;
+        MemoryArena_t* arena = enc_api_prv->arena;
+        MemoryArena_t* arena_prev = svt_jxs_arena_set_active(arena);
+        MemoryAccount_t* memory_account = enc_api_prv->memory_account;
         svt_jxs_shutdown_process(enc_api_prv->input_image_resource_ptr);
         svt_jxs_shutdown_process(enc_api_prv->dwt_input_resource_ptr);
+        svt_jxs_shutdown_process(enc_api_prv->coeff_slice_pool_ptr);
+        if (enc_api_prv->enc_common.coeff_slice_ring) {
+            coeff_slice_ring_shutdown(enc_api_prv->enc_common.coeff_slice_ring);
+        }
         svt_jxs_shutdown_process(enc_api_prv->pack_input_resource_ptr);
         svt_jxs_shutdown_process(enc_api_prv->pack_output_resource_ptr);
         svt_jxs_shutdown_process(enc_api_prv->output_queue_resource_ptr);
         SVT_DELETE(enc_api_prv);
+        svt_jxs_memory_account_destroy(memory_account);
+        svt_jxs_arena_set_active(arena_prev);
+        svt_jxs_arena_destroy(arena);
         enc_api->private_ptr = NULL;
         svt_jxs_decrease_component_count();
     }
 }
 
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_task(svt_jpeg_xs_encoder_api_t* enc_api, svt_jpeg_xs_encoder_task_t** task) {
+    if (enc_api == NULL || enc_api->private_ptr == NULL || task == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+    svt_jpeg_xs_encoder_api_prv_t* enc_api_prv = (svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr;
+    if (!enc_api_prv->enc_common.external_tasks) {
+        return SvtJxsErrorBadParameter;
+    }
+
+    ObjectWrapper_t* input_wrapper_ptr = NULL;
+    svt_jxs_get_full_object_non_blocking(enc_api_prv->pack_input_consumer_fifo_ptr, &input_wrapper_ptr);
+    *task = (svt_jpeg_xs_encoder_task_t*)input_wrapper_ptr;
+    if (input_wrapper_ptr == NULL) {
+        return SvtJxsErrorNoErrorEmptyQueue;
+    }
+    return SvtJxsErrorNone;
+}
+
+PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_run_task(svt_jpeg_xs_encoder_api_t* enc_api, svt_jpeg_xs_encoder_task_t* task) {
+    if (enc_api == NULL || enc_api->private_ptr == NULL || task == NULL) {
+        return SvtJxsErrorBadParameter;
+    }
+    svt_jpeg_xs_encoder_api_prv_t* enc_api_prv = (svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr;
+    if (!enc_api_prv->enc_common.external_tasks) {
+        return SvtJxsErrorBadParameter;
+    }
+    pack_stage_external_task(enc_api_prv, (ObjectWrapper_t*)task);
+    return SvtJxsErrorNone;
+}
+
 /**********************************
  * Empty This Buffer
  **********************************/
@@ -945,26 +1341,43 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_send_picture(svt_jpeg_xs_encode
 
     svt_jpeg_xs_encoder_api_prv_t* enc_api_prv = (svt_jpeg_xs_encoder_api_prv_t*)enc_api->private_ptr;
 
-    if (enc_input->bitstream.allocation_size < enc_api_prv->enc_common.picture_header_dynamic.hdr_Lcod) {
-        return SvtJxsErrorBadParameter;
+    if (enc_api_prv->enc_common.streaming) {
+        /*Image and bitstream buffers are not used, lines are read and codestream is written by stream callbacks.*/
+        const svt_jpeg_xs_stream_t* stream = enc_input->stream;
+        if (stream == NULL || stream->read_lines == NULL || stream->write_bytes == NULL) {
+            return SvtJxsErrorBadParameter;
+        }
     }
-
-    pi_t* pi = &enc_api_prv->enc_common.pi;
-    uint8_t input_bit_depth = enc_api_prv->enc_common.bit_depth;
-    uint32_t pixel_size = input_bit_depth <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
-    for (uint8_t c = 0; c < pi->comps_num; ++c) {
-        uint32_t min_size;
-        // The last row might be shorter than the stride, e.g. in case the application is encoding
-        // an interlaced image with fields interleaved row by row, but feeding each field individually
-        // to the encoder. In that case the stride would be double the usual stride so the encoder only
-        // encodes every second row, but the last row of the second field would only have a single row
-        // of data left in it (half the stride in that case).
-        min_size = enc_input->image.stride[c] * pixel_size * (pi->components[c].height - 1);
-        min_size += pi->components[c].width * pixel_size;
-        if (enc_input->image.alloc_size[c] < min_size) {
+    else if (enc_api_prv->enc_common.transcode) {
+        /*Image is not used, coefficients are unpacked from source codestream.*/
+        const svt_jpeg_xs_bitstream_buffer_t* source = enc_input->transcode_source;
+        if (source == NULL || source->buffer == NULL || source->used_size == 0 ||
+            enc_input->bitstream.allocation_size < enc_api_prv->enc_common.picture_header_dynamic.hdr_Lcod) {
             return SvtJxsErrorBadParameter;
         }
     }
+    else {
+        if (enc_input->bitstream.allocation_size < enc_api_prv->enc_common.picture_header_dynamic.hdr_Lcod) {
+            return SvtJxsErrorBadParameter;
+        }
+
+        pi_t* pi = &enc_api_prv->enc_common.pi;
+        uint8_t input_bit_depth = enc_api_prv->enc_common.bit_depth;
+        uint32_t pixel_size = input_bit_depth <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+        for (uint8_t c = 0; c < pi->comps_num; ++c) {
+            uint32_t min_size;
+            // The last row might be shorter than the stride, e.g. in case the application is encoding
+            // an interlaced image with fields interleaved row by row, but feeding each field individually
+            // to the encoder. In that case the stride would be double the usual stride so the encoder only
+            // encodes every second row, but the last row of the second field would only have a single row
+            // of data left in it (half the stride in that case).
+            min_size = enc_input->image.stride[c] * pixel_size * (pi->components[c].height - 1);
+            min_size += pi->components[c].width * pixel_size;
+            if (enc_input->image.alloc_size[c] < min_size) {
+                return SvtJxsErrorBadParameter;
+            }
+        }
+    }
 
     ObjectWrapper_t* wrapper_ptr = NULL;
 #ifdef FLAG_DEADLOCK_DETECT
@@ -982,6 +1395,14 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_send_picture(svt_jpeg_xs_encode
     if (wrapper_ptr && (ret == SvtJxsErrorNone)) {
         EncoderInputItem* input_item = (EncoderInputItem*)wrapper_ptr->object_ptr;
         input_item->enc_input = *enc_input; //Copy input structure
+        if (!enc_api_prv->enc_common.statistics) {
+            input_item->enc_input.stats = NULL;
+        }
+        else if (enc_input->stats) {
+            memset(enc_input->stats, 0, offsetof(svt_jpeg_xs_frame_stats_t, slices));
+            enc_input->stats->slices_num = enc_api_prv->enc_common.pi.slice_num;
+            enc_input->stats->send_ns = get_current_time_ns();
+        }
         input_item->frame_number = enc_api_prv->frame_number;
         enc_api_prv->frame_number++;
         svt_jxs_post_full_object(wrapper_ptr);
@@ -1017,6 +1438,9 @@ PREFIX_API SvtJxsErrorType_t svt_jpeg_xs_encoder_get_packet(svt_jpeg_xs_encoder_
         EncoderOutputItem* output_item = (EncoderOutputItem*)wrapper_ptr->object_ptr;
         // return the output stream buffer
         *enc_output = output_item->enc_input; //Copy structure
+        if (enc_output->stats && enc_output->bitstream.last_packet_in_frame) {
+            enc_output->stats->output_ns = get_current_time_ns();
+        }
         int32_t error = output_item->frame_error;
         if (error) {
             return_error = SvtJxsErrorEncodeFrameError;
@@ -11,6 +11,8 @@
 #include "Encoder.h"
 #include "Threads/SystemResourceManager.h"
 #include "Threads/SvtThreads.h"
+#include "Threads/SvtThreadPool.h"
+#include "Threads/SvtArena.h"
 
 typedef struct ThreadContext {
     DctorCall dctor;
@@ -43,6 +45,8 @@ typedef struct svt_jpeg_xs_encoder_api_prv {
 
     // picture control set pool
     SystemResource_t *picture_control_set_pool_ptr;
+    // ring of slice coefficient buffers, only in CPU_PROFILE_CPU
+    SystemResource_t *coeff_slice_pool_ptr;
 
     svt_jpeg_xs_encoder_common_t enc_common; /*Common encoder*/
 
@@ -53,6 +57,10 @@ typedef struct svt_jpeg_xs_encoder_api_prv {
     uint32_t sync_output_ringbuffer_size;
     CondVar sync_output_ringbuffer_left;
 
+    // Thread placement, thread_placement_ptr is NULL when placement is not set
+    svt_jpeg_xs_thread_placement_t thread_placement;
+    const svt_jpeg_xs_thread_placement_t *thread_placement_ptr;
+
     // Thread Handles
     Handle_t init_stage_thread_handle;
     Handle_t *dwt_stage_thread_handle_array;
@@ -74,11 +82,21 @@ typedef struct svt_jpeg_xs_encoder_api_prv {
     SystemResource_t *pack_input_resource_ptr;
     SystemResource_t *pack_output_resource_ptr;
 
+    // Used only when slice tasks are executed by caller threads (external_tasks)
+    Fifo_t *pack_input_consumer_fifo_ptr;
+    int32_t *pack_stage_context_busy_array;
+    Handle_t pack_stage_context_free_semaphore;
+
     SystemResource_t *output_queue_resource_ptr;
     Fifo_t *output_queue_producer_fifo_ptr;
     Fifo_t *output_queue_consumer_fifo_ptr;
 
     uint64_t frame_number;
+
+    // Account of heap buffers allocated by instance
+    MemoryAccount_t *memory_account;
+    // Arena of all buffers when memory_flags are set, released after buffers on close
+    MemoryArena_t *arena;
 } svt_jpeg_xs_encoder_api_prv_t;
 
 #endif /*_ENCODER_HANDLE_H_*/
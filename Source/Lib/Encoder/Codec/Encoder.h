@@ -8,6 +8,8 @@
 
 #include "PiEnc.h"
 #include "PrecinctEnc.h"
+#include "Dwt.h"
+#include "encoder_dsp_rtcd.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,6 +69,7 @@ typedef struct svt_jpeg_xs_encoder_common {
 
     pi_t pi; /* Picture Information */
     picture_header_dynamic_t picture_header_dynamic;
+    dwt_16bit_params_t dwt_16bit; /* First horizontal DWT level in 16 bits for V0 when enabled */
     pi_enc_t pi_enc; /* Picture Information for encoder, allocate buffers pointers etc.*/
 
     RateControlType rate_control_mode;
@@ -98,6 +101,48 @@ typedef struct svt_jpeg_xs_encoder_common {
     */
     uint32_t *slice_sizes;
     uint8_t slice_packetization_mode;
+    uint8_t streaming; /*Lines of frames are read and codestream is written by svt_jpeg_xs_frame_t::stream callbacks*/
+    uint8_t statistics; /*Fill svt_jpeg_xs_frame_t::stats of every frame*/
+
+    /*
+    * Kernels resolved for use_cpu_flags of this instance,
+    * bound to every encoder thread when it starts.
+    */
+    common_rtcd_t common_rtcd;
+    encoder_rtcd_t encoder_rtcd;
+
+    /*
+    * Client of shared thread pool that execute Pack Stage tasks,
+    * NULL when encoder create own Pack Stage threads.
+    */
+    struct ThreadPoolClient *pack_stage_pool_client;
+
+    /*
+    * Source codestream parser when transcode is enabled, coefficients of precincts are unpacked in Pack Stage,
+    * NULL when image is encoded.
+    */
+    struct Transcode *transcode;
+
+    /*
+    * Packed slices of previous frames copied when input of slice is unchanged (reuse_unchanged_slices),
+    * NULL when every slice is encoded.
+    */
+    struct SliceReuse *slice_reuse;
+
+    /*
+    * Slice coefficient buffers taken in order of slices by DWT Stage or Pack Stage in profile CPU,
+    * NULL in profile Latency.
+    */
+    struct CoeffSliceRing *coeff_slice_ring;
+
+    /*
+    * Pack Stage tasks executed by caller threads (external_tasks),
+    * callback notify caller about every new task.
+    */
+    uint8_t external_tasks;
+    struct svt_jpeg_xs_encoder_api *callback_task_encoder_ctx;
+    void (*callback_task_available)(struct svt_jpeg_xs_encoder_api *encoder, void *context);
+    void *callback_task_available_context;
 } svt_jpeg_xs_encoder_common_t;
 
 #ifdef __cplusplus
@@ -14,6 +14,7 @@
 #include "SvtLog.h"
 #include "Threads/SvtObject.h"
 #include "SvtUtility.h"
+#include "SvtTrace.h"
 #include "common_dsp_rtcd.h"
 
 typedef struct FinalStageContext {
@@ -59,6 +60,33 @@ SvtJxsErrorType_t final_stage_context_ctor(ThreadContext_t *thread_contxt_ptr, s
     return SvtJxsErrorNone;
 }
 
+/*Statistics: collect slice and when frame is complete reduce DWT time of components.*/
+static void final_stage_statistics_slice(PictureControlSet *pcs_ptr, const PackOutput *pack_result) {
+    svt_jpeg_xs_frame_stats_t *stats = pcs_ptr->enc_input.stats;
+    const svt_jpeg_xs_slice_stats_t *slice_stats = &pack_result->slice_stats;
+    if (pcs_ptr->slice_cnt == 1) {
+        stats->slices_begin_ns = slice_stats->begin_ns;
+        stats->slices_end_ns = slice_stats->end_ns;
+    }
+    else {
+        stats->slices_begin_ns = MIN(stats->slices_begin_ns, slice_stats->begin_ns);
+        stats->slices_end_ns = MAX(stats->slices_end_ns, slice_stats->end_ns);
+    }
+    if (stats->slices && pack_result->slice_idx < stats->slices_size) {
+        stats->slices[pack_result->slice_idx] = *slice_stats;
+    }
+
+    if (pcs_ptr->slice_cnt == pcs_ptr->enc_common->pi.slice_num) {
+        stats->final_ready_ns = get_current_time_ns();
+        for (uint32_t c = 0; c < pcs_ptr->enc_common->pi.comps_num; c++) {
+            if (pcs_ptr->dwt_begin_ns[c] && (stats->dwt_begin_ns == 0 || pcs_ptr->dwt_begin_ns[c] < stats->dwt_begin_ns)) {
+                stats->dwt_begin_ns = pcs_ptr->dwt_begin_ns[c];
+            }
+            stats->dwt_end_ns = MAX(stats->dwt_end_ns, pcs_ptr->dwt_end_ns[c]);
+        }
+    }
+}
+
 /* Final Stage Kernel */
 /*********************************************************************************
  *
@@ -93,6 +121,8 @@ void *final_stage_kernel(void *input_ptr) {
     ObjectWrapper_t **sync_output_ringbuffer = enc_api_prv->sync_output_ringbuffer;
     uint32_t sync_output_ringbuffer_size = enc_api_prv->sync_output_ringbuffer_size;
     CondVar *sync_output_ringbuffer_left = &enc_api_prv->sync_output_ringbuffer_left;
+    bind_common_rtcd(&enc_api_prv->enc_common.common_rtcd);
+    bind_encoder_rtcd(&enc_api_prv->enc_common.encoder_rtcd);
 
     uint64_t ring_buffer_index = 0;
     PictureControlSet *pcs_ptr;
@@ -116,8 +146,14 @@ void *final_stage_kernel(void *input_ptr) {
         }
 
         pcs_ptr = (PictureControlSet *)pack_result->pcs_wrapper_ptr->object_ptr;
+        /*PCS can be released before end of this task, keep frame number.*/
+        const uint64_t frame_number = pcs_ptr->frame_number;
+        SVT_TRACE_BEGIN("enc_final", frame_number, pack_result->slice_idx);
         pcs_ptr->slice_cnt++;
         pcs_ptr->frame_error |= pack_result->slice_error;
+        if (pcs_ptr->enc_input.stats) {
+            final_stage_statistics_slice(pcs_ptr, pack_result);
+        }
 
 #ifdef FLAG_DEADLOCK_DETECT
         printf("Receive Frame=%llu slice_idx=%d\n", pcs_ptr->frame_number, pack_result->slice_idx);
@@ -127,15 +163,15 @@ void *final_stage_kernel(void *input_ptr) {
             pcs_ptr->slice_ready_to_release_arr[pack_result->slice_idx] = 1;
         }
 
-        if (sync_output_ringbuffer[pcs_ptr->frame_number % sync_output_ringbuffer_size] == NULL) {
-            sync_output_ringbuffer[pcs_ptr->frame_number % sync_output_ringbuffer_size] = pack_result->pcs_wrapper_ptr;
+        if (sync_output_ringbuffer[frame_number % sync_output_ringbuffer_size] == NULL) {
+            sync_output_ringbuffer[frame_number % sync_output_ringbuffer_size] = pack_result->pcs_wrapper_ptr;
         }
         else {
-            ObjectWrapper_t *pcs_ringbuffer_obj = sync_output_ringbuffer[pcs_ptr->frame_number % sync_output_ringbuffer_size];
+            ObjectWrapper_t *pcs_ringbuffer_obj = sync_output_ringbuffer[frame_number % sync_output_ringbuffer_size];
             PictureControlSet *pcs_ringbuffer_ptr = (PictureControlSet *)pcs_ringbuffer_obj->object_ptr;
-            if ((pcs_ringbuffer_obj != pack_result->pcs_wrapper_ptr) ||
-                (pcs_ringbuffer_ptr->frame_number != pcs_ptr->frame_number)) {
+            if ((pcs_ringbuffer_obj != pack_result->pcs_wrapper_ptr) || (pcs_ringbuffer_ptr->frame_number != frame_number)) {
                 fprintf(stderr, "FATAL ERROR [%s:%i] Final thread ring is full\n", __func__, __LINE__);
+                SVT_TRACE_END("enc_final", frame_number, pack_result->slice_idx);
                 // TODO: Return internal error
                 continue;
             }
@@ -195,6 +231,9 @@ void *final_stage_kernel(void *input_ptr) {
                         output_item->enc_input.bitstream.last_packet_in_frame = 1;
                         output_item->enc_input.bitstream.ready_to_release = 1;
                         output_item->enc_input.image.ready_to_release = 1;
+                        if (output_item->enc_input.stats) {
+                            output_item->enc_input.stats->final_send_ns = get_current_time_ns();
+                        }
                     }
 #ifdef FLAG_DEADLOCK_DETECT
                     printf("[%s:%i] Return Frame=%llu slice_idx=%d\n",
@@ -231,6 +270,9 @@ void *final_stage_kernel(void *input_ptr) {
                     output_item->enc_input.bitstream.last_packet_in_frame = 1;
                     output_item->enc_input.bitstream.ready_to_release = 1;
                     output_item->enc_input.image.ready_to_release = 1;
+                    if (output_item->enc_input.stats) {
+                        output_item->enc_input.stats->final_send_ns = get_current_time_ns();
+                    }
 
                     svt_jxs_post_full_object(output_item_wrapper_ptr);
                     if (callback_get) {
@@ -257,6 +299,7 @@ void *final_stage_kernel(void *input_ptr) {
             }
         }
 
+        SVT_TRACE_END("enc_final", frame_number, pack_result->slice_idx);
         svt_jxs_release_object(input_wrapper_ptr);
     }
     return NULL;
@@ -111,6 +111,19 @@ void precinct_component_calculate_dwt_V0(struct PictureControlSet* pcs_ptr, prec
 
     uint16_t* buffer_out_16bit = (uint16_t*)precinct->coeff_buff_ptr_16bit[comp_id];
 
+    if (enc_common->dwt_16bit.enable && plane_width >= DWT_16BIT_WIDTH_MIN) {
+        transform_V0_Hx_16bit(component,
+                              component_enc,
+                              plane_buffer_in,
+                              input_bit_depth,
+                              &enc_common->dwt_16bit,
+                              buffer_out_16bit,
+                              param_out_Fq,
+                              plane_width,
+                              buffers_tmp_dwt->buffer_tmp);
+        return;
+    }
+
     transform_V0_ptr_t transform_V0_Hn = transform_V0_get_function_ptr(pi->components[comp_id].decom_h);
     assert(transform_V0_Hn != NULL);
     //transform_V0_H1, transform_V0_H2, transform_V0_H3, transform_V0_H4, transform_V0_H5
@@ -348,35 +361,45 @@ void precinct_component_calculate_dwt_V2(struct PictureControlSet* pcs_ptr, uint
     buffers_dwt_tmp->V2.buffer_next = tmp;
 }
 
-void set_planar_input_pointers(uint32_t line_idx, const void* plane_buffer_in[13], struct PictureControlSet* pcs_ptr,
-                               uint32_t comp) {
+/*Input line of component from image of frame, or from band of lines read by pack task in streaming.*/
+static INLINE const uint8_t* get_input_line(struct PictureControlSet* pcs_ptr, PackInput_t* pack_input, uint32_t comp,
+                                            uint32_t line_idx) {
+    const uint32_t pixel_size = pcs_ptr->enc_common->bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+    if (pack_input->stream_band[comp]) {
+        return pack_input->stream_band[comp] +
+            pixel_size * (line_idx - pack_input->stream_band_first_line[comp]) * pack_input->stream_band_stride[comp];
+    }
     const uint8_t* buffer_in_base_addr = pcs_ptr->enc_input.image.data_yuv[comp];
     const uint32_t plane_stride = (uint32_t)pcs_ptr->enc_input.image.stride[comp];
-    const uint32_t pixel_size = pcs_ptr->enc_common->bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+    return buffer_in_base_addr + pixel_size * line_idx * plane_stride;
+}
+
+void set_planar_input_pointers(uint32_t line_idx, const void* plane_buffer_in[13], struct PictureControlSet* pcs_ptr,
+                               PackInput_t* pack_input, uint32_t comp) {
     if (pcs_ptr->enc_common->pi.components[comp].decom_v == 0) {
-        plane_buffer_in[0] = buffer_in_base_addr + pixel_size * line_idx * plane_stride;
+        plane_buffer_in[0] = get_input_line(pcs_ptr, pack_input, comp, line_idx);
     }
     else if (pcs_ptr->enc_common->pi.components[comp].decom_v == 1) {
-        plane_buffer_in[0] = buffer_in_base_addr + pixel_size * (line_idx - 2) * plane_stride;
-        plane_buffer_in[1] = buffer_in_base_addr + pixel_size * (line_idx - 1) * plane_stride;
-        plane_buffer_in[2] = buffer_in_base_addr + pixel_size * (line_idx - 0) * plane_stride;
-        plane_buffer_in[3] = buffer_in_base_addr + pixel_size * (line_idx + 1) * plane_stride;
-        plane_buffer_in[4] = buffer_in_base_addr + pixel_size * (line_idx + 2) * plane_stride;
+        plane_buffer_in[0] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 2);
+        plane_buffer_in[1] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 1);
+        plane_buffer_in[2] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 0);
+        plane_buffer_in[3] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 1);
+        plane_buffer_in[4] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 2);
     }
     else if (pcs_ptr->enc_common->pi.components[comp].decom_v == 2) {
-        plane_buffer_in[0] = buffer_in_base_addr + pixel_size * (line_idx - 6) * plane_stride;
-        plane_buffer_in[1] = buffer_in_base_addr + pixel_size * (line_idx - 5) * plane_stride;
-        plane_buffer_in[2] = buffer_in_base_addr + pixel_size * (line_idx - 4) * plane_stride;
-        plane_buffer_in[3] = buffer_in_base_addr + pixel_size * (line_idx - 3) * plane_stride;
-        plane_buffer_in[4] = buffer_in_base_addr + pixel_size * (line_idx - 2) * plane_stride;
-        plane_buffer_in[5] = buffer_in_base_addr + pixel_size * (line_idx - 1) * plane_stride;
-        plane_buffer_in[6] = buffer_in_base_addr + pixel_size * (line_idx - 0) * plane_stride;
-        plane_buffer_in[7] = buffer_in_base_addr + pixel_size * (line_idx + 1) * plane_stride;
-        plane_buffer_in[8] = buffer_in_base_addr + pixel_size * (line_idx + 2) * plane_stride;
-        plane_buffer_in[9] = buffer_in_base_addr + pixel_size * (line_idx + 3) * plane_stride;
-        plane_buffer_in[10] = buffer_in_base_addr + pixel_size * (line_idx + 4) * plane_stride;
-        plane_buffer_in[11] = buffer_in_base_addr + pixel_size * (line_idx + 5) * plane_stride;
-        plane_buffer_in[12] = buffer_in_base_addr + pixel_size * (line_idx + 6) * plane_stride;
+        plane_buffer_in[0] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 6);
+        plane_buffer_in[1] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 5);
+        plane_buffer_in[2] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 4);
+        plane_buffer_in[3] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 3);
+        plane_buffer_in[4] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 2);
+        plane_buffer_in[5] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 1);
+        plane_buffer_in[6] = get_input_line(pcs_ptr, pack_input, comp, line_idx - 0);
+        plane_buffer_in[7] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 1);
+        plane_buffer_in[8] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 2);
+        plane_buffer_in[9] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 3);
+        plane_buffer_in[10] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 4);
+        plane_buffer_in[11] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 5);
+        plane_buffer_in[12] = get_input_line(pcs_ptr, pack_input, comp, line_idx + 6);
     }
 }
 
@@ -413,9 +436,7 @@ void convert_packed_to_planar_rgb_16bit_c(const void* in_rgb, void* out_comp1, v
 }
 
 void set_packed_input_pointers_precalc(uint32_t line_idx, void* plane_buffer_in[3][13], struct PictureControlSet* pcs_ptr,
-                                       void* buffer_tmp, convert_fn packed_to_planar_fn) {
-    const uint8_t* buffer_in_base_addr = pcs_ptr->enc_input.image.data_yuv[0];
-    const uint32_t plane_stride = (uint32_t)pcs_ptr->enc_input.image.stride[0];
+                                       PackInput_t* pack_input, void* buffer_tmp, convert_fn packed_to_planar_fn) {
     const uint32_t pixel_size = pcs_ptr->enc_common->bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
     uint32_t plane_height = pcs_ptr->enc_common->pi.components[0].height;
     uint32_t plane_width = pcs_ptr->enc_common->pi.components[0].width;
@@ -438,18 +459,18 @@ void set_packed_input_pointers_precalc(uint32_t line_idx, void* plane_buffer_in[
 
         if (line_idx > 0) {
             assert(line_idx >= 2);
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 2) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 2),
                                 plane_buffer_in[0][0],
                                 plane_buffer_in[1][0],
                                 plane_buffer_in[2][0],
                                 plane_width);
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 1) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 1),
                                 plane_buffer_in[0][1],
                                 plane_buffer_in[1][1],
                                 plane_buffer_in[2][1],
                                 plane_width);
         }
-        packed_to_planar_fn(buffer_in_base_addr + (line_idx - 0) * plane_stride * pixel_size,
+        packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 0),
                             plane_buffer_in[0][2],
                             plane_buffer_in[1][2],
                             plane_buffer_in[2][2],
@@ -493,61 +514,61 @@ void set_packed_input_pointers_precalc(uint32_t line_idx, void* plane_buffer_in[
         plane_buffer_in[2][8] = (uint8_t*)buffer_tmp + pcs_ptr->enc_common->pi.width * 26 * pixel_size;
 
         if (line_idx >= 6) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 6) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 6),
                                 plane_buffer_in[0][0],
                                 plane_buffer_in[1][0],
                                 plane_buffer_in[2][0],
                                 plane_width);
         }
         if (line_idx >= 5) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 5) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 5),
                                 plane_buffer_in[0][1],
                                 plane_buffer_in[1][1],
                                 plane_buffer_in[2][1],
                                 plane_width);
         }
         if (line_idx >= 4) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 4) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 4),
                                 plane_buffer_in[0][2],
                                 plane_buffer_in[1][2],
                                 plane_buffer_in[2][2],
                                 plane_width);
         }
         if (line_idx >= 3) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 3) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 3),
                                 plane_buffer_in[0][3],
                                 plane_buffer_in[1][3],
                                 plane_buffer_in[2][3],
                                 plane_width);
         }
         if (line_idx >= 2) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 2) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 2),
                                 plane_buffer_in[0][4],
                                 plane_buffer_in[1][4],
                                 plane_buffer_in[2][4],
                                 plane_width);
         }
         if (line_idx >= 1) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx - 1) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 1),
                                 plane_buffer_in[0][5],
                                 plane_buffer_in[1][5],
                                 plane_buffer_in[2][5],
                                 plane_width);
         }
-        packed_to_planar_fn(buffer_in_base_addr + (line_idx - 0) * plane_stride * pixel_size,
+        packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx - 0),
                             plane_buffer_in[0][6],
                             plane_buffer_in[1][6],
                             plane_buffer_in[2][6],
                             plane_width);
         if (line_idx + 1 < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 1) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 1),
                                 plane_buffer_in[0][7],
                                 plane_buffer_in[1][7],
                                 plane_buffer_in[2][7],
                                 plane_width);
         }
         if (line_idx + 2 < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 2) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 2),
                                 plane_buffer_in[0][8],
                                 plane_buffer_in[1][8],
                                 plane_buffer_in[2][8],
@@ -557,9 +578,7 @@ void set_packed_input_pointers_precalc(uint32_t line_idx, void* plane_buffer_in[
 }
 
 void set_packed_input_pointers_calc(uint32_t line_idx, void* plane_buffer_in[3][13], struct PictureControlSet* pcs_ptr,
-                                    void* buffer_tmp, convert_fn packed_to_planar_fn) {
-    const uint8_t* buffer_in_base_addr = pcs_ptr->enc_input.image.data_yuv[0];
-    const uint32_t plane_stride = (uint32_t)pcs_ptr->enc_input.image.stride[0];
+                                    PackInput_t* pack_input, void* buffer_tmp, convert_fn packed_to_planar_fn) {
     const uint32_t pixel_size = pcs_ptr->enc_common->bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
     uint32_t plane_height = pcs_ptr->enc_common->pi.components[0].height;
     uint32_t plane_width = pcs_ptr->enc_common->pi.components[0].width;
@@ -568,7 +587,7 @@ void set_packed_input_pointers_calc(uint32_t line_idx, void* plane_buffer_in[3][
         plane_buffer_in[0][0] = (uint8_t*)buffer_tmp + pcs_ptr->enc_common->pi.width * 0 * pixel_size;
         plane_buffer_in[1][0] = (uint8_t*)buffer_tmp + pcs_ptr->enc_common->pi.width * 1 * pixel_size;
         plane_buffer_in[2][0] = (uint8_t*)buffer_tmp + pcs_ptr->enc_common->pi.width * 2 * pixel_size;
-        packed_to_planar_fn(buffer_in_base_addr + line_idx * plane_stride * pixel_size,
+        packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx),
                             plane_buffer_in[0][0],
                             plane_buffer_in[1][0],
                             plane_buffer_in[2][0],
@@ -584,7 +603,7 @@ void set_packed_input_pointers_calc(uint32_t line_idx, void* plane_buffer_in[3][
         plane_buffer_in[2][4] = (uint8_t*)buffer_tmp + pcs_ptr->enc_common->pi.width * 5 * pixel_size;
 
         if ((line_idx + 1) < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 1) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 1),
                                 plane_buffer_in[0][3],
                                 plane_buffer_in[1][3],
                                 plane_buffer_in[2][3],
@@ -592,7 +611,7 @@ void set_packed_input_pointers_calc(uint32_t line_idx, void* plane_buffer_in[3][
         }
 
         if ((line_idx + 2) < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 2) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 2),
                                 plane_buffer_in[0][4],
                                 plane_buffer_in[1][4],
                                 plane_buffer_in[2][4],
@@ -617,28 +636,28 @@ void set_packed_input_pointers_calc(uint32_t line_idx, void* plane_buffer_in[3][
         plane_buffer_in[2][12] = (uint8_t*)buffer_tmp + pcs_ptr->enc_common->pi.width * 11 * pixel_size;
 
         if ((line_idx + 3) < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 3) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 3),
                                 plane_buffer_in[0][9],
                                 plane_buffer_in[1][9],
                                 plane_buffer_in[2][9],
                                 plane_width);
         }
         if ((line_idx + 4) < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 4) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 4),
                                 plane_buffer_in[0][10],
                                 plane_buffer_in[1][10],
                                 plane_buffer_in[2][10],
                                 plane_width);
         }
         if ((line_idx + 5) < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 5) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 5),
                                 plane_buffer_in[0][11],
                                 plane_buffer_in[1][11],
                                 plane_buffer_in[2][11],
                                 plane_width);
         }
         if ((line_idx + 6) < plane_height) {
-            packed_to_planar_fn(buffer_in_base_addr + (line_idx + 6) * plane_stride * pixel_size,
+            packed_to_planar_fn(get_input_line(pcs_ptr, pack_input, 0, line_idx + 6),
                                 plane_buffer_in[0][12],
                                 plane_buffer_in[1][12],
                                 plane_buffer_in[2][12],
@@ -647,9 +666,32 @@ void set_packed_input_pointers_calc(uint32_t line_idx, void* plane_buffer_in[3][
     }
 }
 
+void precinct_component_calculate_gc(struct svt_jpeg_xs_encoder_common* enc_common, precinct_enc_t* precinct, uint32_t c) {
+    pi_t* pi = &enc_common->pi;
+    for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
+        struct band_data_enc* band = &(precinct->bands[c][b]);
+        const uint32_t height_lines = precinct->p_info->b_info[c][b].height;
+        const uint32_t width = precinct->p_info->b_info[c][b].width;
+        const uint32_t gcli_width = precinct->p_info->b_info[c][b].gcli_width;
+        for (uint32_t line_idx = 0; line_idx < height_lines; ++line_idx) {
+            gc_precinct_stage_scalar(band->lines_common[line_idx].gcli_data_ptr,
+                                     band->lines_common[line_idx].coeff_data_ptr_16bit,
+                                     pi->coeff_group_size,
+                                     width);
+            if (enc_common->coding_significance) {
+                //Precalculate Data Size
+                gc_precinct_sigflags_max(band->lines_common[line_idx].significance_data_max_ptr,
+                                         band->lines_common[line_idx].gcli_data_ptr,
+                                         pi->significance_group_size,
+                                         gcli_width);
+            }
+        }
+    }
+}
+
 void precinct_calculate_data(struct PictureControlSet* pcs_ptr, precinct_enc_t* precinct, PackInput_t* pack_input,
                              struct precinct_calc_dwt_buff_tmp* buffers_dwt_tmp,
-                             struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component, uint32_t prec_idx_in_slice) {
+                             struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component, uint8_t precalculate_slice) {
     svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
     pi_t* pi = &enc_common->pi;
 
@@ -661,9 +703,13 @@ void precinct_calculate_data(struct PictureControlSet* pcs_ptr, precinct_enc_t*
 
         const uint32_t line_idx = precinct->prec_idx * pi->components[0].precinct_height;
         void* plane_buffer_in[3][13] = {0};
-        if (prec_idx_in_slice == 0 && pi->decom_v != 0) {
-            set_packed_input_pointers_precalc(
-                line_idx, plane_buffer_in, pcs_ptr, buffers_dwt_tmp->buffer_unpacked_color_formats, packed_to_planar_fn);
+        if (precalculate_slice && pi->decom_v != 0) {
+            set_packed_input_pointers_precalc(line_idx,
+                                              plane_buffer_in,
+                                              pcs_ptr,
+                                              pack_input,
+                                              buffers_dwt_tmp->buffer_unpacked_color_formats,
+                                              packed_to_planar_fn);
 
             for (uint32_t c = 0; c < pi->comps_num; ++c) {
                 if (pi->components[c].decom_v == 1) {
@@ -685,8 +731,12 @@ void precinct_calculate_data(struct PictureControlSet* pcs_ptr, precinct_enc_t*
             }
         }
 
-        set_packed_input_pointers_calc(
-            line_idx, plane_buffer_in, pcs_ptr, buffers_dwt_tmp->buffer_unpacked_color_formats, packed_to_planar_fn);
+        set_packed_input_pointers_calc(line_idx,
+                                       plane_buffer_in,
+                                       pcs_ptr,
+                                       pack_input,
+                                       buffers_dwt_tmp->buffer_unpacked_color_formats,
+                                       packed_to_planar_fn);
         for (uint32_t c = 0; c < pi->comps_num; ++c) {
             if (pi->components[c].decom_v == 0) {
                 precinct_component_calculate_dwt_V0(pcs_ptr, precinct, c, buffers_dwt_tmp, (const void*)plane_buffer_in[c][0]);
@@ -710,35 +760,18 @@ void precinct_calculate_data(struct PictureControlSet* pcs_ptr, precinct_enc_t*
                                                     (const void**)plane_buffer_in[c]);
             }
 
-            for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
-                struct band_data_enc* band = &(precinct->bands[c][b]);
-                const uint32_t height_lines = precinct->p_info->b_info[c][b].height;
-                const uint32_t width = precinct->p_info->b_info[c][b].width;
-                const uint32_t gcli_width = precinct->p_info->b_info[c][b].gcli_width;
-                for (uint32_t line_idx = 0; line_idx < height_lines; ++line_idx) {
-                    gc_precinct_stage_scalar(band->lines_common[line_idx].gcli_data_ptr,
-                                             band->lines_common[line_idx].coeff_data_ptr_16bit,
-                                             pi->coeff_group_size,
-                                             width);
-                    if (pcs_ptr->enc_common->coding_significance) {
-                        //Precalculate Data Size
-                        gc_precinct_sigflags_max(band->lines_common[line_idx].significance_data_max_ptr,
-                                                 band->lines_common[line_idx].gcli_data_ptr,
-                                                 pi->significance_group_size,
-                                                 gcli_width);
-                    }
-                }
-            }
+            precinct_component_calculate_gc(enc_common, precinct, c);
         }
     } //planar input image support
     else {
         for (uint32_t c = 0; c < pi->comps_num; ++c) {
             const void* plane_buffer_in[13] = {0};
             const uint32_t line_idx = precinct->prec_idx * pi->components[c].precinct_height;
-            set_planar_input_pointers(line_idx, plane_buffer_in, pcs_ptr, c);
+            set_planar_input_pointers(line_idx, plane_buffer_in, pcs_ptr, pack_input, c);
 
-            if ((enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY) && (prec_idx_in_slice == 0)) {
-                //Precalculate only for first precinct in slice, then reuse common data for DWT
+            if ((enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY) && precalculate_slice) {
+                //Precalculate only for first precinct in slice when state of previous slice is not available,
+                //then reuse common data for DWT
                 if (pi->components[c].decom_v == 1) {
                     precinct_component_calculate_dwt_V1_precalculate_slice(
                         pcs_ptr, c, precinct->prec_idx, buffers_dwt_tmp, buffers_dwt_per_component, plane_buffer_in);
@@ -781,25 +814,7 @@ void precinct_calculate_data(struct PictureControlSet* pcs_ptr, precinct_enc_t*
                 }
             }
 
-            for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
-                struct band_data_enc* band = &(precinct->bands[c][b]);
-                const uint32_t height_lines = precinct->p_info->b_info[c][b].height;
-                const uint32_t width = precinct->p_info->b_info[c][b].width;
-                const uint32_t gcli_width = precinct->p_info->b_info[c][b].gcli_width;
-                for (uint32_t line_idx = 0; line_idx < height_lines; ++line_idx) {
-                    gc_precinct_stage_scalar(band->lines_common[line_idx].gcli_data_ptr,
-                                             band->lines_common[line_idx].coeff_data_ptr_16bit,
-                                             pi->coeff_group_size,
-                                             width);
-                    if (pcs_ptr->enc_common->coding_significance) {
-                        //Precalculate Data Size
-                        gc_precinct_sigflags_max(band->lines_common[line_idx].significance_data_max_ptr,
-                                                 band->lines_common[line_idx].gcli_data_ptr,
-                                                 pi->significance_group_size,
-                                                 gcli_width);
-                    }
-                }
-            }
+            precinct_component_calculate_gc(enc_common, precinct, c);
         }
     }
 }
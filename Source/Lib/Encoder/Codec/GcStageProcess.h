@@ -89,9 +89,12 @@ void precinct_component_calculate_dwt_V2(struct PictureControlSet* pcs_ptr, uint
                                          struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component,
                                          const void** plane_buffer_in);
 
+struct svt_jpeg_xs_encoder_common;
+/*Calculate GCLI and significance of all bands of component from coefficients of precinct.*/
+void precinct_component_calculate_gc(struct svt_jpeg_xs_encoder_common* enc_common, precinct_enc_t* precinct, uint32_t c);
 void precinct_calculate_data(struct PictureControlSet* pcs_ptr, precinct_enc_t* precinct, PackInput_t* pack_input,
                              struct precinct_calc_dwt_buff_tmp* buffers_dwt_tmp,
-                             struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component, uint32_t prec_idx_in_slice);
+                             struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component, uint8_t precalculate_slice);
 void gc_precinct_stage_scalar_c(uint8_t* gcli_data_ptr, uint16_t* coeff_data_ptr_16bit, uint32_t group_size, uint32_t width);
 void gc_precinct_stage_scalar_loop_c(uint32_t line_groups_num, uint16_t* coeff_data_ptr_16bit, uint8_t* gcli_data_ptr);
 
@@ -14,13 +14,16 @@
 #include "SvtLog.h"
 #include "Threads/SvtObject.h"
 #include "SvtUtility.h"
+#include "SvtTrace.h"
 #include "common_dsp_rtcd.h"
 #include "PreRcStageProcess.h"
 #include "PackIn.h"
+#include "Transcode.h"
 
 typedef struct InitStageContext {
     Fifo_t *dwt_stage_input_fifo_ptr;
     Fifo_t *pack_input_buffer_fifo_ptr;
+    Fifo_t *pack_output_fifo_ptr;
     Fifo_t *picture_control_set_fifo_ptr;
     svt_jpeg_xs_encoder_api_prv_t *enc_api_prv;
 } InitStageContext;
@@ -77,6 +80,8 @@ SvtJxsErrorType_t init_stage_context_ctor(ThreadContext_t *thread_contxt_ptr, sv
                                                                                             0);
     }
 
+    context_ptr->pack_output_fifo_ptr = svt_jxs_system_resource_get_producer_fifo(enc_api_prv->pack_output_resource_ptr, 0);
+
     context_ptr->enc_api_prv = enc_api_prv;
 
     return error;
@@ -154,6 +159,8 @@ void *init_stage_kernel(void *input_ptr) {
     InitStageContext *context_ptr = (InitStageContext *)enc_contxt_ptr->priv;
     svt_jpeg_xs_encoder_api_prv_t *enc_api_prv = context_ptr->enc_api_prv;
     CondVar *sync_output_ringbuffer_left = &enc_api_prv->sync_output_ringbuffer_left;
+    bind_common_rtcd(&enc_api_prv->enc_common.common_rtcd);
+    bind_encoder_rtcd(&enc_api_prv->enc_common.encoder_rtcd);
 
     ObjectWrapper_t *pcs_wrapper_ptr = NULL;
     ObjectWrapper_t *input_wrapper_ptr, *dwt_input_wrapper_ptr = NULL;
@@ -173,12 +180,18 @@ void *init_stage_kernel(void *input_ptr) {
         SVT_GET_FULL_OBJECT(enc_api_prv->input_image_consumer_fifo_ptr, &input_wrapper_ptr);
 
         EncoderInputItem *input_item = (EncoderInputItem *)input_wrapper_ptr->object_ptr;
+        svt_jpeg_xs_frame_stats_t *stats = input_item->enc_input.stats;
+        if (stats) {
+            stats->init_begin_ns = get_current_time_ns();
+        }
+        SVT_TRACE_BEGIN("enc_init", input_item->frame_number, -1);
 #ifdef FLAG_DEADLOCK_DETECT
         printf("01[%s:%i] frame: %03li\n", __func__, __LINE__, (size_t)input_item->frame_number);
 #endif
         // Get a New PCS where we will hold the new input_picture
         SvtJxsErrorType_t ret = svt_jxs_get_empty_object(context_ptr->picture_control_set_fifo_ptr, &pcs_wrapper_ptr);
         if (ret != SvtJxsErrorNone || pcs_wrapper_ptr == NULL) {
+            SVT_TRACE_END("enc_init", input_item->frame_number, -1);
             continue;
         }
         PictureControlSet *pcs_ptr = (PictureControlSet *)pcs_wrapper_ptr->object_ptr;
@@ -202,7 +215,7 @@ void *init_stage_kernel(void *input_ptr) {
 #ifndef NDEBUG
         /*Check input YUV*/
         uint8_t input_bit_depth = (uint8_t)enc_api_prv->enc_common.bit_depth;
-        if (input_bit_depth > 8) {
+        if (input_bit_depth > 8 && !enc_api_prv->enc_common.streaming && !enc_api_prv->enc_common.transcode) {
             svt_jpeg_xs_image_buffer_t *image_buffer = &pcs_ptr->enc_input.image;
             validate_yuv_range(
                 pi, image_buffer, input_bit_depth, input_item->frame_number, enc_api_prv->enc_common.colour_format);
@@ -212,11 +225,23 @@ void *init_stage_kernel(void *input_ptr) {
         svt_jxs_wait_cond_var(sync_output_ringbuffer_left, 0); //Wait until will be free place in ring buffer
         svt_jxs_add_cond_var(sync_output_ringbuffer_left, -1); //Decrement number of elements to use.
 
+        /*Frame statistics are written only by stages that precede slices tasks or by Final Stage.*/
+        if (stats) {
+            memset(pcs_ptr->dwt_begin_ns, 0, sizeof(pcs_ptr->dwt_begin_ns));
+            memset(pcs_ptr->dwt_end_ns, 0, sizeof(pcs_ptr->dwt_end_ns));
+            stats->init_end_ns = get_current_time_ns();
+        }
+
         SVT_DEBUG("%s, PCS out %lu\n", __func__, input_item->frame_number);
+        /*Pool workers are shared with other instances, reserve output of slices here instead of in pool task.*/
+        Fifo_t *pack_output_fifo_ptr = pcs_ptr->enc_common->pack_stage_pool_client ? context_ptr->pack_output_fifo_ptr : NULL;
         if (pcs_ptr->enc_common->cpu_profile == CPU_PROFILE_CPU) {
             //CPU
-            PackInput_t *list_slices = pre_rc_send_frame_to_pack_slices(
-                pcs_ptr, context_ptr->pack_input_buffer_fifo_ptr, input_item->frame_number, pcs_wrapper_ptr);
+            PackInput_t *list_slices = pre_rc_send_frame_to_pack_slices(pcs_ptr,
+                                                                        context_ptr->pack_input_buffer_fifo_ptr,
+                                                                        pack_output_fifo_ptr,
+                                                                        input_item->frame_number,
+                                                                        pcs_wrapper_ptr);
 #ifndef NDEBUG
             if (pi->decom_v != 0) {
                 volatile PackInput_t *list_slice_next_tmp = list_slices;
@@ -251,10 +276,17 @@ void *init_stage_kernel(void *input_ptr) {
         else {
             assert(pcs_ptr->enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY);
             //LOW LATENCY
-            pre_rc_send_frame_to_pack_slices(
-                pcs_ptr, context_ptr->pack_input_buffer_fifo_ptr, input_item->frame_number, pcs_wrapper_ptr);
+            if (pcs_ptr->enc_common->transcode) {
+                transcode_frame_init(pcs_ptr->enc_common->transcode, pcs_ptr);
+            }
+            pre_rc_send_frame_to_pack_slices(pcs_ptr,
+                                             context_ptr->pack_input_buffer_fifo_ptr,
+                                             pack_output_fifo_ptr,
+                                             input_item->frame_number,
+                                             pcs_wrapper_ptr);
         }
 
+        SVT_TRACE_END("enc_init", input_item->frame_number, -1);
         svt_jxs_release_object(input_wrapper_ptr);
     }
 
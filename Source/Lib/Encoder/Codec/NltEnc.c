@@ -30,6 +30,26 @@ void image_shift_c(uint16_t* out_coeff_16bit, int32_t* in_coeff_32bit, uint32_t
     }
 }
 
+/*Sign and magnitude like image_shift_c(), input of 16 bit path never reach -32768.*/
+void image_shift_int16_c(uint16_t* out_coeff_16bit, const int16_t* in_coeff_16bit, uint32_t width, int32_t shift,
+                         int32_t offset) {
+    for (uint32_t i = 0; i < width; i++) {
+        int32_t val = in_coeff_16bit[i];
+        if (val >= 0) {
+            val = (val + offset) >> shift;
+        }
+        else {
+            val = ((-val + offset) >> shift);
+            if (val) {
+                //Avoid keep -0 value
+                val |= BITSTREAM_MASK_SIGN;
+            }
+        }
+        assert((((int32_t)val) & (~BITSTREAM_MASK_SIGN)) <= ((((int32_t)1) << TRUNCATION_MAX) - 1));
+        out_coeff_16bit[i] = val;
+    }
+}
+
 void linear_input_scaling_line_8bit_c(const uint8_t* src, int32_t* dst, uint32_t w, uint8_t shift, int32_t offset) {
     for (uint32_t j = 0; j < w; j++) {
         dst[j] = ((uint32_t)src[j] << shift) - offset;
@@ -70,3 +90,26 @@ void nlt_input_scaling_line(const void* src, int32_t* dst, uint32_t width, pictu
         break;
     }
 }
+
+/*Input scaling fused with first Horizontal DWT level, the same like nlt_input_scaling_line() and dwt_horizontal_line().*/
+void nlt_input_dwt_horizontal_line(const void* src, int32_t* out_lf, int32_t* out_hf, uint32_t width, picture_header_dynamic_t* hdr,
+                                   uint8_t input_bit_depth) {
+    const uint8_t shift = hdr->hdr_Bw - input_bit_depth;
+    const int32_t offset = 1 << (hdr->hdr_Bw - 1);
+    switch (hdr->hdr_Tnlt) {
+    case 0:
+        if (input_bit_depth <= 8) {
+            dwt_horizontal_line_input_8bit(out_lf, out_hf, (const uint8_t*)src, width, shift, offset);
+        }
+        else {
+            assert(input_bit_depth > 8 && input_bit_depth <= 16);
+            dwt_horizontal_line_input_16bit(out_lf, out_hf, (const uint16_t*)src, width, shift, offset, input_bit_depth);
+        }
+        break;
+    case 1:
+    case 2:
+    default:
+        assert(0);
+        break;
+    }
+}
@@ -15,10 +15,16 @@ extern "C" {
 void image_shift_c(uint16_t* out_coeff_16bit, int32_t* in_coeff_32bit, uint32_t width, int32_t shift, int32_t offset);
 void nlt_input_scaling_line(const void* src, int32_t* dst, uint32_t width, picture_header_dynamic_t* hdr,
                             uint8_t input_bit_depth);
+void nlt_input_dwt_horizontal_line(const void* src, int32_t* out_lf, int32_t* out_hf, uint32_t width, picture_header_dynamic_t* hdr,
+                                   uint8_t input_bit_depth);
 void linear_input_scaling_line_8bit_c(const uint8_t* src, int32_t* dst, uint32_t w, uint8_t shift, int32_t offset);
 void linear_input_scaling_line_16bit_c(const uint16_t* src, int32_t* dst, uint32_t w, uint8_t shift, int32_t offset,
                                        uint8_t bit_depth);
 
+/*16 bit path of first DWT level, see dwt_16bit_params_init().*/
+void image_shift_int16_c(uint16_t* out_coeff_16bit, const int16_t* in_coeff_16bit, uint32_t width, int32_t shift,
+                         int32_t offset);
+
 #ifdef __cplusplus
 }
 #endif
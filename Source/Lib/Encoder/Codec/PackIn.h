@@ -32,6 +32,15 @@ typedef struct PackInput {
     volatile struct PackInput* sync_dwt_list_next; //One direction list to get next pack task in frame
     Handle_t sync_dwt_semaphore;
     volatile uint32_t sync_dwt_component_done_flag[MAX_COMPONENTS_NUM];
+    ObjectWrapper_t* volatile coeff_slice_wrapper_ptr; //CoeffSlice_t with DWT coefficients of slice, released by pack task
+    int32_t coeff_slice_ticket;                        //Order of slice in coefficients ring, buffer is taken by DWT Stage
+    ObjectWrapper_t* pack_output_wrapper_ptr;          //PackOutput reserved by Init Stage, NULL when pack task gets it
+
+    /*Streaming: bands of input lines read by pack task, NULL when lines are taken from image of frame.
+     *Line stream_band_first_line[c] of component is first line of band, stride in samples.*/
+    const uint8_t* stream_band[MAX_COMPONENTS_NUM];
+    uint32_t stream_band_first_line[MAX_COMPONENTS_NUM];
+    uint32_t stream_band_stride[MAX_COMPONENTS_NUM];
 } PackInput_t;
 
 /**************************************
@@ -20,6 +20,7 @@ typedef struct PackOutput {
     ObjectWrapper_t *pcs_wrapper_ptr;
     uint32_t slice_idx;
     SvtJxsErrorType_t slice_error;
+    svt_jpeg_xs_slice_stats_t slice_stats; /*Valid when frame collect statistics*/
 } PackOutput;
 
 typedef struct PackOutputInitData {
@@ -26,7 +26,11 @@
 #include "Codestream.h"
 #include "GcStageProcess.h"
 #include "PackIn.h"
+#include "Transcode.h"
+#include "SliceReuse.h"
+#include "CoeffSlice.h"
 #include "Threads/SvtThreads.h"
+#include "SvtTrace.h"
 
 #define PRINT_BUDGET 0
 
@@ -44,8 +48,46 @@ typedef struct PackStageContext {
 
     struct precinct_calc_dwt_buff_tmp buffers_dwt_tmp;                     //Only for profile Latency
     struct precinct_calc_dwt_buff_per_component buffers_dwt_per_component; //Only for profile Latency
+    /*Slice of frame which vertical DWT state is in buffers_dwt_per_component, reused by first precinct of next slice.*/
+    uint8_t dwt_state_valid;
+    uint64_t dwt_state_frame_number;
+    uint32_t dwt_state_slice_idx;
+
+    /*Streaming: input lines of slice with lines around used by vertical DWT, and packed slice before write.*/
+    uint8_t* stream_band[MAX_COMPONENTS_NUM];
+    uint32_t stream_band_lines[MAX_COMPONENTS_NUM];
+    uint8_t* stream_slice_buffer;
+
+    /*Transcode: unpack state of source codestream, coefficients are not calculated by DWT.*/
+    TranscodeContext_t transcode;
 } PackStageContext;
 
+/*Streaming: lines above and below precinct read by vertical DWT of component.*/
+static uint32_t stream_band_margin_lines(uint32_t decom_v) {
+    if (decom_v == 1) {
+        return 2;
+    }
+    if (decom_v == 2) {
+        return 6;
+    }
+    return 0;
+}
+
+/*Streaming: packed formats keep all components interleaved in band of component 0.*/
+static uint32_t stream_bands_num(svt_jpeg_xs_encoder_common_t* enc_common) {
+    if (enc_common->colour_format > COLOUR_FORMAT_PACKED_MIN && enc_common->colour_format < COLOUR_FORMAT_PACKED_MAX) {
+        return 1;
+    }
+    return enc_common->pi.comps_num;
+}
+
+static uint32_t stream_band_stride(svt_jpeg_xs_encoder_common_t* enc_common, uint32_t c) {
+    if (enc_common->colour_format > COLOUR_FORMAT_PACKED_MIN && enc_common->colour_format < COLOUR_FORMAT_PACKED_MAX) {
+        return 3 * enc_common->pi.components[0].width;
+    }
+    return enc_common->pi.components[c].width;
+}
+
 static void pack_stage_context_dctor(void_ptr p) {
     ThreadContext_t* thread_contxt_ptr = (ThreadContext_t*)p;
     if (thread_contxt_ptr->priv) {
@@ -111,6 +153,15 @@ static void pack_stage_context_dctor(void_ptr p) {
             buffers_components_free(&obj->buffers_dwt_per_component);
         }
 
+        for (uint32_t c = 0; c < MAX_COMPONENTS_NUM; ++c) {
+            SVT_FREE(obj->stream_band[c]);
+        }
+        SVT_FREE(obj->stream_slice_buffer);
+
+        if (enc_common->transcode) {
+            transcode_context_free(&obj->transcode, &enc_common->transcode->pi);
+        }
+
         SVT_FREE(obj->temp_precincts_in_slice);
         SVT_FREE_ARRAY(obj);
     }
@@ -157,7 +208,8 @@ SvtJxsErrorType_t pack_stage_context_ctor(ThreadContext_t* thread_contxt_ptr, sv
     uint8_t decom_V0_exist = 0;
     uint8_t decom_V1_exist = 0;
     uint8_t decom_V2_exist = 0;
-    for (uint32_t i = 0; i < pi->comps_num; ++i) {
+    /*Transcode unpacks coefficients of source, buffers of DWT are not allocated.*/
+    for (uint32_t i = 0; i < pi->comps_num && !enc_common->transcode; ++i) {
         if (pi->components[i].decom_v == 0) {
             decom_V0_exist = 1;
         }
@@ -213,7 +265,7 @@ SvtJxsErrorType_t pack_stage_context_ctor(ThreadContext_t* thread_contxt_ptr, sv
         }
     }
 
-    if (enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY) {
+    if (enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY && !enc_common->transcode) {
         error = buffers_components_allocate(&context_ptr->buffers_dwt_per_component, pi);
         if (error) {
             return error;
@@ -262,12 +314,89 @@ SvtJxsErrorType_t pack_stage_context_ctor(ThreadContext_t* thread_contxt_ptr, sv
         }
     }
 
+    if (enc_common->streaming) {
+        /*Band keep lines of all precincts in slice and lines around them, whole image is never stored.*/
+        const uint32_t pixel_size = enc_common->bit_depth <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+        for (uint32_t c = 0; c < stream_bands_num(enc_common); ++c) {
+            const uint32_t margin = stream_band_margin_lines(pi->components[c].decom_v);
+            context_ptr->stream_band_lines[c] = MIN(pi->components[c].height,
+                                                    (pi->precincts_per_slice - 1) * pi->components[c].precinct_height + 1 +
+                                                        2 * margin);
+            SVT_MALLOC(context_ptr->stream_band[c],
+                       (size_t)context_ptr->stream_band_lines[c] * stream_band_stride(enc_common, c) * pixel_size);
+        }
+        uint32_t slice_size_max = 0;
+        for (uint32_t i = 0; i < pi->slice_num; ++i) {
+            slice_size_max = MAX(slice_size_max, enc_common->slice_sizes[i]);
+        }
+        SVT_MALLOC(context_ptr->stream_slice_buffer, slice_size_max);
+    }
+
+    if (enc_common->transcode) {
+        error = transcode_context_alloc(&context_ptr->transcode, &enc_common->transcode->pi);
+        if (error) {
+            return error;
+        }
+    }
+
+    return SvtJxsErrorNone;
+}
+
+static void slice_init_bitstream(bitstream_writer_t* bitstream, uint8_t* slice_buffer, PackInput_t* pack_input) {
+    bitstream_writer_init(bitstream, slice_buffer, pack_input->out_bytes_end - pack_input->out_bytes_begin);
+}
+
+/*Streaming: read lines of slice to bands of context, with lines of neighbouring slices used by vertical DWT.*/
+static SvtJxsErrorType_t stream_read_slice(PackStageContext* context_ptr, PictureControlSet* pcs_ptr, PackInput_t* pack_input,
+                                           uint32_t prec_first_idx, uint32_t prec_num) {
+    svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
+    const svt_jpeg_xs_stream_t* stream = pcs_ptr->enc_input.stream;
+    pi_t* pi = &enc_common->pi;
+
+    for (uint32_t c = 0; c < stream_bands_num(enc_common); ++c) {
+        const uint32_t precinct_height = pi->components[c].precinct_height;
+        const uint32_t margin = stream_band_margin_lines(pi->components[c].decom_v);
+        const uint32_t first_line = prec_first_idx * precinct_height;
+        const uint32_t last_line = (prec_first_idx + prec_num - 1) * precinct_height + margin;
+        const uint32_t band_first_line = first_line > margin ? first_line - margin : 0;
+        const uint32_t band_lines = MIN(last_line + 1, pi->components[c].height) - band_first_line;
+        assert(band_lines <= context_ptr->stream_band_lines[c]);
+
+        pack_input->stream_band[c] = context_ptr->stream_band[c];
+        pack_input->stream_band_first_line[c] = band_first_line;
+        pack_input->stream_band_stride[c] = stream_band_stride(enc_common, c);
+        SvtJxsErrorType_t ret = stream->read_lines(
+            stream->context, c, band_first_line, band_lines, context_ptr->stream_band[c], pack_input->stream_band_stride[c]);
+        if (ret != SvtJxsErrorNone) {
+            return ret;
+        }
+    }
     return SvtJxsErrorNone;
 }
 
-static void slice_init_bitstream(bitstream_writer_t* bitstream, PictureControlSet* pcs_ptr, PackInput_t* pack_input) {
-    void* buf = pcs_ptr->enc_input.bitstream.buffer + pack_input->out_bytes_begin;
-    bitstream_writer_init(bitstream, buf, pack_input->out_bytes_end - pack_input->out_bytes_begin);
+/*Reuse: hash input lines of slice with lines of neighbouring slices used by vertical DWT, like band read by streaming.
+ *Range is extended by one precinct below, so lines used by DWT of last precinct are always included.*/
+static uint64_t slice_reuse_hash_input(PictureControlSet* pcs_ptr, uint32_t prec_first_idx, uint32_t prec_num) {
+    svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
+    pi_t* pi = &enc_common->pi;
+    const uint32_t pixel_size = enc_common->bit_depth == 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+    uint64_t hash = 0;
+
+    for (uint32_t c = 0; c < stream_bands_num(enc_common); ++c) {
+        const uint32_t precinct_height = pi->components[c].precinct_height;
+        const uint32_t margin = stream_band_margin_lines(pi->components[c].decom_v);
+        const uint32_t first_line = prec_first_idx * precinct_height;
+        const uint32_t end_line = MIN((prec_first_idx + prec_num) * precinct_height + margin, pi->components[c].height);
+        const uint32_t band_first_line = first_line > margin ? first_line - margin : 0;
+        const size_t line_bytes = (size_t)pixel_size * stream_band_stride(enc_common, c);
+        const size_t plane_stride = (size_t)pixel_size * pcs_ptr->enc_input.image.stride[c];
+        const uint8_t* line = (const uint8_t*)pcs_ptr->enc_input.image.data_yuv[c] + band_first_line * plane_stride;
+        for (uint32_t i = band_first_line; i < end_line; ++i) {
+            hash = slice_reuse_hash(hash, line, line_bytes);
+            line += plane_stride;
+        }
+    }
+    return hash;
 }
 
 static SvtJxsErrorType_t process_precinct(PictureControlSet* pcs_ptr, svt_jpeg_xs_encoder_common_t* enc_common, pi_t* pi,
@@ -276,14 +405,28 @@ static SvtJxsErrorType_t process_precinct(PictureControlSet* pcs_ptr, svt_jpeg_x
                                           uint32_t budget_bytes, bitstream_writer_t* bitstream,
                                           struct precinct_calc_dwt_buff_tmp* buffers_dwt_tmp,
                                           struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component,
-                                          uint32_t prec_num, uint32_t* budget_bytes_padding_left) {
+                                          uint8_t precalculate_slice, uint32_t prec_num, uint32_t* budget_bytes_padding_left,
+                                          TranscodeContext_t* transcode) {
     SvtJxsErrorType_t error = 0;
     precinc_info_enum type = PRECINCT_NORMAL;
     if (prec_idx + 1 >= enc_common->pi.precincts_line_num) {
         type = PRECINCT_LAST_NORMAL;
     }
-    precinct_enc_init(pcs_ptr, pi, prec_idx, type, precinct_top, precinct);
-    precinct_calculate_data(pcs_ptr, precinct, pack_input, buffers_dwt_tmp, buffers_dwt_per_component, prec_idx_in_slice);
+    precinct_enc_init(pcs_ptr, pack_input, pi, prec_idx, type, precinct_top, precinct);
+    if (transcode) {
+        error = transcode_precinct_calculate_data(enc_common->transcode, transcode, pcs_ptr, precinct);
+        if (error) {
+            return error;
+        }
+    }
+    else {
+        precinct_calculate_data(pcs_ptr,
+                                precinct,
+                                pack_input,
+                                buffers_dwt_tmp,
+                                buffers_dwt_per_component,
+                                precalculate_slice && prec_idx_in_slice == 0);
+    }
 
     rate_control_init_precinct(pcs_ptr, precinct, enc_common->coding_signs_handling);
     error = rate_control_precinct(
@@ -340,7 +483,7 @@ static SvtJxsErrorType_t process_slice(PictureControlSet* pcs_ptr, svt_jpeg_xs_e
                                        PackInput_t* pack_input, precinct_enc_t* precincts, uint32_t prec_num,
                                        uint32_t prec_first_idx, struct precinct_calc_dwt_buff_tmp* buffers_dwt_tmp,
                                        struct precinct_calc_dwt_buff_per_component* buffers_dwt_per_component,
-                                       bitstream_writer_t* bitstream) {
+                                       uint8_t precalculate_slice, bitstream_writer_t* bitstream, TranscodeContext_t* transcode) {
     assert(enc_common->rate_control_mode == RC_CBR_PER_SLICE_COMMON_QUANT ||
            enc_common->rate_control_mode == RC_CBR_PER_SLICE_COMMON_QUANT_MAX_RATE);
 
@@ -360,8 +503,17 @@ static SvtJxsErrorType_t process_slice(PictureControlSet* pcs_ptr, svt_jpeg_xs_e
         if (prec_idx_global + 1 >= enc_common->pi.precincts_line_num) {
             type = PRECINCT_LAST_NORMAL;
         }
-        precinct_enc_init(pcs_ptr, pi, prec_idx_global, type, precinct_top, precinct);
-        precinct_calculate_data(pcs_ptr, precinct, pack_input, buffers_dwt_tmp, buffers_dwt_per_component, i);
+        precinct_enc_init(pcs_ptr, pack_input, pi, prec_idx_global, type, precinct_top, precinct);
+        if (transcode) {
+            error = transcode_precinct_calculate_data(enc_common->transcode, transcode, pcs_ptr, precinct);
+            if (error) {
+                return error;
+            }
+        }
+        else {
+            precinct_calculate_data(
+                pcs_ptr, precinct, pack_input, buffers_dwt_tmp, buffers_dwt_per_component, precalculate_slice && i == 0);
+        }
         rate_control_init_precinct(pcs_ptr, precinct, enc_common->coding_signs_handling);
     }
 
@@ -563,186 +715,371 @@ static SvtJxsErrorType_t process_slice(PictureControlSet* pcs_ptr, svt_jpeg_xs_e
     return error;
 }
 
-void* pack_stage_kernel(void* input_ptr) {
-    ThreadContext_t* enc_contxt_ptr = (ThreadContext_t*)input_ptr;
-    PackStageContext* context_ptr = (PackStageContext*)enc_contxt_ptr->priv;
+/*Statistics: keep coarsest quantization in slice and sum of padding.*/
+static INLINE void slice_statistics_add_precinct(svt_jpeg_xs_slice_stats_t* slice_stats, const precinct_enc_t* precinct) {
+    if (precinct->pack_quantization > slice_stats->quantization ||
+        (precinct->pack_quantization == slice_stats->quantization && precinct->pack_refinement < slice_stats->refinement)) {
+        slice_stats->quantization = (uint8_t)precinct->pack_quantization;
+        slice_stats->refinement = (uint8_t)precinct->pack_refinement;
+    }
+    slice_stats->padding_bytes += precinct->pack_padding_bytes;
+}
 
+/*Encode one slice received from Pre RC Stage.*/
+static void pack_stage_process_slice(PackStageContext* context_ptr, ObjectWrapper_t* input_wrapper_ptr) {
     PictureControlSet* pcs_ptr;
-    ObjectWrapper_t *input_wrapper_ptr, *output_wrapper_ptr;
-
-    for (;;) {
-        // Get the Next svt Input Buffer [BLOCKING]
-        SVT_GET_FULL_OBJECT(context_ptr->input_buffer_fifo_ptr, &input_wrapper_ptr);
-        PackInput_t* pack_input = (PackInput_t*)input_wrapper_ptr->object_ptr;
-        ObjectWrapper_t* pcs_wrapper_ptr = pack_input->pcs_wrapper_ptr;
-        pcs_ptr = (PictureControlSet*)pcs_wrapper_ptr->object_ptr;
+    ObjectWrapper_t* output_wrapper_ptr;
+    PackInput_t* pack_input = (PackInput_t*)input_wrapper_ptr->object_ptr;
+    ObjectWrapper_t* pcs_wrapper_ptr = pack_input->pcs_wrapper_ptr;
+    pcs_ptr = (PictureControlSet*)pcs_wrapper_ptr->object_ptr;
 
 #ifdef FLAG_DEADLOCK_DETECT
-        printf("07[%s:%i] frame: %03li slice: %03d\n", __func__, __LINE__, (size_t)pcs_ptr->frame_number, pack_input->slice_idx);
+    printf("07[%s:%i] frame: %03li slice: %03d\n", __func__, __LINE__, (size_t)pcs_ptr->frame_number, pack_input->slice_idx);
 #endif
 
-        pi_t* pi = &pcs_ptr->enc_common->pi;
-        svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
-        SvtJxsErrorType_t error = 0;
+    pi_t* pi = &pcs_ptr->enc_common->pi;
+    svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
+    SvtJxsErrorType_t error = 0;
+    const uint8_t statistics = (pcs_ptr->enc_input.stats != NULL);
+    /*Statistics of slice are kept with reused slice, so collect them also when frame does not request them.*/
+    const uint8_t slice_statistics = statistics || enc_common->slice_reuse;
+    svt_jpeg_xs_slice_stats_t slice_stats;
+    memset(&slice_stats, 0, sizeof(slice_stats));
+    if (slice_statistics) {
+        slice_stats.refinement = UINT8_MAX;
+    }
+    if (statistics) {
+        slice_stats.begin_ns = get_current_time_ns();
+    }
+    SVT_TRACE_BEGIN("enc_pack", pcs_ptr->frame_number, pack_input->slice_idx);
+
+    /*Write Slice header*/
+    bitstream_writer_t bitstream;
+    uint8_t* slice_buffer = enc_common->streaming ? context_ptr->stream_slice_buffer
+                                                  : pcs_ptr->enc_input.bitstream.buffer + pack_input->out_bytes_begin;
+    slice_init_bitstream(&bitstream, slice_buffer, pack_input);
+
+    /*RC and Quantization*/
+    uint32_t prec_first_idx = pi->precincts_per_slice * pack_input->slice_idx;
+    uint32_t prec_num = pi->precincts_per_slice;
+    int32_t last_slice = (pack_input->slice_idx == enc_common->pi.slice_num - 1);
+    if (last_slice) {
+        prec_num = pi->precincts_line_num - prec_first_idx;
+    }
 
-        /*Write Slice header*/
-        bitstream_writer_t bitstream;
-        slice_init_bitstream(&bitstream, pcs_ptr, pack_input);
-
-        /*RC and Quantization*/
-        uint32_t prec_first_idx = pi->precincts_per_slice * pack_input->slice_idx;
-        uint32_t prec_num = pi->precincts_per_slice;
-        int32_t last_slice = (pack_input->slice_idx == enc_common->pi.slice_num - 1);
-        if (last_slice) {
-            prec_num = pi->precincts_line_num - prec_first_idx;
-        }
-        uint32_t min_budget_per_prec_bytes = pack_input->slice_budget_bytes / prec_num;
-        uint32_t left_budget_bytes = pack_input->slice_budget_bytes - min_budget_per_prec_bytes * prec_num;
-        /* Budget if not divide by precincts number then distribution size for upper precinct
-         * Example Budget for 4 precincts:
-         * 45/4 = 11 Left 1 Budgets: 12 11 11 11
-         * 46/4 = 11 Left 2 Budgets: 12 12 11 11
-         * 47/4 = 11 Left 3 Budgets: 12 12 12 11
-         * 48/4 = 12 Left 0 Budgets: 12 12 12 12
-         */
+    if (enc_common->streaming) {
+        error = stream_read_slice(context_ptr, pcs_ptr, pack_input, prec_first_idx, prec_num);
+    }
+    TranscodeContext_t* transcode = NULL;
+    if (enc_common->transcode) {
+        transcode = &context_ptr->transcode;
+        error = transcode_slice_begin(enc_common->transcode, transcode, pcs_ptr, pack_input->slice_idx);
+    }
+    uint32_t min_budget_per_prec_bytes = pack_input->slice_budget_bytes / prec_num;
+    uint32_t left_budget_bytes = pack_input->slice_budget_bytes - min_budget_per_prec_bytes * prec_num;
+    /* Budget if not divide by precincts number then distribution size for upper precinct
+     * Example Budget for 4 precincts:
+     * 45/4 = 11 Left 1 Budgets: 12 11 11 11
+     * 46/4 = 11 Left 2 Budgets: 12 12 11 11
+     * 47/4 = 11 Left 3 Budgets: 12 12 12 11
+     * 48/4 = 12 Left 0 Budgets: 12 12 12 12
+     */
+
+    precinct_enc_t* precincts = context_ptr->temp_precincts_in_slice;
+
+    /*Unchanged input of slice, copy packed bytes of previous encoding instead of DWT, RC and pack.*/
+    uint64_t slice_hash = 0;
+    uint8_t slice_reused = 0;
+    if (enc_common->slice_reuse) {
+        slice_hash = slice_reuse_hash_input(pcs_ptr, prec_first_idx, prec_num);
+        slice_reused = slice_reuse_load(enc_common->slice_reuse,
+                                        pack_input->slice_idx,
+                                        slice_hash,
+                                        pack_input->slice_budget_bytes,
+                                        slice_buffer,
+                                        pack_input->out_bytes_end - pack_input->out_bytes_begin,
+                                        &slice_stats);
+    }
 
-        precinct_enc_t* precincts = context_ptr->temp_precincts_in_slice;
-
-        /*Calculate Slice*/
-        if (enc_common->rate_control_mode == RC_CBR_PER_PRECINCT ||
-            enc_common->rate_control_mode == RC_CBR_PER_PRECINCT_MOVE_PADDING) {
-            /*RC Budget per precinct. One loop for DWT, RC, and PACK.*/
-            precinct_enc_t* precinct_top = NULL;
-            precinct_enc_t* precinct = NULL;
-            uint8_t precinct_index = 0;
-            if (enc_common->coding_vertical_prediction_mode == METHOD_PRED_DISABLE) {
-                precinct = &precincts[precinct_index];
-            }
+    /*Vertical DWT of first precinct needs lines of previous slice.
+     *Reuse state kept by this context when it encoded previous slice, otherwise recalculate overlap lines.
+     *State is not exchanged between contexts, neighbouring slices are encoded at the same time by different threads.*/
+    uint8_t precalculate_slice = 1;
+    if (enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY && pack_input->slice_idx > 0 && !slice_reused) {
+        if (context_ptr->dwt_state_valid && context_ptr->dwt_state_frame_number == pcs_ptr->frame_number &&
+            context_ptr->dwt_state_slice_idx + 1 == pack_input->slice_idx) {
+            precalculate_slice = 0;
+        }
+    }
 
-            uint32_t first_budget_per_prec_bytes = min_budget_per_prec_bytes;
+    /*Pack task can reach slice before DWT Stage, precincts need buffer of coefficients ring.*/
+    if (error == SvtJxsErrorNone && !slice_reused && enc_common->cpu_profile == CPU_PROFILE_CPU && pi->decom_v != 0) {
+        error = coeff_slice_ring_get(
+            enc_common->coeff_slice_ring, pack_input->coeff_slice_ticket, &pack_input->coeff_slice_wrapper_ptr);
+    }
 
-            if (enc_common->rate_control_mode == RC_CBR_PER_PRECINCT_MOVE_PADDING) {
-                if (enc_common->coding_signs_handling == SIGN_HANDLING_STRATEGY_FAST) {
-                    first_budget_per_prec_bytes = first_budget_per_prec_bytes *
-                        (100 + TUNING_RC_CBR_PER_PRECINCT_MOVE_PADDING_FIRST_PREC_BIGGER_WITH_SIGN_LAZY_PERCENT) / 100;
-                }
-                else {
-                    first_budget_per_prec_bytes = first_budget_per_prec_bytes *
-                        (100 + TUNING_RC_CBR_PER_PRECINCT_MOVE_PADDING_FIRST_PREC_BIGGER_NO_SIGN_LAZY_PERCENT) / 100;
-                }
-                first_budget_per_prec_bytes = MIN(pack_input->slice_budget_bytes, first_budget_per_prec_bytes);
-                if (prec_num > 1) {
-                    uint32_t left_after_first = pack_input->slice_budget_bytes - first_budget_per_prec_bytes;
-                    min_budget_per_prec_bytes = left_after_first / (prec_num - 1);
-                    left_budget_bytes = pack_input->slice_budget_bytes - min_budget_per_prec_bytes * (prec_num - 1) -
-                        first_budget_per_prec_bytes;
-                }
-                else {
-                    left_budget_bytes = 0;
-                }
+    /*Calculate Slice*/
+    if (error != SvtJxsErrorNone) {
+        //Lines of slice are not available from stream or source of transcode is invalid, frame is returned with error
+    }
+    else if (slice_reused) {
+        //Packed slice is already in output buffer
+    }
+    else if (enc_common->rate_control_mode == RC_CBR_PER_PRECINCT ||
+             enc_common->rate_control_mode == RC_CBR_PER_PRECINCT_MOVE_PADDING) {
+        /*RC Budget per precinct. One loop for DWT, RC, and PACK.*/
+        precinct_enc_t* precinct_top = NULL;
+        precinct_enc_t* precinct = NULL;
+        uint8_t precinct_index = 0;
+        if (enc_common->coding_vertical_prediction_mode == METHOD_PRED_DISABLE) {
+            precinct = &precincts[precinct_index];
+        }
+
+        uint32_t first_budget_per_prec_bytes = min_budget_per_prec_bytes;
+
+        if (enc_common->rate_control_mode == RC_CBR_PER_PRECINCT_MOVE_PADDING) {
+            if (enc_common->coding_signs_handling == SIGN_HANDLING_STRATEGY_FAST) {
+                first_budget_per_prec_bytes = first_budget_per_prec_bytes *
+                    (100 + TUNING_RC_CBR_PER_PRECINCT_MOVE_PADDING_FIRST_PREC_BIGGER_WITH_SIGN_LAZY_PERCENT) / 100;
+            }
+            else {
+                first_budget_per_prec_bytes = first_budget_per_prec_bytes *
+                    (100 + TUNING_RC_CBR_PER_PRECINCT_MOVE_PADDING_FIRST_PREC_BIGGER_NO_SIGN_LAZY_PERCENT) / 100;
+            }
+            first_budget_per_prec_bytes = MIN(pack_input->slice_budget_bytes, first_budget_per_prec_bytes);
+            if (prec_num > 1) {
+                uint32_t left_after_first = pack_input->slice_budget_bytes - first_budget_per_prec_bytes;
+                min_budget_per_prec_bytes = left_after_first / (prec_num - 1);
+                left_budget_bytes = pack_input->slice_budget_bytes - min_budget_per_prec_bytes * (prec_num - 1) -
+                    first_budget_per_prec_bytes;
             }
-            assert(pack_input->slice_budget_bytes ==
-                   first_budget_per_prec_bytes + (prec_num - 1) * min_budget_per_prec_bytes + left_budget_bytes);
+            else {
+                left_budget_bytes = 0;
+            }
+        }
+        assert(pack_input->slice_budget_bytes ==
+               first_budget_per_prec_bytes + (prec_num - 1) * min_budget_per_prec_bytes + left_budget_bytes);
 
-            uint32_t budget_padding_left_bytes = 0; /*Move padding budget between precincts.*/
-            for (uint32_t i = 0; i < prec_num; i++) {
-                uint32_t budget_bytes = (i == 0) ? first_budget_per_prec_bytes : min_budget_per_prec_bytes;
-                if (i < left_budget_bytes) {
-                    budget_bytes++;
-                }
-                budget_bytes += budget_padding_left_bytes;
+        uint32_t budget_padding_left_bytes = 0; /*Move padding budget between precincts.*/
+        for (uint32_t i = 0; i < prec_num; i++) {
+            uint32_t budget_bytes = (i == 0) ? first_budget_per_prec_bytes : min_budget_per_prec_bytes;
+            if (i < left_budget_bytes) {
+                budget_bytes++;
+            }
+            budget_bytes += budget_padding_left_bytes;
 #if PRINT_BUDGET
-                printf("Slice: %u Prec %u size bytes: %u\n", pack_input->slice_idx, i, budget_bytes);
+            printf("Slice: %u Prec %u size bytes: %u\n", pack_input->slice_idx, i, budget_bytes);
 #endif
-                if (enc_common->coding_vertical_prediction_mode != METHOD_PRED_DISABLE) {
-                    precinct_top = precinct;               //Set top for next precinct
-                    precinct = &precincts[precinct_index]; //Get one of the two items to take turns
-                    precinct_index = (precinct_index + 1) % context_ptr->num_alloc_precincts_per_thread;
-                }
-                error = process_precinct(pcs_ptr,
-                                         enc_common,
-                                         pi,
-                                         pack_input->slice_idx,
-                                         prec_first_idx + i,
-                                         i,
-                                         pack_input,
-                                         precinct_top,
-                                         precinct,
-                                         budget_bytes,
-                                         &bitstream,
-                                         &context_ptr->buffers_dwt_tmp,
-                                         &context_ptr->buffers_dwt_per_component,
-                                         prec_num,
-                                         &budget_padding_left_bytes);
-                if (error) {
+            if (enc_common->coding_vertical_prediction_mode != METHOD_PRED_DISABLE) {
+                precinct_top = precinct;               //Set top for next precinct
+                precinct = &precincts[precinct_index]; //Get one of the two items to take turns
+                precinct_index = (precinct_index + 1) % context_ptr->num_alloc_precincts_per_thread;
+            }
+            error = process_precinct(pcs_ptr,
+                                     enc_common,
+                                     pi,
+                                     pack_input->slice_idx,
+                                     prec_first_idx + i,
+                                     i,
+                                     pack_input,
+                                     precinct_top,
+                                     precinct,
+                                     budget_bytes,
+                                     &bitstream,
+                                     &context_ptr->buffers_dwt_tmp,
+                                     &context_ptr->buffers_dwt_per_component,
+                                     precalculate_slice,
+                                     prec_num,
+                                     &budget_padding_left_bytes,
+                                     transcode);
+            if (error) {
 #ifndef NDEBUG
-                    fprintf(stderr, "err happen when pack prec\n");
+                fprintf(stderr, "err happen when pack prec\n");
 #endif
-                    break;
-                }
+                break;
+            }
+            if (slice_statistics) {
+                slice_statistics_add_precinct(&slice_stats, precinct);
             }
         }
-        else {
-            error = process_slice(pcs_ptr,
-                                  enc_common,
-                                  pi,
-                                  pack_input,
-                                  precincts,
-                                  prec_num,
-                                  prec_first_idx,
-                                  &context_ptr->buffers_dwt_tmp,
-                                  &context_ptr->buffers_dwt_per_component,
-                                  &bitstream);
+    }
+    else {
+        error = process_slice(pcs_ptr,
+                              enc_common,
+                              pi,
+                              pack_input,
+                              precincts,
+                              prec_num,
+                              prec_first_idx,
+                              &context_ptr->buffers_dwt_tmp,
+                              &context_ptr->buffers_dwt_per_component,
+                              precalculate_slice,
+                              &bitstream,
+                              transcode);
 #ifndef NDEBUG
-            if (error) {
-                fprintf(stderr, "Error calculate RC or pack for slice: %i\n", pack_input->slice_idx);
-            }
+        if (error) {
+            fprintf(stderr, "Error calculate RC or pack for slice: %i\n", pack_input->slice_idx);
+        }
 #endif
+        if (slice_statistics) {
+            for (uint32_t i = 0; i < prec_num; i++) {
+                slice_statistics_add_precinct(&slice_stats, &precincts[i]);
+            }
         }
+    }
 
 #ifndef NDEBUG
-        if (error == SvtJxsErrorNone) {
-            uint32_t used_bytes = bitstream_writer_get_used_bytes(&bitstream);
-            uint32_t used_bytes_expected = pack_input->out_bytes_end - pack_input->out_bytes_begin;
-            if (used_bytes_expected != used_bytes) {
-                fprintf(stderr,
-                        "Error pack slice: %i, Expected write to bitstream: %u Get: %u\n",
-                        pack_input->slice_idx,
-                        used_bytes_expected,
-                        used_bytes);
-                assert(0);
-            }
+    if (error == SvtJxsErrorNone && !slice_reused) {
+        uint32_t used_bytes = bitstream_writer_get_used_bytes(&bitstream);
+        uint32_t used_bytes_expected = pack_input->out_bytes_end - pack_input->out_bytes_begin;
+        if (used_bytes_expected != used_bytes) {
+            fprintf(stderr,
+                    "Error pack slice: %i, Expected write to bitstream: %u Get: %u\n",
+                    pack_input->slice_idx,
+                    used_bytes_expected,
+                    used_bytes);
+            assert(0);
         }
+    }
 #endif
-        assert((error != SvtJxsErrorNone) ||
-               (bitstream_writer_get_used_bytes(&bitstream) == pack_input->out_bytes_end - pack_input->out_bytes_begin));
+    assert((error != SvtJxsErrorNone) || slice_reused ||
+           (bitstream_writer_get_used_bytes(&bitstream) == pack_input->out_bytes_end - pack_input->out_bytes_begin));
+
+    if (error == SvtJxsErrorNone && enc_common->slice_reuse && !slice_reused) {
+        slice_reuse_store(enc_common->slice_reuse,
+                          pcs_ptr->frame_number,
+                          pack_input->slice_idx,
+                          slice_hash,
+                          pack_input->slice_budget_bytes,
+                          slice_buffer,
+                          pack_input->out_bytes_end - pack_input->out_bytes_begin,
+                          &slice_stats);
+    }
+
+    /*DWT of reused slice is not calculated, so its state is not valid for next slice.*/
+    if (enc_common->cpu_profile == CPU_PROFILE_LOW_LATENCY) {
+        context_ptr->dwt_state_valid = (error == SvtJxsErrorNone) && !slice_reused;
+        context_ptr->dwt_state_frame_number = pcs_ptr->frame_number;
+        context_ptr->dwt_state_slice_idx = pack_input->slice_idx;
+    }
+
+    //Write End of Bitstream
+    uint32_t slice_bytes = pack_input->out_bytes_end - pack_input->out_bytes_begin;
+    if (error == SvtJxsErrorNone && pack_input->write_tail) {
+        assert(pack_input->tail_bytes_begin == pack_input->out_bytes_end);
+        void* buf = slice_buffer + slice_bytes;
+        bitstream_writer_t bitstream;
+        bitstream_writer_init(&bitstream, buf, CODESTREAM_SIZE_BYTES);
+        write_tail(&bitstream);
+        slice_bytes += CODESTREAM_SIZE_BYTES;
+    }
 
-        //Write End of Bitstream
-        if (error == SvtJxsErrorNone && pack_input->write_tail) {
-            assert(pack_input->tail_bytes_begin == pack_input->out_bytes_end);
-            void* buf = pcs_ptr->enc_input.bitstream.buffer + pack_input->tail_bytes_begin;
-            bitstream_writer_t bitstream;
-            bitstream_writer_init(&bitstream, buf, CODESTREAM_SIZE_BYTES);
-            write_tail(&bitstream);
+    if (error == SvtJxsErrorNone && enc_common->streaming) {
+        const svt_jpeg_xs_stream_t* stream = pcs_ptr->enc_input.stream;
+        error = stream->write_bytes(stream->context, pack_input->out_bytes_begin, slice_buffer, slice_bytes);
+    }
+
+    if (statistics) {
+        if (slice_stats.refinement == UINT8_MAX) {
+            slice_stats.refinement = 0;
         }
+        slice_stats.end_ns = get_current_time_ns();
+    }
 
-        SvtJxsErrorType_t err = svt_jxs_get_empty_object(context_ptr->output_buffer_fifo_ptr, &output_wrapper_ptr);
-        if (err != SvtJxsErrorNone || output_wrapper_ptr == NULL) {
-            continue;
+    /*Coefficients of slice are not longer used, return buffer to ring for next slices.
+     *Reused slice or slice with error is not waiting for DWT Stage while packing,
+     *buffer can be released only after DWT Stage took and wrote it.*/
+    if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
+        for (uint32_t c = 0; c < pi->comps_num; ++c) {
+            if (pi->components[c].decom_v != 0) {
+                while (pack_input->sync_dwt_component_done_flag[c] == 0) {
+                    svt_jxs_block_on_semaphore(pack_input->sync_dwt_semaphore);
+                }
+            }
         }
+    }
+    if (pack_input->coeff_slice_wrapper_ptr) {
+        svt_jxs_release_object(pack_input->coeff_slice_wrapper_ptr);
+        pack_input->coeff_slice_wrapper_ptr = NULL;
+    }
+
+    SvtJxsErrorType_t err = SvtJxsErrorNone;
+    output_wrapper_ptr = pack_input->pack_output_wrapper_ptr;
+    pack_input->pack_output_wrapper_ptr = NULL;
+    if (output_wrapper_ptr == NULL) {
+        err = svt_jxs_get_empty_object(context_ptr->output_buffer_fifo_ptr, &output_wrapper_ptr);
+    }
+    if (err != SvtJxsErrorNone || output_wrapper_ptr == NULL) {
+        SVT_TRACE_END("enc_pack", pcs_ptr->frame_number, pack_input->slice_idx);
+        return;
+    }
 #ifdef FLAG_DEADLOCK_DETECT
-        printf("07[%s:%i] frame: %03li slice: %03d\n", __func__, __LINE__, (size_t)pcs_ptr->frame_number, pack_input->slice_idx);
+    printf("07[%s:%i] frame: %03li slice: %03d\n", __func__, __LINE__, (size_t)pcs_ptr->frame_number, pack_input->slice_idx);
 #endif
-        PackOutput* pack_out = (PackOutput*)output_wrapper_ptr->object_ptr;
-        pack_out->pcs_wrapper_ptr = pcs_wrapper_ptr;
-        pack_out->slice_idx = pack_input->slice_idx;
-        pack_out->slice_error = error;
+    PackOutput* pack_out = (PackOutput*)output_wrapper_ptr->object_ptr;
+    pack_out->pcs_wrapper_ptr = pcs_wrapper_ptr;
+    pack_out->slice_idx = pack_input->slice_idx;
+    pack_out->slice_error = error;
+    pack_out->slice_stats = slice_stats;
 #ifdef FLAG_DEADLOCK_DETECT
-        printf("07[%s:%i] frame: %03li slice: %03d\n", __func__, __LINE__, (size_t)pcs_ptr->frame_number, pack_out->slice_idx);
+    printf("07[%s:%i] frame: %03li slice: %03d\n", __func__, __LINE__, (size_t)pcs_ptr->frame_number, pack_out->slice_idx);
 #endif
-        svt_jxs_post_full_object(output_wrapper_ptr);
+    /*PCS can be released by Final Stage after post, finish event before.*/
+    SVT_TRACE_END("enc_pack", pcs_ptr->frame_number, pack_out->slice_idx);
+    svt_jxs_post_full_object(output_wrapper_ptr);
+
+    svt_jxs_release_object(input_wrapper_ptr);
+}
 
-        svt_jxs_release_object(input_wrapper_ptr);
+void* pack_stage_kernel(void* input_ptr) {
+    ThreadContext_t* enc_contxt_ptr = (ThreadContext_t*)input_ptr;
+    PackStageContext* context_ptr = (PackStageContext*)enc_contxt_ptr->priv;
+    bind_common_rtcd(&context_ptr->enc_common->common_rtcd);
+    bind_encoder_rtcd(&context_ptr->enc_common->encoder_rtcd);
+
+    ObjectWrapper_t* input_wrapper_ptr;
+
+    for (;;) {
+        // Get the Next svt Input Buffer [BLOCKING]
+        SVT_GET_FULL_OBJECT(context_ptr->input_buffer_fifo_ptr, &input_wrapper_ptr);
+        pack_stage_process_slice(context_ptr, input_wrapper_ptr);
     }
     return NULL;
 }
+
+/*Thread pool task, encode one slice. Worker of pool can run tasks of other instances, so bind
+ *dispatch table of this encoder for every task.*/
+void pack_stage_pool_task(void* input_ptr) {
+    ThreadContext_t* enc_contxt_ptr = (ThreadContext_t*)input_ptr;
+    PackStageContext* context_ptr = (PackStageContext*)enc_contxt_ptr->priv;
+    ObjectWrapper_t* input_wrapper_ptr;
+
+    svt_jxs_get_full_object_non_blocking(context_ptr->input_buffer_fifo_ptr, &input_wrapper_ptr);
+    if (input_wrapper_ptr == NULL) {
+        return;
+    }
+    bind_common_rtcd(&context_ptr->enc_common->common_rtcd);
+    bind_encoder_rtcd(&context_ptr->enc_common->encoder_rtcd);
+    pack_stage_process_slice(context_ptr, input_wrapper_ptr);
+}
+
+/*Slice task executed by caller thread (external_tasks). Caller threads share Pack Stage contexts,
+ *semaphore counts free contexts, so caller sleeps when all are busy and then always find a free one.*/
+void pack_stage_external_task(svt_jpeg_xs_encoder_api_prv_t* enc_api_prv, ObjectWrapper_t* input_wrapper_ptr) {
+    const uint32_t contexts_num = enc_api_prv->pack_stage_threads_num;
+    uint32_t idx = 0;
+    svt_jxs_block_on_semaphore(enc_api_prv->pack_stage_context_free_semaphore);
+    for (;;) {
+        int32_t expected = 0;
+        if (svt_jxs_atomic_cas_i32(&enc_api_prv->pack_stage_context_busy_array[idx], &expected, 1)) {
+            break;
+        }
+        idx = (idx + 1) % contexts_num;
+    }
+    PackStageContext* context_ptr = (PackStageContext*)enc_api_prv->pack_stage_context_ptr_array[idx]->priv;
+    bind_common_rtcd(&context_ptr->enc_common->common_rtcd);
+    bind_encoder_rtcd(&context_ptr->enc_common->encoder_rtcd);
+    pack_stage_process_slice(context_ptr, input_wrapper_ptr);
+    svt_jxs_atomic_store_i32(&enc_api_prv->pack_stage_context_busy_array[idx], 0);
+    svt_jxs_post_semaphore(enc_api_prv->pack_stage_context_free_semaphore);
+}
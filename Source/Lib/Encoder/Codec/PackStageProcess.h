@@ -17,6 +17,8 @@ SvtJxsErrorType_t pack_stage_context_ctor(ThreadContext_t *thread_context_ptr, s
                                           int idx);
 
 extern void *pack_stage_kernel(void *input_ptr);
+extern void pack_stage_pool_task(void *input_ptr);
+extern void pack_stage_external_task(svt_jpeg_xs_encoder_api_prv_t *enc_api_prv, ObjectWrapper_t *input_wrapper_ptr);
 #ifdef __cplusplus
 }
 #endif
@@ -26,13 +26,20 @@ typedef struct PictureControlSet {
     int32_t frame_error;
     uint64_t frame_number;
 
-    /*Buffers to keep all data in frame*/
-    uint16_t *coeff_buff_ptr_16bit[MAX_COMPONENTS_NUM]; //Requires for Profile: CPU
     uint32_t slice_cnt;
 
     uint8_t *slice_ready_to_release_arr;
     uint32_t slice_released_idx;
     uint32_t bitstream_release_offset;
+
+    /*Statistics, DWT time of components, reduced by Final Stage*/
+    uint64_t dwt_begin_ns[MAX_COMPONENTS_NUM];
+    uint64_t dwt_end_ns[MAX_COMPONENTS_NUM];
+
+    /*Transcode, source codestream parsed by Init Stage: header, offsets of slices and error returned by every slice*/
+    SvtJxsErrorType_t transcode_error;
+    picture_header_dynamic_t transcode_header_dynamic;
+    uint32_t *transcode_slice_offsets;
 } PictureControlSet;
 
 /**************************************
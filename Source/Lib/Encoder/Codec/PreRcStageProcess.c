@@ -18,7 +18,9 @@
 #include "BitstreamWriter.h"
 #include "PackHeaders.h"
 #include "Pi.h"
+#include "CoeffSlice.h"
 #include "Threads/SvtThreads.h"
+#include "Threads/SvtThreadPool.h"
 
 uint32_t write_pic_level_header_nbytes(uint8_t* buffer_ptr, size_t buffer_size, svt_jpeg_xs_encoder_common_t* enc_common) {
     bitstream_writer_t bitstream;
@@ -28,7 +30,8 @@ uint32_t write_pic_level_header_nbytes(uint8_t* buffer_ptr, size_t buffer_size,
     return bitstream_writer_get_used_bytes(&bitstream);
 }
 
-PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t* output_buffer_fifo_ptr, uint64_t frame_num,
+PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t* output_buffer_fifo_ptr,
+                                              Fifo_t* pack_output_fifo_ptr, uint64_t frame_num,
                                               ObjectWrapper_t* pcs_wrapper_ptr) {
     UNUSED(frame_num); // Value only used when FLAG_DEADLOCK_DETECT is enabled
     svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
@@ -36,11 +39,19 @@ PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t
     ObjectWrapper_t* output_wrapper_ptr = NULL;
     ObjectWrapper_t* output_wrapper_ptr_next = NULL;
 
-    /*Tested in svt_jpeg_xs_encoder_send_picture()*/
-    assert(enc_common->frame_header_length_bytes < pcs_ptr->enc_input.bitstream.allocation_size);
+    if (enc_common->streaming) {
+        //Write image header before any slice
+        const svt_jpeg_xs_stream_t* stream = pcs_ptr->enc_input.stream;
+        pcs_ptr->frame_error |= stream->write_bytes(
+            stream->context, 0, enc_common->frame_header_buffer, enc_common->frame_header_length_bytes);
+    }
+    else {
+        /*Tested in svt_jpeg_xs_encoder_send_picture()*/
+        assert(enc_common->frame_header_length_bytes < pcs_ptr->enc_input.bitstream.allocation_size);
 
-    //Copy image header
-    memcpy(pcs_ptr->enc_input.bitstream.buffer, enc_common->frame_header_buffer, enc_common->frame_header_length_bytes);
+        //Copy image header
+        memcpy(pcs_ptr->enc_input.bitstream.buffer, enc_common->frame_header_buffer, enc_common->frame_header_length_bytes);
+    }
     pcs_ptr->enc_input.bitstream.used_size = enc_common->picture_header_dynamic.hdr_Lcod;
 
     if (enc_common->cpu_profile == CPU_PROFILE_CPU) {
@@ -63,6 +74,9 @@ PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t
             }
             pack_input = (PackInput_t*)output_wrapper_ptr->object_ptr;
             memset((void*)pack_input->sync_dwt_component_done_flag, 0, sizeof(pack_input->sync_dwt_component_done_flag));
+            /*Buffer from coefficients ring is taken by DWT Stage when it reach slice, released when pack task finish slice.*/
+            pack_input->coeff_slice_wrapper_ptr = NULL;
+            pack_input->coeff_slice_ticket = coeff_slice_ring_ticket(enc_common->coeff_slice_ring);
             if (!first) {
                 first = pack_input;
             }
@@ -86,10 +100,20 @@ PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t
             }
 
             pack_input = (PackInput_t*)output_wrapper_ptr->object_ptr;
+            pack_input->coeff_slice_wrapper_ptr = NULL;
+        }
+
+        pack_input->pack_output_wrapper_ptr = NULL;
+        if (pack_output_fifo_ptr) {
+            SvtJxsErrorType_t ret = svt_jxs_get_empty_object(pack_output_fifo_ptr, &pack_input->pack_output_wrapper_ptr);
+            if (ret != SvtJxsErrorNone || pack_input->pack_output_wrapper_ptr == NULL) {
+                return NULL;
+            }
         }
 
         pack_input->slice_idx = i;
         pack_input->out_bytes_begin = output_bytes_begin;
+        memset(pack_input->stream_band, 0, sizeof(pack_input->stream_band));
 
         if (i != enc_common->pi.slice_num - 1) {
             pack_input->slice_budget_bytes = enc_common->slice_sizes[i] - SLICE_HEADER_SIZE_BYTES;
@@ -111,6 +135,12 @@ PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t
 #endif
         //Send direct to PACK
         svt_jxs_post_full_object(output_wrapper_ptr);
+        if (enc_common->pack_stage_pool_client) {
+            svt_jxs_thread_pool_submit(enc_common->pack_stage_pool_client);
+        }
+        else if (enc_common->external_tasks && enc_common->callback_task_available) {
+            enc_common->callback_task_available(enc_common->callback_task_encoder_ctx, enc_common->callback_task_available_context);
+        }
     }
     return first;
 }
@@ -20,7 +20,10 @@ extern "C" {
 
 uint32_t write_pic_level_header_nbytes(uint8_t* buffer_ptr, size_t buffer_size, svt_jpeg_xs_encoder_common_t* enc_common);
 
-PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t* output_buffer_fifo_ptr, uint64_t frame_num,
+/*pack_output_fifo_ptr is set when slices are encoded by thread pool, output of every slice is reserved
+ *before task is submitted, so pool worker never waits for output buffer released by application.*/
+PackInput_t* pre_rc_send_frame_to_pack_slices(PictureControlSet* pcs_ptr, Fifo_t* output_buffer_fifo_ptr,
+                                              Fifo_t* pack_output_fifo_ptr, uint64_t frame_num,
                                               ObjectWrapper_t* pcs_wrapper_ptr);
 
 #ifdef __cplusplus
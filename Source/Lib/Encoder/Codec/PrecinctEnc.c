@@ -6,15 +6,22 @@
 #include "PrecinctEnc.h"
 #include "PictureControlSet.h"
 #include "PackIn.h"
+#include "CoeffSlice.h"
 
-void precinct_enc_init(struct PictureControlSet* pcs_ptr, pi_t* pi, uint32_t prec_idx, precinc_info_enum type,
-                       precinct_enc_t* precinct_top, precinct_enc_t* out_precinct) {
+void precinct_enc_init(struct PictureControlSet* pcs_ptr, struct PackInput* pack_input, pi_t* pi, uint32_t prec_idx,
+                       precinc_info_enum type, precinct_enc_t* precinct_top, precinct_enc_t* out_precinct) {
     svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
     pi_enc_t* pi_enc = &enc_common->pi_enc;
     precinct_info_t* p_info = &pi->p_info[type];
     out_precinct->precinct_top = precinct_top;
     out_precinct->p_info = p_info;
     out_precinct->prec_idx = prec_idx;
+    /*Profile CPU: coefficients from DWT Stage are kept only for slice.*/
+    CoeffSlice_t* coeff_slice = NULL;
+    if (pack_input->coeff_slice_wrapper_ptr) {
+        coeff_slice = (CoeffSlice_t*)pack_input->coeff_slice_wrapper_ptr->object_ptr;
+    }
+    const uint32_t prec_idx_in_slice = prec_idx % pi->precincts_per_slice;
 
     for (uint32_t c = 0; c < pi->comps_num; ++c) {
         for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
@@ -45,8 +52,8 @@ void precinct_enc_init(struct PictureControlSet* pcs_ptr, pi_t* pi, uint32_t pre
                     }
                     else {
                         //Fix to H per slice, line_idx always 0
-                        uint16_t* buff_comp_precinct = pcs_ptr->coeff_buff_ptr_16bit[c] +
-                            prec_idx * pi_enc->coeff_buff_tmp_size_precinct[c];
+                        uint16_t* buff_comp_precinct = coeff_slice->coeff_buff_ptr_16bit[c] +
+                            prec_idx_in_slice * pi_enc->coeff_buff_tmp_size_precinct[c];
                         band->lines_common[line_idx].coeff_data_ptr_16bit = buff_comp_precinct +
                             pi_enc->components[c].bands[b].coeff_buff_tmp_pos_offset_16bit + (line_idx)*coeff_width;
                     }
@@ -100,8 +100,9 @@ extern "C" {
 #endif
 
 struct PictureControlSet;
-void precinct_enc_init(struct PictureControlSet* pcs_ptr, pi_t* pi, uint32_t prec_idx, precinc_info_enum type,
-                       precinct_enc_t* precinct_top, precinct_enc_t* out_precinct);
+struct PackInput;
+void precinct_enc_init(struct PictureControlSet* pcs_ptr, struct PackInput* pack_input, pi_t* pi, uint32_t prec_idx,
+                       precinc_info_enum type, precinct_enc_t* precinct_top, precinct_enc_t* out_precinct);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,150 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "SliceReuse.h"
+#include "Threads/SvtThreads.h"
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static void slice_reuse_dctor(void_ptr p) {
+    SliceReuse_t* obj = (SliceReuse_t*)p;
+    if (obj->slots) {
+        for (uint32_t i = 0; i < obj->slots_num; ++i) {
+            SVT_FREE(obj->slots[i].buffer);
+            SVT_DESTROY_MUTEX(obj->slots[i].mutex);
+        }
+        SVT_FREE(obj->slots);
+    }
+}
+
+SvtJxsErrorType_t slice_reuse_ctor(SliceReuse_t* obj, const uint32_t* slice_sizes, uint32_t slice_num) {
+    obj->dctor = slice_reuse_dctor;
+    obj->slots_num = slice_num;
+    SVT_CALLOC(obj->slots, slice_num, sizeof(SliceReuseSlot_t));
+    for (uint32_t i = 0; i < slice_num; ++i) {
+        SVT_CREATE_MUTEX(obj->slots[i].mutex);
+        SVT_MALLOC(obj->slots[i].buffer, slice_sizes[i]);
+    }
+    return SvtJxsErrorNone;
+}
+
+static INLINE uint64_t xxh64_rotl(uint64_t x, uint32_t r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static INLINE uint64_t xxh64_read64(const uint8_t* p) {
+    uint64_t val;
+    memcpy(&val, p, sizeof(val));
+    return val;
+}
+
+static INLINE uint32_t xxh64_read32(const uint8_t* p) {
+    uint32_t val;
+    memcpy(&val, p, sizeof(val));
+    return val;
+}
+
+static INLINE uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = xxh64_rotl(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+static INLINE uint64_t xxh64_merge_round(uint64_t acc, uint64_t val) {
+    acc ^= xxh64_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t slice_reuse_hash(uint64_t seed, const uint8_t* data, size_t size) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        /*Four independent lanes, bound by memory bandwidth rather than by multiplies.*/
+        uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = seed + XXH_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME64_1;
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = xxh64_round(v1, xxh64_read64(p));
+            v2 = xxh64_round(v2, xxh64_read64(p + 8));
+            v3 = xxh64_round(v3, xxh64_read64(p + 16));
+            v4 = xxh64_round(v4, xxh64_read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = xxh64_rotl(v1, 1) + xxh64_rotl(v2, 7) + xxh64_rotl(v3, 12) + xxh64_rotl(v4, 18);
+        h = xxh64_merge_round(h, v1);
+        h = xxh64_merge_round(h, v2);
+        h = xxh64_merge_round(h, v3);
+        h = xxh64_merge_round(h, v4);
+    }
+    else {
+        h = seed + XXH_PRIME64_5;
+    }
+    h += (uint64_t)size;
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxh64_round(0, xxh64_read64(p));
+        h = xxh64_rotl(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= (uint64_t)xxh64_read32(p) * XXH_PRIME64_1;
+        h = xxh64_rotl(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (uint64_t)(*p) * XXH_PRIME64_5;
+        h = xxh64_rotl(h, 11) * XXH_PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint8_t slice_reuse_load(SliceReuse_t* obj, uint32_t slice_idx, uint64_t hash, uint32_t budget_bytes, uint8_t* buffer,
+                         uint32_t size_bytes, svt_jpeg_xs_slice_stats_t* slice_stats) {
+    SliceReuseSlot_t* slot = &obj->slots[slice_idx];
+    uint8_t ready = 0;
+    svt_jxs_block_on_mutex(slot->mutex);
+    if (slot->valid && slot->hash == hash && slot->budget_bytes == budget_bytes && slot->size_bytes == size_bytes) {
+        memcpy(buffer, slot->buffer, size_bytes);
+        slice_stats->quantization = slot->quantization;
+        slice_stats->refinement = slot->refinement;
+        slice_stats->padding_bytes = slot->padding_bytes;
+        ready = 1;
+    }
+    svt_jxs_release_mutex(slot->mutex);
+    return ready;
+}
+
+void slice_reuse_store(SliceReuse_t* obj, uint64_t frame_number, uint32_t slice_idx, uint64_t hash, uint32_t budget_bytes,
+                       const uint8_t* buffer, uint32_t size_bytes, const svt_jpeg_xs_slice_stats_t* slice_stats) {
+    SliceReuseSlot_t* slot = &obj->slots[slice_idx];
+    svt_jxs_block_on_mutex(slot->mutex);
+    if (!slot->valid || slot->frame_number < frame_number) {
+        memcpy(slot->buffer, buffer, size_bytes);
+        slot->frame_number = frame_number;
+        slot->hash = hash;
+        slot->budget_bytes = budget_bytes;
+        slot->size_bytes = size_bytes;
+        slot->quantization = slice_stats->quantization;
+        slot->refinement = slice_stats->refinement;
+        slot->padding_bytes = slice_stats->padding_bytes;
+        slot->valid = 1;
+    }
+    svt_jxs_release_mutex(slot->mutex);
+}
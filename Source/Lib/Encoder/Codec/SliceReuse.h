@@ -0,0 +1,60 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _SLICE_REUSE_H_
+#define _SLICE_REUSE_H_
+
+#include "Definitions.h"
+#include "Threads/SvtObject.h"
+#include "SvtJpegxs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************
+ * Packed slices of previous frames, used when reuse_unchanged_slices is enabled (screen content).
+ * Coding of slice depends only on its input lines, lines around read by vertical DWT and budget of slice,
+ * so slice with the same hash of these lines and the same budget is copied instead of encoded again.
+ * Slot is selected by slice index and keep bytes of the newest frame that encoded slice.
+ **************************************/
+typedef struct SliceReuseSlot {
+    Handle_t mutex;
+    uint8_t valid;
+    uint64_t frame_number;
+    uint64_t hash;
+    uint32_t budget_bytes;
+    uint32_t size_bytes;
+    uint8_t quantization;
+    uint8_t refinement;
+    uint32_t padding_bytes;
+    uint8_t *buffer;
+} SliceReuseSlot_t;
+
+typedef struct SliceReuse {
+    DctorCall dctor;
+    uint32_t slots_num;
+    SliceReuseSlot_t *slots;
+} SliceReuse_t;
+
+/**************************************
+ * Extern Function Declarations
+ **************************************/
+/*slice_sizes: size of every slice in codestream, the largest size that can be kept by slot.*/
+extern SvtJxsErrorType_t slice_reuse_ctor(SliceReuse_t *obj, const uint32_t *slice_sizes, uint32_t slice_num);
+/*Hash of input line (xxHash64), seed chains lines of slice.*/
+extern uint64_t slice_reuse_hash(uint64_t seed, const uint8_t *data, size_t size);
+/*Return 1 when slice with the same hash and budget is copied to buffer and its statistics to slice_stats.*/
+extern uint8_t slice_reuse_load(SliceReuse_t *obj, uint32_t slice_idx, uint64_t hash, uint32_t budget_bytes, uint8_t *buffer,
+                                uint32_t size_bytes, svt_jpeg_xs_slice_stats_t *slice_stats);
+/*Keep encoded slice, older frame do not overwrite slice stored by newer frame.*/
+extern void slice_reuse_store(SliceReuse_t *obj, uint64_t frame_number, uint32_t slice_idx, uint64_t hash, uint32_t budget_bytes,
+                              const uint8_t *buffer, uint32_t size_bytes, const svt_jpeg_xs_slice_stats_t *slice_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_SLICE_REUSE_H_*/
@@ -0,0 +1,275 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Transcode.h"
+#include "Encoder.h"
+#include "PictureControlSet.h"
+#include "GcStageProcess.h"
+#include "Decoder.h"
+#include "DecThreadInit.h"
+#include "Packing.h"
+#include "ParseHeader.h"
+
+SvtJxsErrorType_t transcode_ctor(Transcode_t* obj, svt_jpeg_xs_encoder_common_t* enc_common, proxy_mode_t proxy_mode,
+                                 CPU_FLAGS cpu_flags, uint32_t verbose) {
+    pi_t* pi = &enc_common->pi;
+    uint32_t sx[MAX_COMPONENTS_NUM] = {0};
+    uint32_t sy[MAX_COMPONENTS_NUM] = {0};
+    for (uint32_t c = 0; c < pi->comps_num; ++c) {
+        sx[c] = pi->components[c].Sx;
+        sy[c] = pi->components[c].Sy;
+    }
+
+    /*Precinct of encoder is always one column, band lines of source are written directly to precinct buffers.*/
+    assert(enc_common->Cw == 0);
+    obj->dctor = NULL;
+    obj->proxy_mode = proxy_mode;
+    obj->verbose = verbose;
+    obj->picture_header_const_valid = 0;
+    setup_decoder_rtcd(&obj->decoder_rtcd, cpu_flags);
+
+    /*Same precincts and slices as encoder, slice height is calculated like in decoder from Hsl.*/
+    return pi_compute(&obj->pi,
+                      0 /*Init decoder*/,
+                      pi->comps_num,
+                      pi->coeff_group_size,
+                      pi->significance_group_size,
+                      pi->width,
+                      pi->height,
+                      pi->decom_h,
+                      pi->decom_v,
+                      pi->Sd,
+                      sx,
+                      sy,
+                      enc_common->Cw,
+                      pi->precincts_per_slice * (1 << pi->decom_v));
+}
+
+/*Precincts of source and encoder have to be the same, otherwise coefficients can not be unpacked to precincts of encoder.*/
+static uint8_t transcode_pi_match(const pi_t* source, const pi_t* pi) {
+    if (source->comps_num != pi->comps_num || source->width != pi->width || source->height != pi->height ||
+        source->decom_h != pi->decom_h || source->decom_v != pi->decom_v || source->coeff_group_size != pi->coeff_group_size ||
+        source->significance_group_size != pi->significance_group_size ||
+        source->precincts_per_slice != pi->precincts_per_slice || source->precincts_col_num != pi->precincts_col_num ||
+        source->precincts_line_num != pi->precincts_line_num || source->slice_num != pi->slice_num) {
+        return 0;
+    }
+    for (uint32_t c = 0; c < pi->comps_num; ++c) {
+        const pi_component_t* comp_source = &source->components[c];
+        const pi_component_t* comp = &pi->components[c];
+        if (comp_source->Sx != comp->Sx || comp_source->Sy != comp->Sy || comp_source->width != comp->width ||
+            comp_source->height != comp->height || comp_source->decom_h != comp->decom_h ||
+            comp_source->decom_v != comp->decom_v || comp_source->precinct_height != comp->precinct_height ||
+            comp_source->bands_num != comp->bands_num) {
+            return 0;
+        }
+        for (uint32_t b = 0; b < comp->bands_num; ++b) {
+            if (comp_source->bands[b].width != comp->bands[b].width ||
+                comp_source->bands[b].height_lines_num != comp->bands[b].height_lines_num) {
+                return 0;
+            }
+            for (uint32_t type = 0; type < PRECINCT_MAX; ++type) {
+                const precinct_band_info_t* b_info_source = &source->p_info[type].b_info[c][b];
+                const precinct_band_info_t* b_info = &pi->p_info[type].b_info[c][b];
+                if (b_info_source->width != b_info->width || b_info_source->height != b_info->height ||
+                    b_info_source->gcli_width != b_info->gcli_width ||
+                    b_info_source->significance_width != b_info->significance_width) {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/*Picture information of source is calculated from header like in decoder, proxy mode drop highest decompositions.*/
+static SvtJxsErrorType_t transcode_source_init(Transcode_t* obj, svt_jpeg_xs_encoder_common_t* enc_common,
+                                               picture_header_const_t* hdr_const) {
+    pi_t pi_source;
+    SvtJxsErrorType_t error = pi_compute(&pi_source,
+                                         0 /*Init decoder*/,
+                                         hdr_const->hdr_comps_num,
+                                         hdr_const->hdr_coeff_group_size,
+                                         hdr_const->hdr_significance_group_size,
+                                         hdr_const->hdr_width,
+                                         hdr_const->hdr_height,
+                                         hdr_const->hdr_decom_h,
+                                         hdr_const->hdr_decom_v,
+                                         hdr_const->hdr_Sd,
+                                         hdr_const->hdr_Sx,
+                                         hdr_const->hdr_Sy,
+                                         hdr_const->hdr_precinct_width,
+                                         hdr_const->hdr_Hsl * (1 << hdr_const->hdr_decom_v));
+    if (error != SvtJxsErrorNone) {
+        return error;
+    }
+    copy_weights_table(&pi_source, hdr_const);
+    error = pi_update_proxy_mode(&pi_source, obj->proxy_mode, obj->verbose);
+    if (error != SvtJxsErrorNone) {
+        return error;
+    }
+
+    uint8_t match = hdr_const->hdr_precinct_width == enc_common->Cw && hdr_const->hdr_Cpih == 0 &&
+        transcode_pi_match(&pi_source, &obj->pi);
+    for (uint32_t c = 0; c < hdr_const->hdr_comps_num && match; ++c) {
+        match = hdr_const->hdr_bit_depth[c] == enc_common->bit_depth;
+    }
+    if (!match) {
+        if (obj->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Error: Transcode source have different size, format, decomposition or slice height than encoder!\n");
+        }
+        return SvtJxsErrorBadParameter;
+    }
+    obj->pi = pi_source;
+    return SvtJxsErrorNone;
+}
+
+void transcode_frame_init(Transcode_t* obj, PictureControlSet* pcs_ptr) {
+    svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
+    const svt_jpeg_xs_bitstream_buffer_t* source = pcs_ptr->enc_input.transcode_source;
+    const picture_header_dynamic_t* hdr_dynamic = &pcs_ptr->transcode_header_dynamic;
+    pi_t* pi = &obj->pi;
+
+    /*Tested in svt_jpeg_xs_encoder_send_picture()*/
+    assert(source && source->buffer);
+
+    picture_header_const_t picture_header_const;
+    memset(&picture_header_const, 0, sizeof(picture_header_const));
+    memset(&pcs_ptr->transcode_header_dynamic, 0, sizeof(pcs_ptr->transcode_header_dynamic));
+    bitstream_reader_t bitstream;
+    bitstream_reader_init(&bitstream, source->buffer, source->used_size);
+    SvtJxsErrorType_t error = get_header(&bitstream, &picture_header_const, &pcs_ptr->transcode_header_dynamic, obj->verbose);
+
+    /*Coefficients keep fraction bits of source, non-linearity is not written by encoder.*/
+    if (error == SvtJxsErrorNone &&
+        (hdr_dynamic->hdr_Bw != enc_common->picture_header_dynamic.hdr_Bw ||
+         hdr_dynamic->hdr_Fq != enc_common->picture_header_dynamic.hdr_Fq || hdr_dynamic->hdr_Tnlt != 0)) {
+        if (obj->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Error: Transcode source use not supported wavelet precision or non-linearity!\n");
+        }
+        error = SvtJxsErrorBadParameter;
+    }
+
+    /*Picture information is used by unpack of every slice task, it is set only once before first frame is sent to slices.*/
+    if (error == SvtJxsErrorNone && !obj->picture_header_const_valid) {
+        error = transcode_source_init(obj, enc_common, &picture_header_const);
+        if (error == SvtJxsErrorNone) {
+            obj->picture_header_const = picture_header_const;
+            obj->picture_header_const_valid = 1;
+        }
+    }
+    else if (error == SvtJxsErrorNone &&
+             memcmp(&obj->picture_header_const, &picture_header_const, sizeof(picture_header_const))) {
+        if (obj->verbose >= VERBOSE_ERRORS) {
+            fprintf(stderr, "Error: Header of transcode source can not change between frames!\n");
+        }
+        error = SvtJxsErrorBadParameter;
+    }
+
+    uint32_t offset = bitstream_reader_get_used_bytes(&bitstream);
+    for (uint32_t slice = 0; slice < pi->slice_num && error == SvtJxsErrorNone; ++slice) {
+        uint32_t slice_size = 0;
+        pcs_ptr->transcode_slice_offsets[slice] = offset;
+        error = (SvtJxsErrorType_t)get_slice_size(pi, source->buffer + offset, source->used_size - offset, slice, &slice_size);
+        offset += slice_size;
+    }
+    pcs_ptr->transcode_slice_offsets[pi->slice_num] = offset;
+    pcs_ptr->transcode_error = error;
+}
+
+SvtJxsErrorType_t transcode_context_alloc(TranscodeContext_t* ctx, const pi_t* pi) {
+    const precinct_info_t* precinct_normal = &pi->p_info[PRECINCT_NORMAL];
+    for (uint32_t i = 0; i < 2; ++i) {
+        precinct_t* p = &ctx->precincts[i];
+        for (uint32_t c = 0; c < pi->comps_num; ++c) {
+            for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
+                const uint32_t height_lines_num = pi->components[c].bands[b].height_lines_num;
+                SVT_MALLOC(p->bands[c][b].gcli_data, (size_t)precinct_normal->b_info[c][b].gcli_width * height_lines_num);
+                SVT_MALLOC(p->bands[c][b].significance_data,
+                           (size_t)precinct_normal->b_info[c][b].significance_width * height_lines_num);
+            }
+        }
+    }
+    ctx->precinct_top = NULL;
+    return SvtJxsErrorNone;
+}
+
+void transcode_context_free(TranscodeContext_t* ctx, const pi_t* pi) {
+    for (uint32_t i = 0; i < 2; ++i) {
+        for (uint32_t c = 0; c < pi->comps_num; ++c) {
+            for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
+                SVT_FREE(ctx->precincts[i].bands[c][b].gcli_data);
+                SVT_FREE(ctx->precincts[i].bands[c][b].significance_data);
+            }
+        }
+    }
+}
+
+SvtJxsErrorType_t transcode_slice_begin(Transcode_t* obj, TranscodeContext_t* ctx, PictureControlSet* pcs_ptr,
+                                        uint32_t slice_idx) {
+    if (pcs_ptr->transcode_error != SvtJxsErrorNone) {
+        return pcs_ptr->transcode_error;
+    }
+    /*Worker of shared pool can run tasks of other instances, bind kernels of decoder for every slice.*/
+    bind_decoder_rtcd(&obj->decoder_rtcd);
+
+    const uint32_t begin = pcs_ptr->transcode_slice_offsets[slice_idx];
+    const uint32_t end = pcs_ptr->transcode_slice_offsets[slice_idx + 1];
+    bitstream_reader_init(&ctx->bitstream, pcs_ptr->enc_input.transcode_source->buffer + begin, end - begin);
+    ctx->precinct_top = NULL;
+
+    uint16_t source_slice_idx = 0;
+    SvtJxsErrorType_t error = get_slice_header(&ctx->bitstream, &source_slice_idx);
+    if (error == SvtJxsErrorNone && source_slice_idx != slice_idx) {
+        error = SvtJxsErrorDecoderInvalidBitstream;
+    }
+    return error;
+}
+
+SvtJxsErrorType_t transcode_precinct_calculate_data(Transcode_t* obj, TranscodeContext_t* ctx, PictureControlSet* pcs_ptr,
+                                                    precinct_enc_t* precinct) {
+    svt_jpeg_xs_encoder_common_t* enc_common = pcs_ptr->enc_common;
+    const picture_header_dynamic_t* picture_header_dynamic = &pcs_ptr->transcode_header_dynamic;
+    pi_t* pi = &obj->pi;
+    precinct_t* source = (ctx->precinct_top == &ctx->precincts[0]) ? &ctx->precincts[1] : &ctx->precincts[0];
+
+    /*Precincts have one column, bands of source are unpacked directly to coefficient buffers of encoder precinct.*/
+    source->p_info = &pi->p_info[(precinct->prec_idx + 1 >= pi->precincts_line_num) ? PRECINCT_LAST : PRECINCT_NORMAL_LAST];
+    for (uint32_t c = 0; c < pi->comps_num; ++c) {
+        for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
+            assert(source->p_info->b_info[c][b].height == precinct->p_info->b_info[c][b].height);
+            assert(source->p_info->b_info[c][b].width == pi->components[c].bands[b].width);
+            source->bands[c][b].coeff_data = precinct->bands[c][b].lines_common[0].coeff_data_ptr_16bit;
+        }
+    }
+
+    SvtJxsErrorType_t error = unpack_precinct(
+        &ctx->bitstream, source, ctx->precinct_top, pi, picture_header_dynamic, obj->verbose);
+    if (error != SvtJxsErrorNone) {
+        return error;
+    }
+
+    /*Coefficients stay in sign and magnitude representation used by encoder.*/
+    for (uint32_t c = 0; c < pi->comps_num; ++c) {
+        for (uint32_t b = 0; b < pi->components[c].bands_num; ++b) {
+            const precinct_band_info_t* b_info = &source->p_info->b_info[c][b];
+            precinct_band_t* b_data = &source->bands[c][b];
+            for (uint32_t line_idx = 0; line_idx < b_info->height; ++line_idx) {
+                dequant(precinct->bands[c][b].lines_common[line_idx].coeff_data_ptr_16bit,
+                        b_info->width,
+                        b_data->gcli_data + line_idx * b_info->gcli_width,
+                        pi->coeff_group_size,
+                        b_data->gtli,
+                        picture_header_dynamic->hdr_Qpih);
+            }
+        }
+        precinct_component_calculate_gc(enc_common, precinct, c);
+    }
+    ctx->precinct_top = source;
+    return SvtJxsErrorNone;
+}
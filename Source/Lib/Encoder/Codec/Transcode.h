@@ -0,0 +1,72 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _TRANSCODE_H_
+#define _TRANSCODE_H_
+
+#include "Definitions.h"
+#include "Threads/SvtObject.h"
+#include "Pi.h"
+#include "PrecinctEnc.h"
+#include "BitstreamReader.h"
+#include "decoder_dsp_rtcd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************
+ * Transcoding of codestream to budget of encoder in coefficients domain.
+ * Precincts of source codestream are unpacked and dequantized to coefficient buffers of encoder,
+ * then GCLI, Rate Control, Quantization and Pack of encoder write them again, DWT and image are not used.
+ * Source have to be coded with geometry of encoder: size, format, decomposition, slice height and Cw = 0.
+ * In proxy mode highest decompositions of source are dropped like in decoder and only lower bands are unpacked,
+ * then remaining bands have to be the same as bands of encoder.
+ **************************************/
+typedef struct Transcode {
+    DctorCall dctor;
+    /*Picture information of source, calculated from header of first frame and can not change.
+     *Before first frame it is calculated from geometry of encoder, bands sizes are the same.*/
+    pi_t pi;
+    proxy_mode_t proxy_mode;
+    picture_header_const_t picture_header_const;
+    uint8_t picture_header_const_valid;
+    /*Kernels of decoder, bound by Pack Stage task before unpack of slice.*/
+    decoder_rtcd_t decoder_rtcd;
+    uint32_t verbose;
+} Transcode_t;
+
+/*Unpack state of one Pack Stage context, actual precinct and top precinct used by vertical prediction.*/
+typedef struct TranscodeContext {
+    precinct_t precincts[2];
+    precinct_t* precinct_top;
+    bitstream_reader_t bitstream;
+} TranscodeContext_t;
+
+struct svt_jpeg_xs_encoder_common;
+struct PictureControlSet;
+
+/**************************************
+ * Extern Function Declarations
+ **************************************/
+extern SvtJxsErrorType_t transcode_ctor(Transcode_t *obj, struct svt_jpeg_xs_encoder_common *enc_common,
+                                        proxy_mode_t proxy_mode, CPU_FLAGS cpu_flags, uint32_t verbose);
+/*Parse header and find slices of source codestream, called by Init Stage before slices of frame are sent.
+ *Result is kept in picture control set, error is returned by every slice of frame.*/
+extern void transcode_frame_init(Transcode_t *obj, struct PictureControlSet *pcs_ptr);
+extern SvtJxsErrorType_t transcode_context_alloc(TranscodeContext_t *ctx, const pi_t *pi);
+extern void transcode_context_free(TranscodeContext_t *ctx, const pi_t *pi);
+/*Read slice header of source, first precinct of slice is unpacked without top precinct.*/
+extern SvtJxsErrorType_t transcode_slice_begin(Transcode_t *obj, TranscodeContext_t *ctx, struct PictureControlSet *pcs_ptr,
+                                               uint32_t slice_idx);
+/*Unpack and dequantize next precinct of slice to coefficients of precinct, then calculate GCLI like after DWT.*/
+extern SvtJxsErrorType_t transcode_precinct_calculate_data(Transcode_t *obj, TranscodeContext_t *ctx,
+                                                           struct PictureControlSet *pcs_ptr, precinct_enc_t *precinct);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TRANSCODE_H_*/
@@ -98,11 +98,10 @@
 #define SET_AVX2_AVX512(ptr, c, avx2, avx512)               SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, avx512)
 #define SET_AVX512(ptr, c, avx512)                          SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, 0, avx512)
 
-void setup_encoder_rtcd_internal(CPU_FLAGS flags) {
-    /* Avoid check that pointer is set double, after first  setup. */
-    static uint8_t first_call_setup = 1;
-    uint8_t check_pointer_was_set = first_call_setup;
-    first_call_setup = 0;
+void setup_encoder_rtcd(encoder_rtcd_t* rtcd, CPU_FLAGS flags) {
+    /* Table is always resolved from scratch, so check that no pointer is set twice. */
+    uint8_t check_pointer_was_set = 1;
+    memset(rtcd, 0, sizeof(*rtcd));
 #ifdef ARCH_X86_64
     /** Should be done during library initialization,
       but for safe limiting cpu flags again. */
@@ -113,74 +112,126 @@ void setup_encoder_rtcd_internal(CPU_FLAGS flags) {
 #endif
 
     //SET_AVX2(get_sigflags_gc, get_sigflags_gc_c, get_sigflags_gc_avx2);
-    SET_AVX2_AVX512(image_shift, image_shift_c, image_shift_avx2, image_shift_avx512);
-    SET_AVX2_AVX512(dwt_horizontal_line, dwt_horizontal_line_c, dwt_horizontal_line_avx2, dwt_horizontal_line_avx512);
+    SET_AVX2_AVX512(rtcd->image_shift, image_shift_c, image_shift_avx2, image_shift_avx512);
+    SET_AVX2_AVX512(rtcd->dwt_horizontal_line, dwt_horizontal_line_c, dwt_horizontal_line_avx2, dwt_horizontal_line_avx512);
 
-    SET_AVX2_AVX512(transform_V1_Hx_precinct_recalc_HF_prev,
+    SET_AVX2_AVX512(rtcd->transform_V1_Hx_precinct_recalc_HF_prev,
                     transform_V1_Hx_precinct_recalc_HF_prev_c,
                     transform_V1_Hx_precinct_recalc_HF_prev_avx2,
                     transform_V1_Hx_precinct_recalc_HF_prev_avx512);
-    SET_AVX2_AVX512(transform_vertical_loop_hf_line_0,
+    SET_AVX2_AVX512(rtcd->transform_vertical_loop_hf_line_0,
                     transform_vertical_loop_hf_line_0_c,
                     transform_vertical_loop_hf_line_0_avx2,
                     transform_vertical_loop_hf_line_0_avx512);
-    SET_AVX2_AVX512(transform_vertical_loop_lf_line_0,
+    SET_AVX2_AVX512(rtcd->transform_vertical_loop_lf_line_0,
                     transform_vertical_loop_lf_line_0_c,
                     transform_vertical_loop_lf_line_0_avx2,
                     transform_vertical_loop_lf_line_0_avx512);
-    SET_AVX2_AVX512(transform_vertical_loop_lf_hf_line_0,
+    SET_AVX2_AVX512(rtcd->transform_vertical_loop_lf_hf_line_0,
                     transform_vertical_loop_lf_hf_line_0_c,
                     transform_vertical_loop_lf_hf_line_0_avx2,
                     transform_vertical_loop_lf_hf_line_0_avx512);
-    SET_AVX2_AVX512(transform_vertical_loop_lf_hf_line_x_prev,
+    SET_AVX2_AVX512(rtcd->transform_vertical_loop_lf_hf_line_x_prev,
                     transform_vertical_loop_lf_hf_line_x_prev_c,
                     transform_vertical_loop_lf_hf_line_x_prev_avx2,
                     transform_vertical_loop_lf_hf_line_x_prev_avx512);
-    SET_AVX2_AVX512(transform_vertical_loop_lf_hf_hf_line_x,
+    SET_AVX2_AVX512(rtcd->transform_vertical_loop_lf_hf_hf_line_x,
                     transform_vertical_loop_lf_hf_hf_line_x_c,
                     transform_vertical_loop_lf_hf_hf_line_x_avx2,
                     transform_vertical_loop_lf_hf_hf_line_x_avx512);
-    SET_AVX2_AVX512(transform_vertical_loop_lf_hf_hf_line_last_even,
+    SET_AVX2_AVX512(rtcd->transform_vertical_loop_lf_hf_hf_line_last_even,
                     transform_vertical_loop_lf_hf_hf_line_last_even_c,
                     transform_vertical_loop_lf_hf_hf_line_last_even_avx2,
                     transform_vertical_loop_lf_hf_hf_line_last_even_avx512);
 
-    SET_AVX2_AVX512(
-        gc_precinct_stage_scalar, gc_precinct_stage_scalar_c, gc_precinct_stage_scalar_avx2, gc_precinct_stage_scalar_avx512);
-    SET_SSE41_AVX2_AVX512(quantization, quantization_c, quantization_sse4_1, quantization_avx2, quantization_avx512);
-    SET_AVX2_AVX512(linear_input_scaling_line_8bit,
+    SET_AVX2_AVX512(rtcd->gc_precinct_stage_scalar,
+                    gc_precinct_stage_scalar_c,
+                    gc_precinct_stage_scalar_avx2,
+                    gc_precinct_stage_scalar_avx512);
+    SET_SSE41_AVX2_AVX512(rtcd->quantization, quantization_c, quantization_sse4_1, quantization_avx2, quantization_avx512);
+    SET_AVX2_AVX512(rtcd->linear_input_scaling_line_8bit,
                     linear_input_scaling_line_8bit_c,
                     linear_input_scaling_line_8bit_avx2,
                     linear_input_scaling_line_8bit_avx512);
-    SET_AVX2_AVX512(linear_input_scaling_line_16bit,
+    SET_AVX2_AVX512(rtcd->linear_input_scaling_line_16bit,
                     linear_input_scaling_line_16bit_c,
                     linear_input_scaling_line_16bit_avx2,
                     linear_input_scaling_line_16bit_avx512);
 
-    SET_AVX2_AVX512(pack_data_single_group, pack_data_single_group_c, NULL, pack_data_single_group_avx512);
-    SET_SSE2(gc_precinct_stage_scalar_loop, gc_precinct_stage_scalar_loop_c, gc_precinct_stage_scalar_loop_ASM);
-    SET_SSE41(gc_precinct_sigflags_max, gc_precinct_sigflags_max_c, gc_precinct_sigflags_max_sse4_1);
-    SET_AVX2_AVX512(rate_control_calc_vpred_cost_nosigf,
+    SET_AVX2_AVX512(rtcd->pack_data_single_group, pack_data_single_group_c, NULL, pack_data_single_group_avx512);
+    SET_SSE2(rtcd->gc_precinct_stage_scalar_loop, gc_precinct_stage_scalar_loop_c, gc_precinct_stage_scalar_loop_ASM);
+    SET_SSE41(rtcd->gc_precinct_sigflags_max, gc_precinct_sigflags_max_c, gc_precinct_sigflags_max_sse4_1);
+    SET_AVX2_AVX512(rtcd->rate_control_calc_vpred_cost_nosigf,
                     rate_control_calc_vpred_cost_nosigf_c,
                     rate_control_calc_vpred_cost_nosigf_avx2,
                     rate_control_calc_vpred_cost_nosigf_avx512);
-    SET_AVX512(rate_control_calc_vpred_cost_sigf_nosigf,
+    SET_AVX512(rtcd->rate_control_calc_vpred_cost_sigf_nosigf,
                rate_control_calc_vpred_cost_sigf_nosigf_c,
                rate_control_calc_vpred_cost_sigf_nosigf_avx512);
 
-    SET_AVX2_AVX512(convert_packed_to_planar_rgb_8bit,
+    SET_AVX2_AVX512(rtcd->convert_packed_to_planar_rgb_8bit,
                     convert_packed_to_planar_rgb_8bit_c,
                     convert_packed_to_planar_rgb_8bit_avx2,
                     convert_packed_to_planar_rgb_8bit_avx512);
-    SET_AVX2_AVX512(convert_packed_to_planar_rgb_16bit,
+    SET_AVX2_AVX512(rtcd->convert_packed_to_planar_rgb_16bit,
                     convert_packed_to_planar_rgb_16bit_c,
                     convert_packed_to_planar_rgb_16bit_avx2,
                     convert_packed_to_planar_rgb_16bit_avx512);
 
+    SET_AVX2_AVX512(rtcd->image_shift_int16, image_shift_int16_c, image_shift_int16_avx2, image_shift_int16_avx512);
+    SET_AVX2_AVX512(rtcd->dwt_horizontal_line_input_8bit,
+                    dwt_horizontal_line_input_8bit_c,
+                    dwt_horizontal_line_input_8bit_avx2,
+                    dwt_horizontal_line_input_8bit_avx512);
+    SET_AVX2_AVX512(rtcd->dwt_horizontal_line_input_16bit,
+                    dwt_horizontal_line_input_16bit_c,
+                    dwt_horizontal_line_input_16bit_avx2,
+                    dwt_horizontal_line_input_16bit_avx512);
+    SET_AVX2(rtcd->dwt_horizontal_line_int16_input_8bit,
+             dwt_horizontal_line_int16_input_8bit_c,
+             dwt_horizontal_line_int16_input_8bit_avx2);
+    SET_AVX2(rtcd->dwt_horizontal_line_int16_input_16bit,
+             dwt_horizontal_line_int16_input_16bit_c,
+             dwt_horizontal_line_int16_input_16bit_avx2);
+
 #if defined(__aarch64__) || defined(_M_ARM64)
     if (flags & CPU_FLAGS_NEON) {
-        dwt_horizontal_line = dwt_horizontal_line_neon;
-        quantization = quantization_neon;
+        rtcd->dwt_horizontal_line = dwt_horizontal_line_neon;
+        rtcd->quantization = quantization_neon;
     }
 #endif
 }
+
+void bind_encoder_rtcd(const encoder_rtcd_t* rtcd) {
+    image_shift = rtcd->image_shift;
+    gc_precinct_stage_scalar = rtcd->gc_precinct_stage_scalar;
+    quantization = rtcd->quantization;
+    linear_input_scaling_line_8bit = rtcd->linear_input_scaling_line_8bit;
+    linear_input_scaling_line_16bit = rtcd->linear_input_scaling_line_16bit;
+    pack_data_single_group = rtcd->pack_data_single_group;
+    gc_precinct_stage_scalar_loop = rtcd->gc_precinct_stage_scalar_loop;
+    dwt_horizontal_line = rtcd->dwt_horizontal_line;
+    transform_V1_Hx_precinct_recalc_HF_prev = rtcd->transform_V1_Hx_precinct_recalc_HF_prev;
+    transform_vertical_loop_hf_line_0 = rtcd->transform_vertical_loop_hf_line_0;
+    transform_vertical_loop_lf_line_0 = rtcd->transform_vertical_loop_lf_line_0;
+    transform_vertical_loop_lf_hf_line_0 = rtcd->transform_vertical_loop_lf_hf_line_0;
+    transform_vertical_loop_lf_hf_line_x_prev = rtcd->transform_vertical_loop_lf_hf_line_x_prev;
+    transform_vertical_loop_lf_hf_hf_line_x = rtcd->transform_vertical_loop_lf_hf_hf_line_x;
+    transform_vertical_loop_lf_hf_hf_line_last_even = rtcd->transform_vertical_loop_lf_hf_hf_line_last_even;
+    gc_precinct_sigflags_max = rtcd->gc_precinct_sigflags_max;
+    rate_control_calc_vpred_cost_nosigf = rtcd->rate_control_calc_vpred_cost_nosigf;
+    rate_control_calc_vpred_cost_sigf_nosigf = rtcd->rate_control_calc_vpred_cost_sigf_nosigf;
+    convert_packed_to_planar_rgb_8bit = rtcd->convert_packed_to_planar_rgb_8bit;
+    convert_packed_to_planar_rgb_16bit = rtcd->convert_packed_to_planar_rgb_16bit;
+    image_shift_int16 = rtcd->image_shift_int16;
+    dwt_horizontal_line_input_8bit = rtcd->dwt_horizontal_line_input_8bit;
+    dwt_horizontal_line_input_16bit = rtcd->dwt_horizontal_line_input_16bit;
+    dwt_horizontal_line_int16_input_8bit = rtcd->dwt_horizontal_line_int16_input_8bit;
+    dwt_horizontal_line_int16_input_16bit = rtcd->dwt_horizontal_line_int16_input_16bit;
+}
+
+void setup_encoder_rtcd_internal(CPU_FLAGS flags) {
+    encoder_rtcd_t rtcd;
+    setup_encoder_rtcd(&rtcd, flags);
+    bind_encoder_rtcd(&rtcd);
+}
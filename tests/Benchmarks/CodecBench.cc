@@ -0,0 +1,870 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/*
+ * End-to-end benchmark of encoder and decoder.
+ * Synthetic frames are generated in memory, then every combination of swept parameters
+ * (content, threads_num, cpu_profile, slice_height, rate_control_mode, preset) is encoded and decoded.
+ * Throughput, percentiles of frame and slice latency collected by library statistics
+ * and PSNR of decoded frames are written as JSON.
+ * With --transcode-bpp encoded codestreams are also transcoded to other bpp, and compared with decoding them
+ * and encoding decoded image with that bpp.
+ *
+ * Usage: SvtJpegxsBench [options], --help for list of options
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SvtJpegxsEnc.h"
+#include "SvtJpegxsDec.h"
+#include "SvtJpegxsImageBufferTools.h"
+
+#define BENCH_CONTENT_FRAMES (4)  /*Different frames of synthetic content sent in loop*/
+#define BENCH_RING_SIZE      (16) /*Frames in flight: output buffers and statistics reused by next frames*/
+
+struct Options {
+    uint32_t width = 1920;
+    uint32_t height = 1080;
+    uint8_t bit_depth = 8;
+    ColourFormat_t format = COLOUR_FORMAT_PLANAR_YUV422;
+    uint32_t bpp_numerator = 3;
+    uint32_t bpp_denominator = 1;
+    uint32_t transcode_bpp_numerator = 0; /*0 when transcode is not measured*/
+    uint32_t transcode_bpp_denominator = 1;
+    uint32_t frames = 100;
+    uint32_t warmup = 10;
+    uint32_t in_flight = BENCH_RING_SIZE;
+    bool decode = true;
+    std::vector<std::string> contents;
+    std::vector<uint32_t> threads;
+    std::vector<uint32_t> cpu_profiles;
+    std::vector<uint32_t> slice_heights;
+    std::vector<uint32_t> rc_modes;
+    std::vector<uint32_t> presets;
+    const char* output = NULL;
+};
+
+struct FormatName {
+    const char* name;
+    ColourFormat_t format;
+};
+
+static const FormatName formats[] = {
+    {"yuv400", COLOUR_FORMAT_PLANAR_YUV400},
+    {"yuv420", COLOUR_FORMAT_PLANAR_YUV420},
+    {"yuv422", COLOUR_FORMAT_PLANAR_YUV422},
+    {"yuv444", COLOUR_FORMAT_PLANAR_YUV444_OR_RGB},
+};
+
+static uint32_t next_random(uint32_t* state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+/*Smooth noise: random values in grid of cell x cell samples, bilinear interpolation between them.*/
+static double value_noise(const std::vector<double>& lattice, uint32_t lattice_width, uint32_t x, uint32_t y, uint32_t cell) {
+    const uint32_t gx = x / cell;
+    const uint32_t gy = y / cell;
+    const double fx = (double)(x % cell) / cell;
+    const double fy = (double)(y % cell) / cell;
+    const double* row0 = &lattice[gy * lattice_width + gx];
+    const double* row1 = row0 + lattice_width;
+    const double top = row0[0] + (row0[1] - row0[0]) * fx;
+    const double bottom = row1[0] + (row1[1] - row1[0]) * fx;
+    return top + (bottom - top) * fy;
+}
+
+/*Fill one plane of width x height samples with values in range of bit_depth.
+ *noise - uniform random, gradient - diagonal ramps, natural - fractal smooth noise with fine grain,
+ *like textures and soft edges of camera content.*/
+static void fill_plane(void* data, uint32_t width, uint32_t height, uint8_t bit_depth, const std::string& content,
+                       uint32_t seed) {
+    const uint32_t max_value = (1u << bit_depth) - 1;
+    uint32_t state = seed * 2654435761u + 1;
+    std::vector<double> values((size_t)width * height);
+
+    if (content == "noise") {
+        for (double& v : values) {
+            v = (double)(next_random(&state) & max_value) / max_value;
+        }
+    }
+    else if (content == "gradient") {
+        const double phase = (double)(seed % 7) / 7.0;
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                const double v = ((double)x / width + (double)y / height) / 2 + phase;
+                values[(size_t)y * width + x] = v - floor(v);
+            }
+        }
+    }
+    else {
+        /*Octaves of smooth noise from 256 to 4 samples, amplitude halved for every octave.*/
+        double amplitude = 0.5;
+        for (uint32_t cell = 256; cell >= 4; cell /= 2, amplitude /= 2) {
+            const uint32_t lattice_width = width / cell + 2;
+            const uint32_t lattice_height = height / cell + 2;
+            std::vector<double> lattice((size_t)lattice_width * lattice_height);
+            for (double& l : lattice) {
+                l = (double)(next_random(&state) & 0xffff) / 0xffff - 0.5;
+            }
+            for (uint32_t y = 0; y < height; y++) {
+                for (uint32_t x = 0; x < width; x++) {
+                    values[(size_t)y * width + x] += amplitude * value_noise(lattice, lattice_width, x, y, cell);
+                }
+            }
+        }
+        for (double& v : values) {
+            const double grain = ((double)(next_random(&state) & 0xff) / 0xff - 0.5) / 64;
+            v = std::min(1.0, std::max(0.0, v + 0.5 + grain));
+        }
+    }
+
+    for (size_t i = 0; i < values.size(); i++) {
+        const uint32_t sample = (uint32_t)(values[i] * max_value + 0.5);
+        if (bit_depth <= 8) {
+            ((uint8_t*)data)[i] = (uint8_t)sample;
+        }
+        else {
+            ((uint16_t*)data)[i] = (uint16_t)sample;
+        }
+    }
+}
+
+static void fill_image(svt_jpeg_xs_image_buffer_t* image, const svt_jpeg_xs_image_config_t* config, const std::string& content,
+                       uint32_t seed) {
+    for (uint32_t c = 0; c < config->components_num; c++) {
+        fill_plane(image->data_yuv[c],
+                   config->components[c].width,
+                   config->components[c].height,
+                   config->bit_depth,
+                   content,
+                   seed * MAX_COMPONENTS_NUM + c);
+    }
+}
+
+struct Latency {
+    double p50;
+    double p99;
+    double p999;
+    double max;
+};
+
+/*Nearest rank percentiles in microseconds.*/
+static Latency get_latency(std::vector<uint64_t> ns) {
+    Latency latency = {0, 0, 0, 0};
+    if (ns.empty()) {
+        return latency;
+    }
+    std::sort(ns.begin(), ns.end());
+    const auto rank = [&ns](double p) -> double {
+        size_t idx = (size_t)ceil(p * ns.size());
+        idx = idx ? idx - 1 : 0;
+        return ns[std::min(idx, ns.size() - 1)] / 1000.0;
+    };
+    latency.p50 = rank(0.5);
+    latency.p99 = rank(0.99);
+    latency.p999 = rank(0.999);
+    latency.max = ns.back() / 1000.0;
+    return latency;
+}
+
+/*Statistics of frames in flight, slot of frame is reused BENCH_RING_SIZE frames later.*/
+struct StatsRing {
+    explicit StatsRing(uint32_t slices_size)
+        : frames(BENCH_RING_SIZE), slices(BENCH_RING_SIZE, std::vector<svt_jpeg_xs_slice_stats_t>(slices_size)) {
+    }
+    svt_jpeg_xs_frame_stats_t* prepare(uint32_t frame_idx) {
+        const uint32_t slot = frame_idx % BENCH_RING_SIZE;
+        memset(&frames[slot], 0, sizeof(frames[slot]));
+        frames[slot].slices = slices[slot].data();
+        frames[slot].slices_size = (uint32_t)slices[slot].size();
+        return &frames[slot];
+    }
+    std::vector<svt_jpeg_xs_frame_stats_t> frames;
+    std::vector<std::vector<svt_jpeg_xs_slice_stats_t>> slices;
+};
+
+/*Frames are sent by separate thread, so encoder or decoder pipeline is kept full.
+ *Sender waits until frame that used the same ring slot is received, receiver waits only for frames already sent,
+ *so failure on any side does not block the other one.*/
+class Pipeline {
+  public:
+    template <typename Send, typename Receive>
+    double run(uint32_t frames_num, uint32_t warmup, uint32_t in_flight, Send send, Receive receive) {
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        std::thread sender([&]() {
+            for (uint32_t f = 0; f < frames_num; f++) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock, [this, f, in_flight]() { return f < received_ + in_flight || receiver_done_; });
+                if (receiver_done_) {
+                    break;
+                }
+                lock.unlock();
+                if (f == warmup) {
+                    begin = std::chrono::steady_clock::now();
+                }
+                if (!send(f)) {
+                    break;
+                }
+                lock.lock();
+                sent_++;
+                cond_.notify_all();
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            sender_done_ = true;
+            cond_.notify_all();
+        });
+
+        for (uint32_t f = 0; f < frames_num; f++) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this, f]() { return f < sent_ || sender_done_; });
+            if (f >= sent_) {
+                break;
+            }
+            lock.unlock();
+            if (!receive(f)) {
+                break;
+            }
+            lock.lock();
+            received_++;
+            cond_.notify_all();
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            receiver_done_ = true;
+            cond_.notify_all();
+        }
+        sender.join();
+        return std::chrono::duration<double>(end - begin).count();
+    }
+    uint32_t received() const {
+        return received_;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    uint32_t sent_ = 0;
+    uint32_t received_ = 0;
+    bool sender_done_ = false;
+    bool receiver_done_ = false;
+};
+
+struct Measurement {
+    SvtJxsErrorType_t error = SvtJxsErrorNone;
+    const char* error_stage = NULL;
+    double seconds = 0;
+    uint64_t bytes = 0;
+    uint64_t memory_bytes = 0;
+    double psnr = -1;          /*Negative when not measured*/
+    double reference_fps = 0; /*Transcode: fps of decoding source and encoding decoded image, 0 when not measured*/
+    std::vector<uint64_t> frame_ns;
+    std::vector<uint64_t> slice_ns;
+
+    /*Only frames after warmup are measured.*/
+    void collect(const svt_jpeg_xs_frame_stats_t* stats, uint64_t frame_bytes, uint32_t frame_idx, uint32_t warmup) {
+        if (frame_idx < warmup) {
+            return;
+        }
+        bytes += frame_bytes;
+        frame_ns.push_back(stats->output_ns - stats->send_ns);
+        const uint32_t slices_num = std::min(stats->slices_num, stats->slices_size);
+        for (uint32_t s = 0; s < slices_num; s++) {
+            slice_ns.push_back(stats->slices[s].end_ns - stats->slices[s].begin_ns);
+        }
+    }
+};
+
+struct Config {
+    std::string content;
+    uint32_t threads;
+    uint32_t cpu_profile;
+    uint32_t slice_height;
+    uint32_t rc_mode;
+    uint32_t preset;
+};
+
+static SvtJxsErrorType_t setup_encoder(const Options& opt, const Config& cfg, svt_jpeg_xs_encoder_api_t* enc) {
+    SvtJxsErrorType_t ret = svt_jpeg_xs_encoder_load_default_parameters(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, enc);
+    if (ret != SvtJxsErrorNone) {
+        return ret;
+    }
+    enc->source_width = opt.width;
+    enc->source_height = opt.height;
+    enc->input_bit_depth = opt.bit_depth;
+    enc->colour_format = opt.format;
+    enc->bpp_numerator = opt.bpp_numerator;
+    enc->bpp_denominator = opt.bpp_denominator;
+    enc->verbose = VERBOSE_NONE;
+    enc->threads_num = cfg.threads;
+    enc->cpu_profile = (uint8_t)cfg.cpu_profile;
+    enc->slice_height = cfg.slice_height;
+    enc->rate_control_mode = cfg.rc_mode;
+    enc->preset = (uint8_t)cfg.preset;
+    enc->statistics = 1;
+    return SvtJxsErrorNone;
+}
+
+/*Encode synthetic images, or transcode codestreams of sources to bpp of opt when sources are given.*/
+static Measurement run_encoder(const Options& opt, const Config& cfg, std::vector<std::vector<uint8_t>>* bitstreams,
+                               const std::vector<std::vector<uint8_t>>* sources = NULL) {
+    Measurement m;
+    svt_jpeg_xs_encoder_api_t enc;
+    svt_jpeg_xs_image_config_t image_config;
+    uint32_t bytes_per_frame = 0;
+    m.error = setup_encoder(opt, cfg, &enc);
+    enc.transcode = sources != NULL;
+    if (m.error == SvtJxsErrorNone) {
+        m.error = svt_jpeg_xs_encoder_get_image_config(
+            SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc, &image_config, &bytes_per_frame);
+    }
+    if (m.error == SvtJxsErrorNone) {
+        m.error = svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc);
+    }
+    if (m.error != SvtJxsErrorNone) {
+        m.error_stage = "encoder_init";
+        return m;
+    }
+    svt_jpeg_xs_encoder_get_memory_usage(&enc, &m.memory_bytes);
+
+    std::vector<svt_jpeg_xs_image_buffer_t*> images;
+    for (uint32_t i = 0; i < BENCH_CONTENT_FRAMES && sources == NULL; i++) {
+        svt_jpeg_xs_image_buffer_t* image = svt_jpeg_xs_image_buffer_alloc(&image_config);
+        if (image == NULL) {
+            m.error = SvtJxsErrorInsufficientResources;
+            m.error_stage = "image_alloc";
+            break;
+        }
+        fill_image(image, &image_config, cfg.content, i);
+        images.push_back(image);
+    }
+    /*Encoder reads source codestream after send, buffers are kept until encoder is closed.*/
+    std::vector<svt_jpeg_xs_bitstream_buffer_t> source_buffers(sources ? sources->size() : 0);
+    for (size_t i = 0; i < source_buffers.size(); i++) {
+        memset(&source_buffers[i], 0, sizeof(source_buffers[i]));
+        source_buffers[i].buffer = (uint8_t*)(*sources)[i].data();
+        source_buffers[i].allocation_size = (uint32_t)(*sources)[i].size();
+        source_buffers[i].used_size = (uint32_t)(*sources)[i].size();
+    }
+
+    if (m.error == SvtJxsErrorNone) {
+        std::vector<std::vector<uint8_t>> out_buffers(BENCH_RING_SIZE, std::vector<uint8_t>(bytes_per_frame));
+        StatsRing stats((opt.height + cfg.slice_height - 1) / cfg.slice_height);
+        Pipeline pipeline;
+        SvtJxsErrorType_t send_error = SvtJxsErrorNone;
+        const auto send = [&](uint32_t f) -> bool {
+            svt_jpeg_xs_frame_t enc_input;
+            memset(&enc_input, 0, sizeof(enc_input));
+            if (sources) {
+                enc_input.transcode_source = &source_buffers[f % source_buffers.size()];
+            }
+            else {
+                enc_input.image = *images[f % BENCH_CONTENT_FRAMES];
+            }
+            enc_input.bitstream.buffer = out_buffers[f % BENCH_RING_SIZE].data();
+            enc_input.bitstream.allocation_size = bytes_per_frame;
+            enc_input.stats = stats.prepare(f);
+            send_error = svt_jpeg_xs_encoder_send_picture(&enc, &enc_input, 1);
+            return send_error == SvtJxsErrorNone;
+        };
+        const auto receive = [&](uint32_t f) -> bool {
+            svt_jpeg_xs_frame_t enc_output;
+            memset(&enc_output, 0, sizeof(enc_output));
+            m.error = svt_jpeg_xs_encoder_get_packet(&enc, &enc_output, 1);
+            if (m.error != SvtJxsErrorNone) {
+                m.error_stage = "encoder_get_packet";
+                return false;
+            }
+            m.collect(&stats.frames[f % BENCH_RING_SIZE], enc_output.bitstream.used_size, f, opt.warmup);
+            if (bitstreams && bitstreams->size() < BENCH_CONTENT_FRAMES) {
+                const uint8_t* buffer = enc_output.bitstream.buffer;
+                bitstreams->push_back(std::vector<uint8_t>(buffer, buffer + enc_output.bitstream.used_size));
+            }
+            return true;
+        };
+        const uint32_t frames_num = opt.warmup + opt.frames;
+        m.seconds = pipeline.run(frames_num, opt.warmup, opt.in_flight, send, receive);
+        if (m.error == SvtJxsErrorNone && pipeline.received() < frames_num) {
+            m.error = send_error;
+            m.error_stage = "encoder_send_picture";
+        }
+    }
+
+    for (svt_jpeg_xs_image_buffer_t* image : images) {
+        svt_jpeg_xs_image_buffer_free(image);
+    }
+    svt_jpeg_xs_encoder_close(&enc);
+    return m;
+}
+
+#define BENCH_PSNR_MAX (100.0) /*Reported for lossless frames*/
+
+/*PSNR of all components of decoded frames against source frames generated again with the same content and seed.*/
+static double get_psnr(const std::vector<svt_jpeg_xs_image_buffer_t*>& decoded, svt_jpeg_xs_image_config_t* config,
+                       const std::string& content) {
+    const double max_value = (double)((1u << config->bit_depth) - 1);
+    double error = 0;
+    uint64_t samples = 0;
+    for (uint32_t i = 0; i < decoded.size(); i++) {
+        svt_jpeg_xs_image_buffer_t* source = svt_jpeg_xs_image_buffer_alloc(config);
+        if (source == NULL) {
+            return -1;
+        }
+        fill_image(source, config, content, i);
+        for (uint32_t c = 0; c < config->components_num; c++) {
+            const uint32_t width = config->components[c].width;
+            const uint32_t height = config->components[c].height;
+            for (uint32_t y = 0; y < height; y++) {
+                for (uint32_t x = 0; x < width; x++) {
+                    const size_t src_pos = (size_t)y * source->stride[c] + x;
+                    const size_t dec_pos = (size_t)y * decoded[i]->stride[c] + x;
+                    double diff;
+                    if (config->bit_depth <= 8) {
+                        diff = (double)((uint8_t*)source->data_yuv[c])[src_pos] - ((uint8_t*)decoded[i]->data_yuv[c])[dec_pos];
+                    }
+                    else {
+                        diff = (double)((uint16_t*)source->data_yuv[c])[src_pos] -
+                            ((uint16_t*)decoded[i]->data_yuv[c])[dec_pos];
+                    }
+                    error += diff * diff;
+                }
+            }
+            samples += (uint64_t)width * height;
+        }
+        svt_jpeg_xs_image_buffer_free(source);
+    }
+    if (samples == 0) {
+        return -1;
+    }
+    if (error == 0) {
+        return BENCH_PSNR_MAX;
+    }
+    return std::min(BENCH_PSNR_MAX, 10 * log10(max_value * max_value * samples / error));
+}
+
+static Measurement run_decoder(const Options& opt, const Config& cfg, const std::vector<std::vector<uint8_t>>& bitstreams) {
+    Measurement m;
+    svt_jpeg_xs_decoder_api_t dec;
+    memset(&dec, 0, sizeof(dec));
+    dec.use_cpu_flags = CPU_FLAGS_ALL;
+    dec.verbose = VERBOSE_NONE;
+    dec.threads_num = cfg.threads;
+    dec.statistics = 1;
+    svt_jpeg_xs_image_config_t image_config;
+    m.error = svt_jpeg_xs_decoder_init(SVT_JPEGXS_API_VER_MAJOR,
+                                       SVT_JPEGXS_API_VER_MINOR,
+                                       &dec,
+                                       bitstreams[0].data(),
+                                       bitstreams[0].size(),
+                                       &image_config);
+    if (m.error != SvtJxsErrorNone) {
+        m.error_stage = "decoder_init";
+        return m;
+    }
+    svt_jpeg_xs_decoder_get_memory_usage(&dec, &m.memory_bytes);
+
+    std::vector<svt_jpeg_xs_image_buffer_t*> images;
+    for (uint32_t i = 0; i < BENCH_RING_SIZE; i++) {
+        svt_jpeg_xs_image_buffer_t* image = svt_jpeg_xs_image_buffer_alloc(&image_config);
+        if (image == NULL) {
+            m.error = SvtJxsErrorInsufficientResources;
+            m.error_stage = "image_alloc";
+            break;
+        }
+        images.push_back(image);
+    }
+
+    if (m.error == SvtJxsErrorNone) {
+        StatsRing stats((opt.height + cfg.slice_height - 1) / cfg.slice_height);
+        Pipeline pipeline;
+        SvtJxsErrorType_t send_error = SvtJxsErrorNone;
+        const auto send = [&](uint32_t f) -> bool {
+            const std::vector<uint8_t>& bitstream = bitstreams[f % bitstreams.size()];
+            svt_jpeg_xs_frame_t dec_input;
+            memset(&dec_input, 0, sizeof(dec_input));
+            dec_input.image = *images[f % BENCH_RING_SIZE];
+            dec_input.bitstream.buffer = (uint8_t*)bitstream.data();
+            dec_input.bitstream.allocation_size = (uint32_t)bitstream.size();
+            dec_input.bitstream.used_size = (uint32_t)bitstream.size();
+            dec_input.stats = stats.prepare(f);
+            send_error = svt_jpeg_xs_decoder_send_frame(&dec, &dec_input, 1);
+            return send_error == SvtJxsErrorNone;
+        };
+        const auto receive = [&](uint32_t f) -> bool {
+            svt_jpeg_xs_frame_t dec_output;
+            memset(&dec_output, 0, sizeof(dec_output));
+            m.error = svt_jpeg_xs_decoder_get_frame(&dec, &dec_output, 1);
+            if (m.error != SvtJxsErrorNone) {
+                m.error_stage = "decoder_get_frame";
+                return false;
+            }
+            m.collect(&stats.frames[f % BENCH_RING_SIZE], bitstreams[f % bitstreams.size()].size(), f, opt.warmup);
+            return true;
+        };
+        const uint32_t frames_num = opt.warmup + opt.frames;
+        m.seconds = pipeline.run(frames_num, opt.warmup, opt.in_flight, send, receive);
+        if (m.error == SvtJxsErrorNone && pipeline.received() < frames_num) {
+            m.error = send_error;
+            m.error_stage = "decoder_send_frame";
+        }
+        /*Ring size is multiple of content frames, so after last frames slot i keeps decoded content frame i.*/
+        if (m.error == SvtJxsErrorNone) {
+            const uint32_t content_frames = std::min<uint32_t>(frames_num, (uint32_t)bitstreams.size());
+            const std::vector<svt_jpeg_xs_image_buffer_t*> decoded(images.begin(), images.begin() + content_frames);
+            m.psnr = get_psnr(decoded, &image_config, cfg.content);
+        }
+    }
+
+    for (svt_jpeg_xs_image_buffer_t* image : images) {
+        svt_jpeg_xs_image_buffer_free(image);
+    }
+    svt_jpeg_xs_decoder_close(&dec);
+    return m;
+}
+
+static void print_latency(FILE* out, const char* name, const std::vector<uint64_t>& ns) {
+    const Latency l = get_latency(ns);
+    fprintf(out,
+            "\"%s\": {\"samples\": %u, \"p50\": %.1f, \"p99\": %.1f, \"p999\": %.1f, \"max\": %.1f}",
+            name,
+            (uint32_t)ns.size(),
+            l.p50,
+            l.p99,
+            l.p999,
+            l.max);
+}
+
+static void print_result(FILE* out, bool first, const char* codec, const Options& opt, const Config& cfg, const Measurement& m) {
+    fprintf(out,
+            "%s\n    {\"codec\": \"%s\", \"content\": \"%s\", \"threads\": %u, ",
+            first ? "" : ",",
+            codec,
+            cfg.content.c_str(),
+            cfg.threads);
+    if (strcmp(codec, "decoder")) {
+        fprintf(out, "\"cpu_profile\": %u, ", cfg.cpu_profile);
+    }
+    fprintf(out,
+            "\"slice_height\": %u, \"rc_mode\": %u, \"preset\": %u, \"bpp\": %.4f, ",
+            cfg.slice_height,
+            cfg.rc_mode,
+            cfg.preset,
+            (double)opt.bpp_numerator / opt.bpp_denominator);
+    if (m.error != SvtJxsErrorNone) {
+        fprintf(out, "\"error\": \"%s\", \"error_code\": \"0x%x\"}", m.error_stage, (uint32_t)m.error);
+        return;
+    }
+    const double fps = m.seconds > 0 ? opt.frames / m.seconds : 0;
+    fprintf(out,
+            "\"frames\": %u, \"seconds\": %.6f, \"fps\": %.2f, \"mpixels_per_s\": %.2f, \"bitstream_mbps\": %.2f, "
+            "\"memory_bytes\": %llu,\n     ",
+            opt.frames,
+            m.seconds,
+            fps,
+            fps * opt.width * opt.height / 1e6,
+            m.seconds > 0 ? m.bytes * 8 / m.seconds / 1e6 : 0,
+            (unsigned long long)m.memory_bytes);
+    if (m.psnr >= 0) {
+        fprintf(out, "\"psnr_db\": %.3f, ", m.psnr);
+    }
+    if (m.reference_fps > 0) {
+        fprintf(out, "\"decode_encode_fps\": %.2f, \"speedup\": %.2f, ", m.reference_fps, fps / m.reference_fps);
+    }
+    print_latency(out, "frame_latency_us", m.frame_ns);
+    fprintf(out, ",\n     ");
+    print_latency(out, "slice_latency_us", m.slice_ns);
+    fprintf(out, "}");
+}
+
+/*Transcode sources to transcode bpp. Reference is decoding of sources followed by encoding with transcode bpp,
+ *so its fps is combined from decoder fps and fps of encoder with transcode bpp.*/
+static bool measure_transcode(FILE* out, const Options& opt, const Config& cfg, const std::vector<std::vector<uint8_t>>& sources,
+                              double decoder_fps) {
+    Options target = opt;
+    target.bpp_numerator = opt.transcode_bpp_numerator;
+    target.bpp_denominator = opt.transcode_bpp_denominator;
+    if (decoder_fps <= 0) {
+        const Measurement dec = run_decoder(opt, cfg, sources);
+        decoder_fps = dec.seconds > 0 ? opt.frames / dec.seconds : 0;
+    }
+    const Measurement enc = run_encoder(target, cfg, NULL);
+    print_result(out, false, "encoder", target, cfg, enc);
+    const double encoder_fps = enc.seconds > 0 ? opt.frames / enc.seconds : 0;
+
+    Measurement transcode = run_encoder(target, cfg, NULL, &sources);
+    if (decoder_fps > 0 && encoder_fps > 0) {
+        transcode.reference_fps = 1 / (1 / decoder_fps + 1 / encoder_fps);
+    }
+    print_result(out, false, "transcoder", target, cfg, transcode);
+    fprintf(stderr,
+            "transcode %-8s threads %3u profile %u slice %4u rc %u preset %u: %8.2f fps, decode and encode %8.2f fps\n",
+            cfg.content.c_str(),
+            cfg.threads,
+            cfg.cpu_profile,
+            cfg.slice_height,
+            cfg.rc_mode,
+            cfg.preset,
+            transcode.seconds > 0 ? opt.frames / transcode.seconds : 0,
+            transcode.reference_fps);
+    return enc.error == SvtJxsErrorNone && transcode.error == SvtJxsErrorNone;
+}
+
+static void print_usage(const char* name) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "Lists are comma separated, every combination of lists is measured.\n"
+            "  --width <n> --height <n>    Resolution, default 1920x1080\n"
+            "  --format <name>             yuv400, yuv420, yuv422 or yuv444, default yuv422\n"
+            "  --bit-depth <n>             Input bit depth, default 8\n"
+            "  --bpp <num[/den]>           Bits per pixel, default 3\n"
+            "  --transcode-bpp <num[/den]> Transcode encoded codestreams to this bpp in cpu_profile 0, compare with\n"
+            "                              decode and encode with this bpp, default not measured\n"
+            "  --frames <n>                Measured frames, default 100\n"
+            "  --warmup <n>                Frames sent before measurement, default 10\n"
+            "  --in-flight <n>             Frames sent and not received yet, 1 measures latency without queueing, default %u\n"
+            "  --content <list>            noise, gradient, natural, default natural\n"
+            "  --threads <list>            threads_num of encoder and decoder, default 1 and all CPUs\n"
+            "  --cpu-profile <list>        Encoder cpu_profile, default 0,1\n"
+            "  --slice-height <list>       Slice height, default 16\n"
+            "  --rc <list>                 Rate control mode, default 0\n"
+            "  --preset <list>             Encoder preset, 0 uses --rc and default coding tools, default 0\n"
+            "  --no-decode                 Measure only encoder\n"
+            "  --output <file>             Write JSON to file instead of stdout\n",
+            name,
+            BENCH_RING_SIZE);
+}
+
+static bool parse_list(const char* arg, std::vector<uint32_t>* list) {
+    list->clear();
+    const char* p = arg;
+    while (*p) {
+        char* end = NULL;
+        const unsigned long value = strtoul(p, &end, 10);
+        if (end == p || (*end && *end != ',')) {
+            return false;
+        }
+        list->push_back((uint32_t)value);
+        p = *end ? end + 1 : end;
+    }
+    return !list->empty();
+}
+
+static bool parse_content(const char* arg, std::vector<std::string>* list) {
+    list->clear();
+    std::string s(arg);
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        const size_t comma = std::min(s.find(',', pos), s.size());
+        const std::string name = s.substr(pos, comma - pos);
+        if (name != "noise" && name != "gradient" && name != "natural") {
+            return false;
+        }
+        list->push_back(name);
+        pos = comma + 1;
+    }
+    return !list->empty();
+}
+
+static bool parse_options(int argc, char* argv[], Options* opt) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        bool ok = value != NULL;
+        if (!strcmp(arg, "--no-decode")) {
+            opt->decode = false;
+            continue;
+        }
+        if (!ok) {
+            return false;
+        }
+        i++;
+        if (!strcmp(arg, "--width")) {
+            opt->width = (uint32_t)strtoul(value, NULL, 10);
+        }
+        else if (!strcmp(arg, "--height")) {
+            opt->height = (uint32_t)strtoul(value, NULL, 10);
+        }
+        else if (!strcmp(arg, "--bit-depth")) {
+            opt->bit_depth = (uint8_t)strtoul(value, NULL, 10);
+        }
+        else if (!strcmp(arg, "--bpp")) {
+            char* end = NULL;
+            opt->bpp_numerator = (uint32_t)strtoul(value, &end, 10);
+            opt->bpp_denominator = *end == '/' ? (uint32_t)strtoul(end + 1, NULL, 10) : 1;
+        }
+        else if (!strcmp(arg, "--transcode-bpp")) {
+            char* end = NULL;
+            opt->transcode_bpp_numerator = (uint32_t)strtoul(value, &end, 10);
+            opt->transcode_bpp_denominator = *end == '/' ? (uint32_t)strtoul(end + 1, NULL, 10) : 1;
+            ok = opt->transcode_bpp_numerator && opt->transcode_bpp_denominator;
+        }
+        else if (!strcmp(arg, "--frames")) {
+            opt->frames = (uint32_t)strtoul(value, NULL, 10);
+        }
+        else if (!strcmp(arg, "--warmup")) {
+            opt->warmup = (uint32_t)strtoul(value, NULL, 10);
+        }
+        else if (!strcmp(arg, "--in-flight")) {
+            opt->in_flight = (uint32_t)strtoul(value, NULL, 10);
+            ok = opt->in_flight >= 1 && opt->in_flight <= BENCH_RING_SIZE;
+        }
+        else if (!strcmp(arg, "--format")) {
+            ok = false;
+            for (const FormatName& f : formats) {
+                if (!strcmp(value, f.name)) {
+                    opt->format = f.format;
+                    ok = true;
+                }
+            }
+        }
+        else if (!strcmp(arg, "--content")) {
+            ok = parse_content(value, &opt->contents);
+        }
+        else if (!strcmp(arg, "--threads")) {
+            ok = parse_list(value, &opt->threads);
+        }
+        else if (!strcmp(arg, "--cpu-profile")) {
+            ok = parse_list(value, &opt->cpu_profiles);
+        }
+        else if (!strcmp(arg, "--slice-height")) {
+            ok = parse_list(value, &opt->slice_heights);
+        }
+        else if (!strcmp(arg, "--rc")) {
+            ok = parse_list(value, &opt->rc_modes);
+        }
+        else if (!strcmp(arg, "--preset")) {
+            ok = parse_list(value, &opt->presets);
+        }
+        else if (!strcmp(arg, "--output")) {
+            opt->output = value;
+        }
+        else {
+            ok = false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return opt->width && opt->height && opt->frames && opt->bpp_denominator;
+}
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    if (!parse_options(argc, argv, &opt)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (opt.contents.empty()) {
+        opt.contents.push_back("natural");
+    }
+    if (opt.threads.empty()) {
+        const uint32_t cpus = std::max(1u, (uint32_t)std::thread::hardware_concurrency());
+        opt.threads.push_back(1);
+        if (cpus > 1) {
+            opt.threads.push_back(cpus);
+        }
+    }
+    if (opt.cpu_profiles.empty()) {
+        opt.cpu_profiles.push_back(0);
+        opt.cpu_profiles.push_back(1);
+    }
+    if (opt.slice_heights.empty()) {
+        opt.slice_heights.push_back(16);
+    }
+    if (opt.rc_modes.empty()) {
+        opt.rc_modes.push_back(0);
+    }
+    if (opt.presets.empty()) {
+        opt.presets.push_back(0);
+    }
+
+    FILE* out = opt.output ? fopen(opt.output, "w") : stdout;
+    if (out == NULL) {
+        fprintf(stderr, "Can not open output file %s\n", opt.output);
+        return 1;
+    }
+    const char* format_name = "";
+    for (const FormatName& f : formats) {
+        format_name = f.format == opt.format ? f.name : format_name;
+    }
+    fprintf(out,
+            "{\n  \"width\": %u, \"height\": %u, \"format\": \"%s\", \"bit_depth\": %u, \"bpp\": %.4f, \"warmup\": %u,\n"
+            "  \"in_flight\": %u, \"results\": [",
+            opt.width,
+            opt.height,
+            format_name,
+            opt.bit_depth,
+            (double)opt.bpp_numerator / opt.bpp_denominator,
+            opt.warmup,
+            opt.in_flight);
+
+    bool first = true;
+    int failed = 0;
+    for (const std::string& content : opt.contents) {
+        for (uint32_t threads : opt.threads) {
+            for (uint32_t slice_height : opt.slice_heights) {
+                for (uint32_t rc_mode : opt.rc_modes) {
+                    for (uint32_t preset : opt.presets) {
+                        double decoder_fps = 0;
+                        for (size_t p = 0; p < opt.cpu_profiles.size(); p++) {
+                            const Config cfg = {content, threads, opt.cpu_profiles[p], slice_height, rc_mode, preset};
+                            std::vector<std::vector<uint8_t>> bitstreams;
+                            const Measurement enc = run_encoder(opt, cfg, &bitstreams);
+                            print_result(out, first, "encoder", opt, cfg, enc);
+                            first = false;
+                            failed |= enc.error != SvtJxsErrorNone;
+                            fprintf(stderr,
+                                    "encoder %-8s threads %3u profile %u slice %4u rc %u preset %u: %8.2f fps\n",
+                                    content.c_str(),
+                                    threads,
+                                    cfg.cpu_profile,
+                                    slice_height,
+                                    rc_mode,
+                                    preset,
+                                    enc.seconds > 0 ? opt.frames / enc.seconds : 0);
+
+                            /*Bitstream does not depend on encoder cpu_profile, decode it once.*/
+                            if (opt.decode && p == 0 && !bitstreams.empty()) {
+                                const Measurement dec = run_decoder(opt, cfg, bitstreams);
+                                print_result(out, false, "decoder", opt, cfg, dec);
+                                failed |= dec.error != SvtJxsErrorNone;
+                                decoder_fps = dec.seconds > 0 ? opt.frames / dec.seconds : 0;
+                                fprintf(stderr,
+                                        "decoder %-8s threads %3u           slice %4u rc %u preset %u: %8.2f fps, %.2f dB\n",
+                                        content.c_str(),
+                                        threads,
+                                        slice_height,
+                                        rc_mode,
+                                        preset,
+                                        dec.seconds > 0 ? opt.frames / dec.seconds : 0,
+                                        dec.psnr);
+                            }
+
+                            /*Transcode works only in cpu_profile 0, codestreams of other profiles are the same.*/
+                            if (opt.transcode_bpp_numerator && cfg.cpu_profile == 0 && !bitstreams.empty()) {
+                                failed |= !measure_transcode(out, opt, cfg, bitstreams, decoder_fps);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    fprintf(out, "\n  ]\n}\n");
+    if (opt.output) {
+        fclose(out);
+    }
+    return failed;
+}
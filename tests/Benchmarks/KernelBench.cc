@@ -0,0 +1,531 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/*
+ * Micro-benchmark of kernels dispatched by RTCD.
+ * Every kernel is run with dispatch table resolved for each ISA level available on CPU,
+ * level is reported only when it selects different implementation than lower level.
+ * Results are written as JSON (ns per call, ns per sample and GB/s of accessed memory).
+ *
+ * Usage: SvtJpegxsKernelBench [--filter <substring>] [--width <samples>]... [--min-time-ms <ms>] [--output <file.json>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "common_dsp_rtcd.h"
+#include "encoder_dsp_rtcd.h"
+#include "decoder_dsp_rtcd.h"
+#include "BitstreamWriter.h"
+#include "BitstreamReader.h"
+#include "Pi.h"
+
+#define BENCH_REPEATS          (5)
+#define BENCH_MAX_ITERATIONS   (1u << 30)
+#define BENCH_LINES            (6)  /*Input lines of vertical transforms*/
+#define BENCH_FRAME_LINES      (16) /*Lines of frame level output scaling*/
+#define BENCH_BW               (20) /*Bw: nominal bit precision of wavelet coefficients*/
+#define BENCH_FQ               (8)  /*Fq: fractional bits of wavelet coefficients*/
+#define BENCH_GTLI             (3)
+#define BENCH_DEFAULT_MIN_TIME (200)
+
+struct IsaLevel {
+    const char* name;
+    CPU_FLAGS flags;
+    CPU_FLAGS required; /*Level is skipped when CPU does not support this flag*/
+};
+
+static const IsaLevel isa_levels[] = {
+    {"c", 0, 0},
+#ifdef ARCH_X86_64
+    {"sse4_1", (CPU_FLAGS_SSE4_2 << 1) - 1, CPU_FLAGS_SSE4_1},
+    {"avx2", (CPU_FLAGS_AVX2 << 1) - 1, CPU_FLAGS_AVX2},
+    {"avx512", CPU_FLAGS_ALL, CPU_FLAGS_AVX512F},
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    {"neon", CPU_FLAGS_ALL, CPU_FLAGS_NEON},
+#endif
+};
+
+struct Tables {
+    common_rtcd_t common;
+    encoder_rtcd_t enc;
+    decoder_rtcd_t dec;
+};
+
+template <typename T>
+class AlignedBuffer {
+  public:
+    explicit AlignedBuffer(size_t count) : raw_(count * sizeof(T) + 64) {
+        uintptr_t p = (uintptr_t)raw_.data();
+        ptr_ = (T*)((p + 63) & ~(uintptr_t)63);
+    }
+    T* get() const {
+        return ptr_;
+    }
+
+  private:
+    std::vector<uint8_t> raw_;
+    T* ptr_;
+};
+
+/*Buffers are allocated once for biggest width, content is generated with fixed seed.*/
+struct BenchContext {
+    explicit BenchContext(uint32_t max_width)
+        : lines(max_width * (BENCH_LINES + 4)),
+          frame32(max_width * BENCH_FRAME_LINES),
+          coeff16(max_width),
+          out16(max_width * BENCH_FRAME_LINES),
+          in16(max_width * 2),
+          src8(max_width * 3),
+          dst8(max_width * BENCH_FRAME_LINES),
+          src16(max_width * 3),
+          gcli(max_width),
+          gcli_top(max_width),
+          significance(max_width),
+          vpred_bits(max_width),
+          vpred_significance(max_width),
+          bitstream(max_width * 4 + 64),
+          bitstream_random(max_width * 4 + 64),
+          width(0),
+          sink(0) {
+        uint32_t state = 12345;
+        const uint32_t lines_size = max_width * (BENCH_LINES + 4);
+        for (uint32_t i = 0; i < lines_size; i++) {
+            lines.get()[i] = (int32_t)(next(&state) % (1 << BENCH_BW)) - (1 << (BENCH_BW - 1));
+        }
+        for (uint32_t i = 0; i < max_width * BENCH_FRAME_LINES; i++) {
+            frame32.get()[i] = (int32_t)(next(&state) % (1 << BENCH_BW)) - (1 << (BENCH_BW - 1));
+        }
+        for (uint32_t i = 0; i < max_width; i++) {
+            /*Sign and magnitude, magnitude limited to 14 bits like after image_shift()*/
+            coeff16.get()[i] = (uint16_t)((next(&state) & 0x3fff) | ((next(&state) & 1) << 15));
+            gcli.get()[i] = (uint8_t)(next(&state) % 15);
+            gcli_top.get()[i] = (uint8_t)(next(&state) % 15);
+        }
+        for (uint32_t i = 0; i < max_width * 2; i++) {
+            in16.get()[i] = (int16_t)((int32_t)(next(&state) % (1 << 14)) - (1 << 13));
+        }
+        for (uint32_t i = 0; i < max_width * 3; i++) {
+            src8.get()[i] = (uint8_t)next(&state);
+            src16.get()[i] = (uint16_t)(next(&state) & 0x3ff);
+        }
+        for (uint32_t i = 0; i < max_width * 4 + 64; i++) {
+            bitstream_random.get()[i] = (uint8_t)next(&state);
+        }
+        memset(&pi, 0, sizeof(pi));
+    }
+
+    static uint32_t next(uint32_t* state) {
+        *state = *state * 1103515245u + 12345u;
+        return *state >> 8;
+    }
+
+    int32_t* line(uint32_t idx) const {
+        return lines.get() + idx * width;
+    }
+
+    AlignedBuffer<int32_t> lines;
+    AlignedBuffer<int32_t> frame32;
+    AlignedBuffer<uint16_t> coeff16;
+    AlignedBuffer<uint16_t> out16;
+    AlignedBuffer<int16_t> in16;
+    AlignedBuffer<uint8_t> src8;
+    AlignedBuffer<uint8_t> dst8;
+    AlignedBuffer<uint16_t> src16;
+    AlignedBuffer<uint8_t> gcli;
+    AlignedBuffer<uint8_t> gcli_top;
+    AlignedBuffer<uint8_t> significance;
+    AlignedBuffer<uint8_t> vpred_bits;
+    AlignedBuffer<uint8_t> vpred_significance;
+    AlignedBuffer<uint8_t> bitstream;
+    AlignedBuffer<uint8_t> bitstream_random;
+    pi_t pi;
+    uint32_t width;
+    volatile uint32_t sink; /*Keep results of kernels without output buffer*/
+};
+
+typedef const void* (*get_kernel_fn)(const Tables& t);
+typedef void (*run_kernel_fn)(const Tables& t, BenchContext& c);
+
+struct Kernel {
+    const char* name;
+    const char* module;
+    get_kernel_fn get;
+    run_kernel_fn run;
+    uint32_t lines;            /*Lines of width samples processed per call*/
+    uint32_t bytes_per_sample; /*Bytes read and written per processed sample*/
+};
+
+#define KERNEL(module, table, name, lines_num, bytes, ...)       \
+    {                                                            \
+        #name, module, [](const Tables& t) -> const void* {      \
+            return (const void*)t.table.name;                    \
+        },                                                       \
+            [](const Tables& t, BenchContext& c) { __VA_ARGS__ }, \
+            lines_num, bytes                                     \
+    }
+
+static const Kernel kernels[] = {
+    KERNEL("common", common, svt_log2_32, 1, 4, {
+        uint32_t acc = 0;
+        for (uint32_t i = 0; i < c.width; i++) {
+            acc += t.common.svt_log2_32((uint32_t)c.lines.get()[i] | 1);
+        }
+        c.sink = acc;
+    }),
+
+    /*Encoder*/
+    KERNEL("encoder", enc, linear_input_scaling_line_8bit, 1, 5, {
+        t.enc.linear_input_scaling_line_8bit(c.src8.get(), c.line(0), c.width, BENCH_BW - 8, 1 << (BENCH_BW - 1));
+    }),
+    KERNEL("encoder", enc, linear_input_scaling_line_16bit, 1, 6, {
+        t.enc.linear_input_scaling_line_16bit(c.src16.get(), c.line(0), c.width, BENCH_BW - 10, 1 << (BENCH_BW - 1), 10);
+    }),
+    KERNEL("encoder", enc, convert_packed_to_planar_rgb_8bit, 1, 6, {
+        uint8_t* out = c.dst8.get();
+        t.enc.convert_packed_to_planar_rgb_8bit(c.src8.get(), out, out + c.width, out + 2 * c.width, c.width);
+    }),
+    KERNEL("encoder", enc, convert_packed_to_planar_rgb_16bit, 1, 12, {
+        uint16_t* out = c.out16.get();
+        t.enc.convert_packed_to_planar_rgb_16bit(c.src16.get(), out, out + c.width, out + 2 * c.width, c.width);
+    }),
+    KERNEL("encoder", enc, dwt_horizontal_line, 1, 8, {
+        t.enc.dwt_horizontal_line(c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(0), c.width);
+    }),
+    KERNEL("encoder", enc, transform_V1_Hx_precinct_recalc_HF_prev, 1, 16, {
+        t.enc.transform_V1_Hx_precinct_recalc_HF_prev(c.width, c.line(BENCH_LINES), c.line(0), c.line(1), c.line(2));
+    }),
+    KERNEL("encoder", enc, transform_vertical_loop_hf_line_0, 1, 12, {
+        t.enc.transform_vertical_loop_hf_line_0(c.width, c.line(BENCH_LINES), c.line(0), c.line(1));
+    }),
+    KERNEL("encoder", enc, transform_vertical_loop_lf_line_0, 1, 12, {
+        t.enc.transform_vertical_loop_lf_line_0(c.width, c.line(BENCH_LINES), c.line(1), c.line(0));
+    }),
+    KERNEL("encoder", enc, transform_vertical_loop_lf_hf_line_0, 1, 20, {
+        t.enc.transform_vertical_loop_lf_hf_line_0(c.width, c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(0), c.line(1),
+                                                   c.line(2));
+    }),
+    KERNEL("encoder", enc, transform_vertical_loop_lf_hf_line_x_prev, 1, 28, {
+        t.enc.transform_vertical_loop_lf_hf_line_x_prev(c.width,
+                                                        c.line(BENCH_LINES),
+                                                        c.line(BENCH_LINES + 1),
+                                                        c.line(0),
+                                                        c.line(1),
+                                                        c.line(2),
+                                                        c.line(3),
+                                                        c.line(4));
+    }),
+    KERNEL("encoder", enc, transform_vertical_loop_lf_hf_hf_line_x, 1, 24, {
+        t.enc.transform_vertical_loop_lf_hf_hf_line_x(
+            c.width, c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(3), c.line(0), c.line(1), c.line(2));
+    }),
+    KERNEL("encoder", enc, transform_vertical_loop_lf_hf_hf_line_last_even, 1, 20, {
+        t.enc.transform_vertical_loop_lf_hf_hf_line_last_even(
+            c.width, c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(2), c.line(0), c.line(1));
+    }),
+    KERNEL("encoder", enc, image_shift, 1, 6, {
+        /*Output of other kernels is used as input, so input stays in range of wavelet coefficients.*/
+        t.enc.image_shift(c.out16.get(), c.line(0), c.width, BENCH_FQ, 1 << (BENCH_FQ - 1));
+    }),
+    KERNEL("encoder", enc, dwt_horizontal_line_input_8bit, 1, 9, {
+        t.enc.dwt_horizontal_line_input_8bit(
+            c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.src8.get(), c.width, BENCH_BW - 8, 1 << (BENCH_BW - 1));
+    }),
+    KERNEL("encoder", enc, dwt_horizontal_line_input_16bit, 1, 10, {
+        t.enc.dwt_horizontal_line_input_16bit(
+            c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.src16.get(), c.width, BENCH_BW - 10, 1 << (BENCH_BW - 1), 10);
+    }),
+    KERNEL("encoder", enc, dwt_horizontal_line_int16_input_8bit, 1, 3, {
+        int16_t* out = (int16_t*)c.out16.get();
+        t.enc.dwt_horizontal_line_int16_input_8bit(
+            out, out + c.width, c.src8.get(), c.width, BENCH_BW - 8 - BENCH_FQ, 1 << (BENCH_BW - 1 - BENCH_FQ));
+    }),
+    KERNEL("encoder", enc, dwt_horizontal_line_int16_input_16bit, 1, 4, {
+        int16_t* out = (int16_t*)c.out16.get();
+        t.enc.dwt_horizontal_line_int16_input_16bit(out,
+                                                    out + c.width,
+                                                    c.src16.get(),
+                                                    c.width,
+                                                    BENCH_BW - 10 - (BENCH_FQ - 1),
+                                                    1 << (BENCH_BW - 1 - (BENCH_FQ - 1)),
+                                                    10);
+    }),
+    KERNEL("encoder", enc, image_shift_int16, 1, 4, {
+        t.enc.image_shift_int16(c.out16.get(), c.in16.get(), c.width, 1, 1);
+    }),
+    KERNEL("encoder", enc, gc_precinct_stage_scalar, 1, 3, {
+        t.enc.gc_precinct_stage_scalar(c.significance.get(), c.coeff16.get(), GROUP_SIZE, c.width);
+    }),
+    KERNEL("encoder", enc, gc_precinct_stage_scalar_loop, 1, 3, {
+        t.enc.gc_precinct_stage_scalar_loop(c.width / GROUP_SIZE, c.coeff16.get(), c.significance.get());
+    }),
+    KERNEL("encoder", enc, gc_precinct_sigflags_max, 1, 1, {
+        t.enc.gc_precinct_sigflags_max(
+            c.significance.get(), c.gcli.get(), SIGNIFICANCE_GROUP_SIZE, (c.width + GROUP_SIZE - 1) / GROUP_SIZE);
+    }),
+    KERNEL("encoder", enc, rate_control_calc_vpred_cost_nosigf, 1, 1, {
+        c.sink = t.enc.rate_control_calc_vpred_cost_nosigf((c.width + GROUP_SIZE - 1) / GROUP_SIZE,
+                                                           c.gcli_top.get(),
+                                                           c.gcli.get(),
+                                                           c.vpred_bits.get(),
+                                                           BENCH_GTLI,
+                                                           BENCH_GTLI + 1);
+    }),
+    KERNEL("encoder", enc, rate_control_calc_vpred_cost_sigf_nosigf, 1, 1, {
+        const uint32_t gcli_width = (c.width + GROUP_SIZE - 1) / GROUP_SIZE;
+        uint32_t sigf_reduction = 0;
+        uint32_t no_sigf = 0;
+        t.enc.rate_control_calc_vpred_cost_sigf_nosigf((gcli_width + SIGNIFICANCE_GROUP_SIZE - 1) / SIGNIFICANCE_GROUP_SIZE,
+                                                       gcli_width,
+                                                       0,
+                                                       SIGNIFICANCE_GROUP_SIZE,
+                                                       c.gcli_top.get(),
+                                                       c.gcli.get(),
+                                                       c.vpred_bits.get(),
+                                                       c.vpred_significance.get(),
+                                                       BENCH_GTLI,
+                                                       BENCH_GTLI + 1,
+                                                       &sigf_reduction,
+                                                       &no_sigf);
+        c.sink = sigf_reduction + no_sigf;
+    }),
+    KERNEL("encoder", enc, quantization, 1, 4, {
+        /*In place, quantized coefficients stay valid input for next call.*/
+        t.enc.quantization(c.coeff16.get(), c.width, c.gcli.get(), GROUP_SIZE, BENCH_GTLI, QUANT_TYPE_UNIFORM);
+    }),
+    KERNEL("encoder", enc, pack_data_single_group, 1, 4, {
+        bitstream_writer_t bitstream;
+        bitstream_writer_init(&bitstream, c.bitstream.get(), c.width * 4 + 64);
+        for (uint32_t g = 0; g < c.width / GROUP_SIZE; g++) {
+            t.enc.pack_data_single_group(&bitstream, c.coeff16.get() + g * GROUP_SIZE, c.gcli.get()[g], BENCH_GTLI);
+        }
+    }),
+
+    /*Decoder*/
+    KERNEL("decoder", dec, unpack_data, 1, 3, {
+        bitstream_reader_t bitstream;
+        bitstream_reader_init(&bitstream, c.bitstream_random.get(), c.width * 4 + 64);
+        int32_t bits_left = (int32_t)bitstream_reader_get_left_bits(&bitstream);
+        uint8_t leftover_signs_num = 0;
+        c.sink = (uint32_t)t.dec.unpack_data(
+            &bitstream, c.out16.get(), c.width, c.gcli.get(), GROUP_SIZE, BENCH_GTLI, 0, &leftover_signs_num, &bits_left);
+    }),
+    KERNEL("decoder", dec, dequant, 1, 4, {
+        t.dec.dequant(c.coeff16.get(), c.width, c.gcli.get(), GROUP_SIZE, BENCH_GTLI, QUANT_TYPE_UNIFORM);
+    }),
+    KERNEL("decoder", dec, inv_sign, 1, 4, { t.dec.inv_sign(c.out16.get(), c.width); }),
+    KERNEL("decoder", dec, idwt_horizontal_line_lf16_hf16, 1, 6, {
+        t.dec.idwt_horizontal_line_lf16_hf16(c.in16.get(), c.in16.get() + c.width, c.line(BENCH_LINES), c.width, BENCH_FQ);
+    }),
+    KERNEL("decoder", dec, idwt_horizontal_line_lf32_hf16, 1, 7, {
+        t.dec.idwt_horizontal_line_lf32_hf16(c.line(0), c.in16.get(), c.line(BENCH_LINES), c.width, BENCH_FQ);
+    }),
+    KERNEL("decoder", dec, idwt_vertical_line, 1, 28, {
+        int32_t* out[4] = {c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(BENCH_LINES + 2), c.line(BENCH_LINES + 3)};
+        t.dec.idwt_vertical_line(c.line(0), c.line(1), c.line(2), out, c.width, 0, 0, 64);
+    }),
+    KERNEL("decoder", dec, idwt_vertical_line_recalc, 1, 16, {
+        int32_t* out[4] = {c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(BENCH_LINES + 2), c.line(BENCH_LINES + 3)};
+        t.dec.idwt_vertical_line_recalc(c.line(0), c.line(1), c.line(2), out, c.width, 2);
+    }),
+    KERNEL("decoder", dec, linear_output_scaling_8bit_line, 1, 5, {
+        t.dec.linear_output_scaling_8bit_line(c.line(0), BENCH_BW, 8, c.dst8.get(), c.width);
+    }),
+    KERNEL("decoder", dec, linear_output_scaling_16bit_line, 1, 6, {
+        t.dec.linear_output_scaling_16bit_line(c.line(0), BENCH_BW, 10, c.out16.get(), c.width);
+    }),
+    KERNEL("decoder", dec, idwt_horizontal_line_lf32_hf16_output_8bit, 1, 4, {
+        t.dec.idwt_horizontal_line_lf32_hf16_output_8bit(c.line(0), c.in16.get(), c.dst8.get(), c.width, BENCH_FQ, BENCH_BW, 8);
+    }),
+    KERNEL("decoder", dec, idwt_horizontal_line_lf32_hf16_output_16bit, 1, 5, {
+        t.dec.idwt_horizontal_line_lf32_hf16_output_16bit(c.line(0), c.in16.get(), c.out16.get(), c.width, BENCH_FQ, BENCH_BW, 10);
+    }),
+    KERNEL("decoder", dec, idwt_vertical_line_output_8bit, 1, 22, {
+        int32_t* out[4] = {c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(BENCH_LINES + 2), c.line(BENCH_LINES + 3)};
+        t.dec.idwt_vertical_line_output_8bit(
+            c.line(0), c.line(1), c.line(2), out, c.dst8.get(), c.dst8.get() + c.width, c.width, BENCH_BW, 8);
+    }),
+    KERNEL("decoder", dec, idwt_vertical_line_output_16bit, 1, 24, {
+        int32_t* out[4] = {c.line(BENCH_LINES), c.line(BENCH_LINES + 1), c.line(BENCH_LINES + 2), c.line(BENCH_LINES + 3)};
+        t.dec.idwt_vertical_line_output_16bit(
+            c.line(0), c.line(1), c.line(2), out, c.out16.get(), c.out16.get() + c.width, c.width, BENCH_BW, 10);
+    }),
+    KERNEL("decoder", dec, linear_output_scaling_8bit, BENCH_FRAME_LINES, 5, {
+        int32_t* comps[MAX_COMPONENTS_NUM] = {c.frame32.get(), NULL, NULL, NULL};
+        svt_jpeg_xs_image_buffer_t image;
+        memset(&image, 0, sizeof(image));
+        image.data_yuv[0] = c.dst8.get();
+        image.stride[0] = c.width;
+        image.alloc_size[0] = c.width * BENCH_FRAME_LINES;
+        t.dec.linear_output_scaling_8bit(&c.pi, comps, BENCH_BW, 8, &image);
+    }),
+    KERNEL("decoder", dec, linear_output_scaling_16bit, BENCH_FRAME_LINES, 6, {
+        int32_t* comps[MAX_COMPONENTS_NUM] = {c.frame32.get(), NULL, NULL, NULL};
+        svt_jpeg_xs_image_buffer_t image;
+        memset(&image, 0, sizeof(image));
+        image.data_yuv[0] = c.out16.get();
+        image.stride[0] = c.width;
+        image.alloc_size[0] = c.width * BENCH_FRAME_LINES * sizeof(uint16_t);
+        t.dec.linear_output_scaling_16bit(&c.pi, comps, BENCH_BW, 10, &image);
+    }),
+};
+
+static uint64_t time_batch(const Kernel& kernel, const Tables& t, BenchContext& c, uint64_t iterations) {
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+        kernel.run(t, c);
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+/*Number of iterations is doubled until batch takes min_time_ns / BENCH_REPEATS, the fastest batch is reported.*/
+static double measure_ns_per_call(const Kernel& kernel, const Tables& t, BenchContext& c, uint64_t min_time_ns) {
+    kernel.run(t, c); /*Warm up caches*/
+    const uint64_t batch_time_ns = min_time_ns / BENCH_REPEATS;
+    uint64_t iterations = 1;
+    uint64_t time_ns = time_batch(kernel, t, c, iterations);
+    while (time_ns < batch_time_ns && iterations < BENCH_MAX_ITERATIONS) {
+        iterations *= 2;
+        time_ns = time_batch(kernel, t, c, iterations);
+    }
+    double best = (double)time_ns / (double)iterations;
+    for (uint32_t r = 1; r < BENCH_REPEATS; r++) {
+        const double ns = (double)time_batch(kernel, t, c, iterations) / (double)iterations;
+        if (ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+static void print_usage(const char* name) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --filter <substring>  Run only kernels with name containing substring\n"
+            "  --width <samples>     Line width, can be repeated, default 256 1920 3840\n"
+            "  --min-time-ms <ms>    Measure time per kernel, ISA and width, default %u\n"
+            "  --output <file>       Write JSON to file instead of stdout\n",
+            name,
+            BENCH_DEFAULT_MIN_TIME);
+}
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    std::vector<uint32_t> widths;
+    uint64_t min_time_ms = BENCH_DEFAULT_MIN_TIME;
+    const char* output_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        const bool has_value = i + 1 < argc;
+        if (!strcmp(argv[i], "--filter") && has_value) {
+            filter = argv[++i];
+        }
+        else if (!strcmp(argv[i], "--width") && has_value) {
+            const uint32_t width = (uint32_t)strtoul(argv[++i], NULL, 10);
+            if (width < 16) {
+                fprintf(stderr, "Width have to be at least 16\n");
+                return 1;
+            }
+            widths.push_back(width);
+        }
+        else if (!strcmp(argv[i], "--min-time-ms") && has_value) {
+            min_time_ms = strtoull(argv[++i], NULL, 10);
+        }
+        else if (!strcmp(argv[i], "--output") && has_value) {
+            output_path = argv[++i];
+        }
+        else {
+            print_usage(argv[0]);
+            return !strcmp(argv[i], "--help") ? 0 : 1;
+        }
+    }
+    if (widths.empty()) {
+        widths.push_back(256);
+        widths.push_back(1920);
+        widths.push_back(3840);
+    }
+    uint32_t max_width = 0;
+    for (uint32_t width : widths) {
+        max_width = width > max_width ? width : max_width;
+    }
+
+    FILE* out = output_path ? fopen(output_path, "w") : stdout;
+    if (out == NULL) {
+        fprintf(stderr, "Can not open output file %s\n", output_path);
+        return 1;
+    }
+
+    const CPU_FLAGS cpu_flags = get_cpu_flags();
+    const size_t levels_num = sizeof(isa_levels) / sizeof(isa_levels[0]);
+    std::vector<Tables> tables(levels_num);
+    for (size_t l = 0; l < levels_num; l++) {
+        setup_common_rtcd(&tables[l].common, isa_levels[l].flags);
+        setup_encoder_rtcd(&tables[l].enc, isa_levels[l].flags);
+        setup_decoder_rtcd(&tables[l].dec, isa_levels[l].flags);
+    }
+
+    BenchContext context(max_width);
+    fprintf(out, "{\n  \"cpu_flags\": \"0x%llx\",\n  \"min_time_ms\": %llu,\n  \"results\": [", (unsigned long long)cpu_flags,
+            (unsigned long long)min_time_ms);
+    bool first = true;
+    for (const Kernel& kernel : kernels) {
+        if (!filter.empty() && std::string(kernel.name).find(filter) == std::string::npos) {
+            continue;
+        }
+        std::vector<const void*> measured;
+        for (size_t l = 0; l < levels_num; l++) {
+            const IsaLevel& level = isa_levels[l];
+            const void* fn = kernel.get(tables[l]);
+            if ((level.required & cpu_flags) != level.required) {
+                continue;
+            }
+            bool same = false;
+            for (const void* prev : measured) {
+                same = same || prev == fn;
+            }
+            if (same) {
+                continue;
+            }
+            measured.push_back(fn);
+            /*Kernels call other kernels by thread pointers, bind tables of that same level.*/
+            bind_common_rtcd(&tables[l].common);
+            bind_encoder_rtcd(&tables[l].enc);
+            bind_decoder_rtcd(&tables[l].dec);
+            for (uint32_t width : widths) {
+                context.width = width;
+                context.pi.comps_num = 1;
+                context.pi.components[0].width = width;
+                context.pi.components[0].height = BENCH_FRAME_LINES;
+                const double ns_per_call = measure_ns_per_call(kernel, tables[l], context, min_time_ms * 1000000);
+                const double samples = (double)width * kernel.lines;
+                const double ns_per_sample = ns_per_call / samples;
+                const double gb_per_s = ns_per_call > 0 ? kernel.bytes_per_sample * samples / ns_per_call : 0;
+                fprintf(out,
+                        "%s\n    {\"kernel\": \"%s\", \"module\": \"%s\", \"isa\": \"%s\", \"width\": %u, \"ns_per_call\": %.3f, "
+                        "\"ns_per_sample\": %.4f, \"gb_per_s\": %.3f}",
+                        first ? "" : ",",
+                        kernel.name,
+                        kernel.module,
+                        level.name,
+                        width,
+                        ns_per_call,
+                        ns_per_sample,
+                        gb_per_s);
+                first = false;
+                fprintf(stderr, "%-48s %-7s %6u %10.4f ns/sample %8.3f GB/s\n", kernel.name, level.name, width, ns_per_sample,
+                        gb_per_s);
+            }
+        }
+    }
+    fprintf(out, "\n  ]\n}\n");
+    if (output_path) {
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include "PipelineTestUtils.h"
+
+void fill_image(svt_jpeg_xs_image_buffer_t* image, uint32_t seed) {
+    uint32_t state = seed * 2654435761u + 1;
+    for (uint32_t c = 0; c < 3; c++) {
+        uint8_t* data = (uint8_t*)image->data_yuv[c];
+        for (uint32_t i = 0; i < image->alloc_size[c]; i++) {
+            state = state * 1103515245u + 12345u;
+            data[i] = (uint8_t)((i * (c + 1) + ((state >> 16) % 32)) & 0xff);
+        }
+    }
+}
+
+void load_test_encoder_config(svt_jpeg_xs_encoder_api_t* enc) {
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_encoder_load_default_parameters(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, enc));
+    enc->source_width = TEST_WIDTH;
+    enc->source_height = TEST_HEIGHT;
+    enc->input_bit_depth = 8;
+    enc->colour_format = COLOUR_FORMAT_PLANAR_YUV422;
+    enc->bpp_numerator = 3;
+    enc->verbose = VERBOSE_NONE;
+}
+
+void load_test_decoder_config(svt_jpeg_xs_decoder_api_t* dec) {
+    memset(dec, 0, sizeof(*dec));
+    dec->use_cpu_flags = CPU_FLAGS_ALL;
+    dec->verbose = VERBOSE_NONE;
+}
+
+TestEncoder::TestEncoder() : bytes_per_frame(0), image(NULL) {
+    memset(&api, 0, sizeof(api));
+    memset(&image_config, 0, sizeof(image_config));
+}
+
+TestEncoder::~TestEncoder() {
+    if (image) {
+        svt_jpeg_xs_image_buffer_free(image);
+    }
+    svt_jpeg_xs_encoder_close(&api);
+}
+
+SvtJxsErrorType_t TestEncoder::init(const EncoderConfigure& configure) {
+    load_test_encoder_config(&api);
+    if (configure) {
+        configure(&api);
+    }
+    SvtJxsErrorType_t ret = svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &api);
+    if (ret != SvtJxsErrorNone) {
+        return ret;
+    }
+    ret = svt_jpeg_xs_encoder_get_image_config(
+        SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &api, &image_config, &bytes_per_frame);
+    if (ret != SvtJxsErrorNone) {
+        return ret;
+    }
+    image = svt_jpeg_xs_image_buffer_alloc(&image_config);
+    if (image == NULL) {
+        return SvtJxsErrorInsufficientResources;
+    }
+    out_buffer.assign(bytes_per_frame, 0);
+    return SvtJxsErrorNone;
+}
+
+svt_jpeg_xs_frame_t TestEncoder::input_frame() {
+    svt_jpeg_xs_frame_t input;
+    memset(&input, 0, sizeof(input));
+    input.image = *image;
+    input.bitstream.buffer = out_buffer.data();
+    input.bitstream.allocation_size = bytes_per_frame;
+    return input;
+}
+
+SvtJxsErrorType_t TestEncoder::encode(svt_jpeg_xs_frame_t* input, Bitstream* bitstream) {
+    SvtJxsErrorType_t ret = svt_jpeg_xs_encoder_send_picture(&api, input, 1);
+    if (ret != SvtJxsErrorNone) {
+        return ret;
+    }
+    svt_jpeg_xs_frame_t output;
+    memset(&output, 0, sizeof(output));
+    ret = svt_jpeg_xs_encoder_get_packet(&api, &output, 1);
+    if (ret == SvtJxsErrorNone && bitstream) {
+        bitstream->assign(output.bitstream.buffer, output.bitstream.buffer + output.bitstream.used_size);
+    }
+    return ret;
+}
+
+void encode_frames(svt_jpeg_xs_thread_pool_t* pool, uint32_t threads_num, uint8_t cpu_profile, std::vector<Bitstream>* bitstreams,
+                   const svt_jpeg_xs_thread_placement_t* placement, uint32_t external_workers,
+                   const EncoderConfigure& configure) {
+    TestEncoder encoder;
+    ASSERT_EQ(SvtJxsErrorNone, encoder.init([&](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->cpu_profile = cpu_profile;
+        enc->threads_num = threads_num;
+        enc->thread_pool = pool;
+        enc->thread_placement = placement;
+        enc->external_tasks = external_workers ? 1 : 0;
+        if (configure) {
+            configure(enc);
+        }
+    }));
+
+    /*Executor threads of application, poll encoder for slice tasks.*/
+    std::atomic<bool> workers_stop(false);
+    std::vector<std::thread> workers;
+    svt_jpeg_xs_encoder_api_t* enc = &encoder.api;
+    for (uint32_t i = 0; i < external_workers; i++) {
+        workers.push_back(std::thread([enc, &workers_stop]() {
+            while (!workers_stop.load()) {
+                svt_jpeg_xs_encoder_task_t* task = NULL;
+                if (svt_jpeg_xs_encoder_get_task(enc, &task) == SvtJxsErrorNone) {
+                    svt_jpeg_xs_encoder_run_task(enc, task);
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    for (uint32_t f = 0; f < TEST_FRAMES_NUM; f++) {
+        fill_image(encoder.image, f);
+        svt_jpeg_xs_frame_t input = encoder.input_frame();
+        Bitstream bitstream;
+        EXPECT_EQ(SvtJxsErrorNone, encoder.encode(&input, &bitstream));
+        bitstreams->push_back(bitstream);
+    }
+
+    workers_stop.store(true);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+static void copy_planes(const svt_jpeg_xs_image_buffer_t* image, uint32_t components_num, std::vector<Bitstream>* images) {
+    Bitstream planes;
+    for (uint32_t c = 0; c < components_num; c++) {
+        const uint8_t* data = (const uint8_t*)image->data_yuv[c];
+        planes.insert(planes.end(), data, data + image->alloc_size[c]);
+    }
+    images->push_back(planes);
+}
+
+void decode_frames(svt_jpeg_xs_thread_pool_t* pool, uint32_t threads_num, const std::vector<Bitstream>& bitstreams,
+                   std::vector<Bitstream>* images, const svt_jpeg_xs_thread_placement_t* placement,
+                   const DecoderConfigure& configure) {
+    ASSERT_FALSE(bitstreams.empty());
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.threads_num = threads_num;
+    dec.thread_pool = pool;
+    dec.thread_placement = placement;
+    if (configure) {
+        configure(&dec);
+    }
+    svt_jpeg_xs_image_config_t image_config;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_init(SVT_JPEGXS_API_VER_MAJOR,
+                                       SVT_JPEGXS_API_VER_MINOR,
+                                       &dec,
+                                       bitstreams[0].data(),
+                                       bitstreams[0].size(),
+                                       &image_config));
+    svt_jpeg_xs_image_buffer_t* image = svt_jpeg_xs_image_buffer_alloc(&image_config);
+    EXPECT_NE(nullptr, image);
+
+    for (size_t i = 0; image && i < bitstreams.size(); i++) {
+        svt_jpeg_xs_frame_t dec_input;
+        memset(&dec_input, 0, sizeof(dec_input));
+        dec_input.image = *image;
+        dec_input.bitstream.buffer = (uint8_t*)bitstreams[i].data();
+        dec_input.bitstream.used_size = (uint32_t)bitstreams[i].size();
+        EXPECT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_send_frame(&dec, &dec_input, 1));
+
+        svt_jpeg_xs_frame_t dec_output;
+        memset(&dec_output, 0, sizeof(dec_output));
+        EXPECT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_frame(&dec, &dec_output, 1));
+        copy_planes(&dec_output.image, image_config.components_num, images);
+    }
+
+    if (image) {
+        svt_jpeg_xs_image_buffer_free(image);
+    }
+    svt_jpeg_xs_decoder_close(&dec);
+}
+
+void decode_frames_sync(svt_jpeg_xs_decoder_api_t* dec, svt_jpeg_xs_image_config_t image_config,
+                        const std::vector<Bitstream>& bitstreams, std::vector<Bitstream>* images) {
+    svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_sync_ctx_create(dec, &sync_ctx));
+    svt_jpeg_xs_image_buffer_t* image = svt_jpeg_xs_image_buffer_alloc(&image_config);
+    EXPECT_NE(nullptr, image);
+
+    for (size_t i = 0; image && i < bitstreams.size(); i++) {
+        svt_jpeg_xs_frame_t frame;
+        memset(&frame, 0, sizeof(frame));
+        frame.image = *image;
+        frame.bitstream.buffer = (uint8_t*)bitstreams[i].data();
+        frame.bitstream.used_size = (uint32_t)bitstreams[i].size();
+        EXPECT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decode_frame_sync(sync_ctx, &frame));
+        copy_planes(&frame.image, image_config.components_num, images);
+    }
+
+    if (image) {
+        svt_jpeg_xs_image_buffer_free(image);
+    }
+    svt_jpeg_xs_decoder_sync_ctx_destroy(sync_ctx);
+}
@@ -0,0 +1,67 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef _PIPELINE_TEST_UTILS_H_
+#define _PIPELINE_TEST_UTILS_H_
+
+#include <stdint.h>
+#include <functional>
+#include <vector>
+#include "SvtJpegxsEnc.h"
+#include "SvtJpegxsDec.h"
+#include "SvtJpegxsImageBufferTools.h"
+
+/*Encoder and decoder API tests run whole pipeline on small frames.*/
+#define TEST_WIDTH      (256)
+#define TEST_HEIGHT     (128)
+#define TEST_FRAMES_NUM (3)
+
+typedef std::vector<uint8_t> Bitstream;
+/*Change test configuration before init, lambdas set only parameters of tested feature.*/
+typedef std::function<void(svt_jpeg_xs_encoder_api_t*)> EncoderConfigure;
+typedef std::function<void(svt_jpeg_xs_decoder_api_t*)> DecoderConfigure;
+
+/*Instances run in parallel, so use local generator instead of rand().*/
+void fill_image(svt_jpeg_xs_image_buffer_t* image, uint32_t seed);
+
+/*Default parameters with TEST_WIDTH x TEST_HEIGHT, planar 422, 8 bits and 3 bpp.*/
+void load_test_encoder_config(svt_jpeg_xs_encoder_api_t* enc);
+void load_test_decoder_config(svt_jpeg_xs_decoder_api_t* dec);
+
+/*Encoder with image and output buffer for frames of its configuration, closed by destructor.*/
+class TestEncoder {
+  public:
+    TestEncoder();
+    ~TestEncoder();
+    /*Load test configuration, change it by configure and init encoder.*/
+    SvtJxsErrorType_t init(const EncoderConfigure& configure = EncoderConfigure());
+    /*Input with image and output buffer of encoder, fields can be changed before encode().*/
+    svt_jpeg_xs_frame_t input_frame();
+    /*Send frame and wait for its codestream, codestream is copied when bitstream is not NULL.*/
+    SvtJxsErrorType_t encode(svt_jpeg_xs_frame_t* input, Bitstream* bitstream);
+
+    svt_jpeg_xs_encoder_api_t api;
+    svt_jpeg_xs_image_config_t image_config;
+    uint32_t bytes_per_frame;
+    svt_jpeg_xs_image_buffer_t* image;
+    Bitstream out_buffer;
+};
+
+/*Encode TEST_FRAMES_NUM frames filled by fill_image(image, frame index).
+ *external_workers - number of application threads that execute tasks of encoder (external_tasks).*/
+void encode_frames(svt_jpeg_xs_thread_pool_t* pool, uint32_t threads_num, uint8_t cpu_profile, std::vector<Bitstream>* bitstreams,
+                   const svt_jpeg_xs_thread_placement_t* placement = NULL, uint32_t external_workers = 0,
+                   const EncoderConfigure& configure = EncoderConfigure());
+
+/*Decode frames with threaded decoder, planes of every image are concatenated.*/
+void decode_frames(svt_jpeg_xs_thread_pool_t* pool, uint32_t threads_num, const std::vector<Bitstream>& bitstreams,
+                   std::vector<Bitstream>* images, const svt_jpeg_xs_thread_placement_t* placement = NULL,
+                   const DecoderConfigure& configure = DecoderConfigure());
+
+/*Decode frames on calling thread with own synchronous context, dec have to be initialized by svt_jpeg_xs_decoder_sync_init().*/
+void decode_frames_sync(svt_jpeg_xs_decoder_api_t* dec, svt_jpeg_xs_image_config_t image_config,
+                        const std::vector<Bitstream>& bitstreams, std::vector<Bitstream>* images);
+
+#endif /*_PIPELINE_TEST_UTILS_H_*/
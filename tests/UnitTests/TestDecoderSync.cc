@@ -0,0 +1,85 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "PipelineTestUtils.h"
+
+TEST(DecoderSync, match_threaded_decoder) {
+    std::vector<Bitstream> bitstreams;
+    std::vector<Bitstream> ref_images;
+    encode_frames(NULL, 4, 0, &bitstreams);
+    decode_frames(NULL, 6, bitstreams, &ref_images);
+
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    svt_jpeg_xs_image_config_t image_config;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                            SVT_JPEGXS_API_VER_MINOR,
+                                            &dec,
+                                            bitstreams[0].data(),
+                                            bitstreams[0].size(),
+                                            &image_config));
+
+    /*Each caller use own context of one decoder.*/
+    const uint32_t callers_num = 2;
+    std::vector<std::vector<Bitstream>> images(callers_num);
+    std::vector<std::thread> callers;
+    for (uint32_t i = 0; i < callers_num; i++) {
+        callers.emplace_back([&, i]() { decode_frames_sync(&dec, image_config, bitstreams, &images[i]); });
+    }
+    for (auto& t : callers) {
+        t.join();
+    }
+    svt_jpeg_xs_decoder_close(&dec);
+
+    for (uint32_t i = 0; i < callers_num; i++) {
+        EXPECT_EQ(ref_images, images[i]);
+    }
+}
+
+TEST(DecoderSync, queue_api_not_supported) {
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 4, 0, &bitstreams);
+
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.packetization_mode = 1;
+    svt_jpeg_xs_image_config_t image_config;
+    EXPECT_EQ(SvtJxsErrorBadParameter,
+              svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                            SVT_JPEGXS_API_VER_MINOR,
+                                            &dec,
+                                            bitstreams[0].data(),
+                                            bitstreams[0].size(),
+                                            &image_config));
+    svt_jpeg_xs_decoder_close(&dec);
+
+    dec.packetization_mode = 0;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                            SVT_JPEGXS_API_VER_MINOR,
+                                            &dec,
+                                            bitstreams[0].data(),
+                                            bitstreams[0].size(),
+                                            &image_config));
+    svt_jpeg_xs_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.bitstream.buffer = bitstreams[0].data();
+    frame.bitstream.used_size = (uint32_t)bitstreams[0].size();
+    EXPECT_EQ(SvtJxsErrorUndefined, svt_jpeg_xs_decoder_send_frame(&dec, &frame, 1));
+    EXPECT_EQ(SvtJxsErrorUndefined, svt_jpeg_xs_decoder_get_frame(&dec, &frame, 0));
+    EXPECT_EQ(SvtJxsErrorUndefined, svt_jpeg_xs_decoder_send_eoc(&dec));
+
+    /*Image buffer is not allocated, so frame is rejected before decoding.*/
+    svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_sync_ctx_create(&dec, &sync_ctx));
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_decode_frame_sync(sync_ctx, &frame));
+    svt_jpeg_xs_decoder_sync_ctx_destroy(sync_ctx);
+    svt_jpeg_xs_decoder_close(&dec);
+}
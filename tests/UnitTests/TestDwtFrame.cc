@@ -293,7 +293,8 @@ class FRAME_DWT : public ::testing::TestWithParam<fixture_param_t> {
         for (int i = 0; i < 1 /*5*/; ++i) {
             set_random_image();
             reference_shift_and_dwt();
-            for (uint8_t convert_input_per_slice = 0; convert_input_per_slice < 2; ++convert_input_per_slice) {
+            /*For V0 convert_input_per_slice == 2 test first horizontal level in 16 bits.*/
+            for (uint8_t convert_input_per_slice = 0; convert_input_per_slice < 2 + !pi.decom_v; ++convert_input_per_slice) {
                 for (uint8_t calculate_separate_precinct = 0; calculate_separate_precinct < (!!pi.decom_v) + 1;
                      ++calculate_separate_precinct) {
                     /*decomp_v == 0 ignore: calculate_separate_precinct*/
@@ -452,6 +453,19 @@ void transform_component_test_V0(const pi_t* pi, const pi_enc_t* pi_enc, uint32_
     transform_V0_ptr_t transform_V0_Hn = transform_V0_get_function_ptr(decom_h);
     ASSERT_TRUE(transform_V0_Hn != NULL);
 
+    dwt_16bit_params_t dwt_16bit;
+    dwt_16bit_params_init(&dwt_16bit, &hdr_dynamic, input_bit_depth);
+    if (convert_input_per_slice == 2) {
+        ASSERT_TRUE(dwt_16bit.enable);
+        if (plane_width < DWT_16BIT_WIDTH_MIN) {
+            /*Encoder use 32 bits for too short lines.*/
+            dwt_16bit.enable = 0;
+        }
+    }
+    else {
+        dwt_16bit.enable = 0;
+    }
+
     for (uint32_t line = 0; line < plane_height; line += 1) {
         /*Add offset to buffers*/
         uint16_t* buffer_out_16bit_offset = buffer_out_16bit + line * pi_enc->coeff_buff_tmp_size_precinct[component_id];
@@ -466,6 +480,18 @@ void transform_component_test_V0(const pi_t* pi, const pi_enc_t* pi_enc, uint32_
         else {
             plane_buffer_in_offset = (int32_t*)(((uint16_t*)plane_buffer_in) + line * plane_stride);
         }
+        if (dwt_16bit.enable) {
+            transform_V0_Hx_16bit(component,
+                                  component_enc,
+                                  plane_buffer_in_offset,
+                                  bit_depth,
+                                  &dwt_16bit,
+                                  buffer_out_16bit_offset,
+                                  param_Fq,
+                                  plane_width,
+                                  buffers_tmp_horizontal);
+            continue;
+        }
         //transform_V0_H1, transform_V0_H2, transform_V0_H3, transform_V0_H4, transform_V0_H5
         transform_V0_Hn(component,
                         component_enc,
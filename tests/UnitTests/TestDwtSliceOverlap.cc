@@ -0,0 +1,29 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Slice boundary DWT state kept by Pack Stage context have to give same bitstream as recalculation by other contexts.*/
+TEST(EncoderSliceOverlap, multithread_match_single_thread) {
+    const EncoderConfigure configs[] = {[](svt_jpeg_xs_encoder_api_t* enc) {
+                                            enc->colour_format = COLOUR_FORMAT_PLANAR_YUV420;
+                                            enc->slice_height = 8;
+                                        },
+                                        [](svt_jpeg_xs_encoder_api_t* enc) { enc->slice_height = 8; }};
+    for (const EncoderConfigure& configure : configs) {
+        std::vector<Bitstream> ref_bitstreams;
+        encode_frames(NULL, 1, 0, &ref_bitstreams, NULL, 0, configure);
+        for (uint32_t threads_num : {2u, 4u, 8u}) {
+            std::vector<Bitstream> bitstreams;
+            encode_frames(NULL, threads_num, 0, &bitstreams, NULL, 0, configure);
+            EXPECT_EQ(ref_bitstreams, bitstreams);
+        }
+        std::vector<Bitstream> bitstreams;
+        encode_frames(NULL, 4, 0, &bitstreams, NULL, 3, configure);
+        EXPECT_EQ(ref_bitstreams, bitstreams);
+    }
+}
@@ -0,0 +1,65 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Preset has to produce that same bitstream as its coding tools set by separate parameters.*/
+TEST(EncoderPreset, match_coding_tools) {
+    std::vector<Bitstream> ref_bitstreams, bitstreams, images;
+    encode_frames(NULL, 2, 0, &ref_bitstreams);
+    encode_frames(NULL, 2, 0, &bitstreams, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) { enc->preset = encoder_preset_fastest; });
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+    /*Parameters ignored by preset.*/
+    bitstreams.clear();
+    encode_frames(NULL, 2, 0, &bitstreams, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->preset = encoder_preset_fastest;
+        enc->rate_control_mode = 3;
+        enc->coding_signs_handling = 2;
+        enc->coding_vertical_prediction_mode = 2;
+    });
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+
+    ref_bitstreams.clear();
+    bitstreams.clear();
+    encode_frames(NULL, 2, 0, &ref_bitstreams, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->rate_control_mode = 1;
+        enc->coding_signs_handling = 2;
+        enc->coding_significance = 1;
+        enc->coding_vertical_prediction_mode = 1;
+    });
+    encode_frames(NULL, 2, 1, &bitstreams, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->preset = encoder_preset_best_quality;
+    });
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+    decode_frames(NULL, 2, bitstreams, &images);
+    EXPECT_EQ(ref_bitstreams.size(), images.size());
+
+    ref_bitstreams.clear();
+    bitstreams.clear();
+    images.clear();
+    encode_frames(NULL, 2, 0, &ref_bitstreams, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->rate_control_mode = 1;
+        enc->coding_signs_handling = 0;
+        enc->coding_significance = 1;
+        enc->coding_vertical_prediction_mode = 1;
+    });
+    encode_frames(NULL, 2, 0, &bitstreams, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->preset = encoder_preset_balanced;
+    });
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+    decode_frames(NULL, 2, bitstreams, &images);
+    EXPECT_EQ(ref_bitstreams.size(), images.size());
+}
+
+TEST(EncoderPreset, invalid_preset) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    EXPECT_EQ(encoder_preset_custom, enc.preset);
+    enc.preset = encoder_preset_max;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+}
@@ -0,0 +1,43 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <vector>
+#include "PipelineTestUtils.h"
+
+class EncoderTasks : public ::testing::TestWithParam<uint8_t> {};
+
+TEST_P(EncoderTasks, external_tasks_match_own_threads) {
+    const uint8_t cpu_profile = GetParam();
+    std::vector<Bitstream> ref_bitstreams, bitstreams;
+    encode_frames(NULL, 4, cpu_profile, &ref_bitstreams);
+    encode_frames(NULL, 4, cpu_profile, &bitstreams, NULL, 3);
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+    /*More caller threads than Pack Stage contexts, callers wait for free context.*/
+    bitstreams.clear();
+    encode_frames(NULL, 1, cpu_profile, &bitstreams, NULL, 4);
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, EncoderTasks, ::testing::Values(0, 1));
+
+TEST(EncoderTasks, invalid_configuration) {
+    svt_jpeg_xs_thread_pool_t* pool = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_thread_pool_create(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &pool, 2));
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.thread_pool = pool;
+    enc.external_tasks = 1;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+    svt_jpeg_xs_thread_pool_destroy(pool);
+
+    enc.thread_pool = NULL;
+    enc.external_tasks = 0;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_task_t* task = NULL;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_get_task(&enc, &task));
+    svt_jpeg_xs_encoder_close(&enc);
+}
@@ -0,0 +1,144 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "PipelineTestUtils.h"
+
+static void check_frame_stats(const svt_jpeg_xs_frame_stats_t& stats, uint32_t slices_num, uint8_t encoder_dwt) {
+    EXPECT_EQ(slices_num, stats.slices_num);
+    EXPECT_NE(0u, stats.send_ns);
+    EXPECT_LE(stats.send_ns, stats.init_begin_ns);
+    EXPECT_LE(stats.init_begin_ns, stats.init_end_ns);
+    EXPECT_LE(stats.init_end_ns, stats.slices_begin_ns);
+    EXPECT_LE(stats.slices_begin_ns, stats.slices_end_ns);
+    EXPECT_LE(stats.slices_end_ns, stats.final_ready_ns);
+    EXPECT_LE(stats.final_ready_ns, stats.final_send_ns);
+    EXPECT_LE(stats.final_send_ns, stats.output_ns);
+    if (encoder_dwt) {
+        EXPECT_LE(stats.init_end_ns, stats.dwt_begin_ns);
+        EXPECT_LE(stats.dwt_begin_ns, stats.dwt_end_ns);
+        EXPECT_LE(stats.dwt_end_ns, stats.slices_end_ns);
+    }
+    else {
+        EXPECT_EQ(0u, stats.dwt_begin_ns);
+        EXPECT_EQ(0u, stats.dwt_end_ns);
+    }
+    for (uint32_t s = 0; s < std::min(stats.slices_num, stats.slices_size); s++) {
+        EXPECT_LE(stats.slices_begin_ns, stats.slices[s].begin_ns);
+        EXPECT_LE(stats.slices[s].begin_ns, stats.slices[s].end_ns);
+        EXPECT_LE(stats.slices[s].end_ns, stats.slices_end_ns);
+    }
+}
+
+class FrameStatistics : public ::testing::TestWithParam<uint8_t> {};
+
+TEST_P(FrameStatistics, encode_decode_timestamps_ordered) {
+    const uint8_t cpu_profile = GetParam();
+    TestEncoder encoder;
+    ASSERT_EQ(SvtJxsErrorNone, encoder.init([cpu_profile](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->cpu_profile = cpu_profile;
+        enc->threads_num = 4;
+        enc->slice_height = 16;
+        enc->statistics = 1;
+    }));
+    const uint32_t slices_num = TEST_HEIGHT / 16;
+    fill_image(encoder.image, 0);
+
+    /*Application array is smaller than number of slices, library fill only first slices.*/
+    std::vector<svt_jpeg_xs_slice_stats_t> slices(slices_num - 1);
+    svt_jpeg_xs_frame_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.slices = slices.data();
+    stats.slices_size = (uint32_t)slices.size();
+
+    svt_jpeg_xs_frame_t frame = encoder.input_frame();
+    frame.stats = &stats;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_send_picture(&encoder.api, &frame, 1));
+    svt_jpeg_xs_frame_t enc_output;
+    memset(&enc_output, 0, sizeof(enc_output));
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_get_packet(&encoder.api, &enc_output, 1));
+    ASSERT_EQ(&stats, enc_output.stats);
+    check_frame_stats(stats, slices_num, cpu_profile == 1);
+    uint32_t padding_bytes = 0;
+    for (const svt_jpeg_xs_slice_stats_t& slice : slices) {
+        EXPECT_NE(0u, slice.end_ns);
+        padding_bytes += slice.padding_bytes;
+    }
+    Bitstream bitstream(enc_output.bitstream.buffer, enc_output.bitstream.buffer + enc_output.bitstream.used_size);
+
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.threads_num = 4;
+    dec.statistics = 1;
+    svt_jpeg_xs_image_config_t image_config;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_init(
+                  SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &dec, bitstream.data(), bitstream.size(), &image_config));
+
+    /*Decoder read that same quantization and padding as encoder write.*/
+    std::vector<svt_jpeg_xs_slice_stats_t> dec_slices(slices_num);
+    svt_jpeg_xs_frame_stats_t dec_stats;
+    memset(&dec_stats, 0, sizeof(dec_stats));
+    dec_stats.slices = dec_slices.data();
+    dec_stats.slices_size = (uint32_t)dec_slices.size();
+    memset(&frame, 0, sizeof(frame));
+    frame.image = *encoder.image;
+    frame.bitstream.buffer = bitstream.data();
+    frame.bitstream.used_size = (uint32_t)bitstream.size();
+    frame.stats = &dec_stats;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_send_frame(&dec, &frame, 1));
+    svt_jpeg_xs_frame_t dec_output;
+    memset(&dec_output, 0, sizeof(dec_output));
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_frame(&dec, &dec_output, 1));
+    ASSERT_EQ(&dec_stats, dec_output.stats);
+    check_frame_stats(dec_stats, slices_num, 0);
+    uint32_t dec_padding_bytes = 0;
+    for (uint32_t s = 0; s < slices.size(); s++) {
+        EXPECT_EQ(slices[s].quantization, dec_slices[s].quantization);
+        EXPECT_EQ(slices[s].refinement, dec_slices[s].refinement);
+        dec_padding_bytes += dec_slices[s].padding_bytes;
+    }
+    EXPECT_EQ(padding_bytes, dec_padding_bytes);
+    svt_jpeg_xs_decoder_close(&dec);
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, FrameStatistics, ::testing::Values(0, 1));
+
+TEST(FrameStatistics, disabled_detach_stats) {
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 2, 0, &bitstreams);
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.threads_num = 2;
+    svt_jpeg_xs_image_config_t image_config;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_init(SVT_JPEGXS_API_VER_MAJOR,
+                                       SVT_JPEGXS_API_VER_MINOR,
+                                       &dec,
+                                       bitstreams[0].data(),
+                                       bitstreams[0].size(),
+                                       &image_config));
+    svt_jpeg_xs_image_buffer_t* image = svt_jpeg_xs_image_buffer_alloc(&image_config);
+    ASSERT_NE(nullptr, image);
+    svt_jpeg_xs_frame_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    svt_jpeg_xs_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.image = *image;
+    frame.bitstream.buffer = bitstreams[0].data();
+    frame.bitstream.used_size = (uint32_t)bitstreams[0].size();
+    frame.stats = &stats;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_send_frame(&dec, &frame, 1));
+    svt_jpeg_xs_frame_t dec_output;
+    memset(&dec_output, 0, sizeof(dec_output));
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_frame(&dec, &dec_output, 1));
+    EXPECT_EQ(nullptr, dec_output.stats);
+    EXPECT_EQ(0u, stats.send_ns);
+    svt_jpeg_xs_decoder_close(&dec);
+    svt_jpeg_xs_image_buffer_free(image);
+}
@@ -0,0 +1,124 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Requirements are measured without threads, usage contains also arrays of thread handles.*/
+#define MEMORY_THREADS_HANDLES_BYTES (64 * sizeof(void*))
+
+TEST(MemoryAccounting, encoder_requirements_match_usage) {
+    for (uint8_t cpu_profile = 0; cpu_profile < 2; cpu_profile++) {
+        svt_jpeg_xs_encoder_api_t enc;
+        load_test_encoder_config(&enc);
+        enc.cpu_profile = cpu_profile;
+        enc.threads_num = 4;
+        uint64_t required = 0;
+        ASSERT_EQ(SvtJxsErrorNone,
+                  svt_jpeg_xs_encoder_get_memory_requirements(
+                      SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc, &required));
+        EXPECT_EQ(nullptr, enc.private_ptr);
+        EXPECT_GT(required, (uint64_t)TEST_WIDTH * TEST_HEIGHT);
+
+        uint64_t used = 0;
+        EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_get_memory_usage(&enc, &used));
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_get_memory_usage(&enc, &used));
+        EXPECT_GE(used, required);
+        EXPECT_LE(used - required, MEMORY_THREADS_HANDLES_BYTES);
+        svt_jpeg_xs_encoder_close(&enc);
+
+        /*Deeper pipeline needs more memory.*/
+        enc.picture_pool_size = 16;
+        uint64_t required_deep = 0;
+        ASSERT_EQ(SvtJxsErrorNone,
+                  svt_jpeg_xs_encoder_get_memory_requirements(
+                      SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc, &required_deep));
+        EXPECT_GT(required_deep, required);
+    }
+
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.source_width = 0;
+    uint64_t required = 0;
+    EXPECT_NE(SvtJxsErrorNone,
+              svt_jpeg_xs_encoder_get_memory_requirements(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc, &required));
+    EXPECT_EQ(nullptr, enc.private_ptr);
+}
+
+TEST(MemoryAccounting, decoder_requirements_match_usage) {
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 2, 0, &bitstreams);
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.threads_num = 4;
+    uint64_t required = 0;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_get_memory_requirements(SVT_JPEGXS_API_VER_MAJOR,
+                                                          SVT_JPEGXS_API_VER_MINOR,
+                                                          &dec,
+                                                          bitstreams[0].data(),
+                                                          bitstreams[0].size(),
+                                                          &required));
+    EXPECT_EQ(nullptr, dec.private_ptr);
+    EXPECT_GT(required, 0u);
+
+    svt_jpeg_xs_image_config_t image_config;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_init(SVT_JPEGXS_API_VER_MAJOR,
+                                       SVT_JPEGXS_API_VER_MINOR,
+                                       &dec,
+                                       bitstreams[0].data(),
+                                       bitstreams[0].size(),
+                                       &image_config));
+    uint64_t used = 0;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_memory_usage(&dec, &used));
+    EXPECT_GE(used, required);
+    EXPECT_LE(used - required, MEMORY_THREADS_HANDLES_BYTES);
+    svt_jpeg_xs_decoder_close(&dec);
+}
+
+TEST(MemoryAccounting, decoder_sync_contexts_are_counted) {
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 1, 0, &bitstreams);
+    for (uint32_t memory_flags = 0; memory_flags < 2; memory_flags++) {
+        svt_jpeg_xs_decoder_api_t dec;
+        load_test_decoder_config(&dec);
+        dec.memory_flags = memory_flags ? SVT_JPEGXS_MEMORY_HUGE_PAGES : SVT_JPEGXS_MEMORY_DEFAULT;
+        svt_jpeg_xs_image_config_t image_config;
+        ASSERT_EQ(SvtJxsErrorNone,
+                  svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                                SVT_JPEGXS_API_VER_MINOR,
+                                                &dec,
+                                                bitstreams[0].data(),
+                                                bitstreams[0].size(),
+                                                &image_config));
+        uint64_t used_init = 0;
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_memory_usage(&dec, &used_init));
+
+        svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx[2] = {NULL, NULL};
+        uint64_t used[2] = {0, 0};
+        for (uint32_t i = 0; i < 2; i++) {
+            ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_sync_ctx_create(&dec, &sync_ctx[i]));
+            ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_memory_usage(&dec, &used[i]));
+        }
+        EXPECT_GT(used[0], used_init);
+        EXPECT_EQ(used[1] - used[0], used[0] - used_init);
+
+        /*Release is counted on any thread.*/
+        std::thread thread([&sync_ctx]() { svt_jpeg_xs_decoder_sync_ctx_destroy(sync_ctx[1]); });
+        thread.join();
+        uint64_t used_destroy = 0;
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_memory_usage(&dec, &used_destroy));
+        EXPECT_EQ(used[0], used_destroy);
+        svt_jpeg_xs_decoder_sync_ctx_destroy(sync_ctx[0]);
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_get_memory_usage(&dec, &used_destroy));
+        EXPECT_EQ(used_init, used_destroy);
+        svt_jpeg_xs_decoder_close(&dec);
+    }
+}
@@ -0,0 +1,128 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <vector>
+#include "PipelineTestUtils.h"
+
+#define MEMORY_ARENA_FLAGS       (SVT_JPEGXS_MEMORY_HUGE_PAGES | SVT_JPEGXS_MEMORY_LOCK)
+#define MEMORY_ARENA_REGION_SIZE ((uint64_t)2 << 20)
+
+/*Huge pages and memory lock fallback to normal pages, so test pass also without privileges.*/
+TEST(MemoryArena, encode_decode_match_heap) {
+    for (uint8_t cpu_profile = 0; cpu_profile < 2; cpu_profile++) {
+        std::vector<Bitstream> bitstreams_ref;
+        std::vector<Bitstream> bitstreams_arena;
+        encode_frames(NULL, 4, cpu_profile, &bitstreams_ref);
+        encode_frames(NULL, 4, cpu_profile, &bitstreams_arena, NULL, 0, [](svt_jpeg_xs_encoder_api_t* enc) {
+            enc->memory_flags = MEMORY_ARENA_FLAGS;
+        });
+        EXPECT_EQ(bitstreams_ref, bitstreams_arena);
+
+        std::vector<Bitstream> images_ref;
+        std::vector<Bitstream> images_arena;
+        decode_frames(NULL, 4, bitstreams_ref, &images_ref);
+        decode_frames(NULL, 4, bitstreams_ref, &images_arena, NULL, [](svt_jpeg_xs_decoder_api_t* dec) {
+            dec->memory_flags = MEMORY_ARENA_FLAGS;
+        });
+        EXPECT_EQ(images_ref, images_arena);
+    }
+}
+
+TEST(MemoryArena, encoder_usage_is_mapped_regions) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.threads_num = 4;
+    enc.memory_flags = MEMORY_ARENA_FLAGS;
+    uint64_t required = 0;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_encoder_get_memory_requirements(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc, &required));
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    uint64_t used = 0;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_get_memory_usage(&enc, &used));
+    EXPECT_EQ(used, required);
+    EXPECT_EQ(0u, used % MEMORY_ARENA_REGION_SIZE);
+    svt_jpeg_xs_encoder_close(&enc);
+}
+
+TEST(MemoryArena, frame_pool_buffers) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    svt_jpeg_xs_image_config_t image_config;
+    uint32_t bytes_per_frame = 0;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_encoder_get_image_config(
+                  SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc, &image_config, &bytes_per_frame));
+    EXPECT_EQ(nullptr, svt_jpeg_xs_frame_pool_alloc_with_memory_flags(&image_config, bytes_per_frame, 0, MEMORY_ARENA_FLAGS));
+
+    const uint32_t frames_num = 3;
+    svt_jpeg_xs_frame_pool_t* pool = svt_jpeg_xs_frame_pool_alloc_with_memory_flags(
+        &image_config, bytes_per_frame, frames_num, MEMORY_ARENA_FLAGS);
+    ASSERT_NE(nullptr, pool);
+    std::vector<svt_jpeg_xs_frame_t> frames(frames_num);
+    for (uint32_t i = 0; i < frames_num; i++) {
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_frame_pool_get(pool, &frames[i], 0));
+        ASSERT_GE(frames[i].bitstream.allocation_size, bytes_per_frame);
+        memset(frames[i].bitstream.buffer, (int)i, bytes_per_frame);
+        for (uint32_t c = 0; c < image_config.components_num; c++) {
+            ASSERT_GE(frames[i].image.alloc_size[c], image_config.components[c].byte_size);
+            memset(frames[i].image.data_yuv[c], (int)i, frames[i].image.alloc_size[c]);
+        }
+    }
+    /*Buffers do not overlap.*/
+    for (uint32_t i = 0; i < frames_num; i++) {
+        EXPECT_EQ((uint8_t)i, frames[i].bitstream.buffer[bytes_per_frame - 1]);
+        for (uint32_t c = 0; c < image_config.components_num; c++) {
+            EXPECT_EQ((uint8_t)i, ((uint8_t*)frames[i].image.data_yuv[c])[frames[i].image.alloc_size[c] - 1]);
+        }
+        frames[i].image.ready_to_release = 1;
+        frames[i].bitstream.ready_to_release = 1;
+        svt_jpeg_xs_frame_pool_release(pool, &frames[i]);
+    }
+    svt_jpeg_xs_frame_t frame;
+    EXPECT_EQ(SvtJxsErrorNone, svt_jpeg_xs_frame_pool_get(pool, &frame, 0));
+    svt_jpeg_xs_frame_pool_free(pool);
+}
+
+/*Buffers allocated before error are released from arena, not by free().*/
+TEST(MemoryArena, init_error_releases_arena) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.memory_flags = MEMORY_ARENA_FLAGS;
+    enc.ndecomp_v = 5;
+    EXPECT_NE(SvtJxsErrorNone, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 1, 0, &bitstreams);
+    ASSERT_FALSE(bitstreams.empty());
+    for (uint8_t sync_mode = 0; sync_mode < 2; sync_mode++) {
+        svt_jpeg_xs_decoder_api_t dec;
+        load_test_decoder_config(&dec);
+        dec.memory_flags = MEMORY_ARENA_FLAGS;
+        dec.packetization_mode = 2;
+        svt_jpeg_xs_image_config_t image_config;
+        if (sync_mode) {
+            EXPECT_NE(SvtJxsErrorNone,
+                      svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                                    SVT_JPEGXS_API_VER_MINOR,
+                                                    &dec,
+                                                    bitstreams[0].data(),
+                                                    bitstreams[0].size(),
+                                                    &image_config));
+        }
+        else {
+            EXPECT_NE(SvtJxsErrorNone,
+                      svt_jpeg_xs_decoder_init(SVT_JPEGXS_API_VER_MAJOR,
+                                               SVT_JPEGXS_API_VER_MINOR,
+                                               &dec,
+                                               bitstreams[0].data(),
+                                               bitstreams[0].size(),
+                                               &image_config));
+        }
+        svt_jpeg_xs_decoder_close(&dec);
+    }
+}
@@ -18,6 +18,11 @@
 #include "NltEnc.h"
 #include "Enc_avx512.h"
 #include "Precinct.h"
+#include "Dwt.h"
+#include "Dwt_AVX2.h"
+#include "Idwt.h"
+#include "Dwt53Decoder_AVX2.h"
+#include "idwt-avx512.h"
 
 TEST(Nlt_Linear_Output_8bit, 8AVX2) {
     const int32_t w = 1999;
@@ -338,4 +343,340 @@ TEST(Nlt_Linear_Input_16bit, AVX512) {
         test_linear_input_scaling_line_16bit(linear_input_scaling_line_16bit_avx512);
     }
 }
+
+void test_image_shift_int16(void (*test_fn)(uint16_t* out_coeff_16bit, const int16_t* in_coeff_16bit, uint32_t width,
+                                            int32_t shift, int32_t offset)) {
+    const uint32_t w = 1999;
+
+    svt_jxs_test_tool::SVTRandom* rnd = new svt_jxs_test_tool::SVTRandom(16, false);
+
+    int16_t* src = (int16_t*)malloc(w * sizeof(int16_t));
+    uint16_t* dst_ref = (uint16_t*)malloc(w * sizeof(uint16_t));
+    uint16_t* dst_mod = (uint16_t*)malloc(w * sizeof(uint16_t));
+
+    /*16 bit path shift 0 when Fq is equal to shift of input to 16 bits.*/
+    for (int32_t shift = 0; shift < 3; ++shift) {
+        const int32_t offset = shift ? (1 << (shift - 1)) : 0;
+        for (uint32_t i = 0; i < w; i++) {
+            /*Range of first DWT level output in 16 bits, see dwt_16bit_params_init()*/
+            src[i] = (int16_t)((rnd->Rand16() % (1 << 15)) - (1 << 14));
+        }
+        src[0] = -1; //Test -0
+        image_shift_int16_c(dst_ref, src, w, shift, offset);
+        test_fn(dst_mod, src, w, shift, offset);
+        ASSERT_EQ(memcmp(dst_ref, dst_mod, sizeof(uint16_t) * w), 0);
+    }
+
+    free(src);
+    free(dst_ref);
+    free(dst_mod);
+    delete rnd;
+}
+
+TEST(image_shift_int16, AVX2) {
+    test_image_shift_int16(image_shift_int16_avx2);
+}
+
+TEST(image_shift_int16, AVX512) {
+    if (CPU_FLAGS_AVX512F & get_cpu_flags()) {
+        test_image_shift_int16(image_shift_int16_avx512);
+    }
+}
+
+void test_dwt_horizontal_line_input(
+    void (*test_fn_8bit)(int32_t* out_lf, int32_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift, int32_t offset),
+    void (*test_fn_16bit)(int32_t* out_lf, int32_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift, int32_t offset,
+                          uint8_t bit_depth)) {
+    const uint32_t w_max = 1999;
+    const uint32_t widths[] = {2, 3, 4, 5, 16, 17, 18, 19, 33, 34, 35, 64, 1998, w_max};
+    const uint8_t param_Bw = 20;
+
+    svt_jxs_test_tool::SVTRandom* rnd = new svt_jxs_test_tool::SVTRandom(16, false);
+    uint8_t* src_8bit = (uint8_t*)malloc(w_max * sizeof(uint8_t));
+    uint16_t* src_16bit = (uint16_t*)malloc(w_max * sizeof(uint16_t));
+    int32_t* src_32bit = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int32_t* dst_ref = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int32_t* dst_c = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int32_t* dst_mod = (int32_t*)malloc(w_max * sizeof(int32_t));
+
+    for (uint8_t input_bit_depth = 8; input_bit_depth <= 14; input_bit_depth += 2) {
+        const uint8_t shift = param_Bw - input_bit_depth;
+        const int32_t offset = 1 << (param_Bw - 1);
+
+        for (uint32_t j = 0; j < w_max; j++) {
+            src_8bit[j] = rnd->Rand8();
+            /*Invalid bits over bit depth have to be ignored*/
+            src_16bit[j] = rnd->Rand16();
+        }
+
+        for (uint32_t w : widths) {
+            const uint32_t width_lf = (w + 1) / 2;
+            memset(dst_ref, 0, w_max * sizeof(int32_t));
+            memset(dst_c, 0, w_max * sizeof(int32_t));
+            memset(dst_mod, 0, w_max * sizeof(int32_t));
+
+            /*Reference is separated input scaling and horizontal DWT*/
+            if (input_bit_depth == 8) {
+                linear_input_scaling_line_8bit_c(src_8bit, src_32bit, w, shift, offset);
+                dwt_horizontal_line_input_8bit_c(dst_c, dst_c + width_lf, src_8bit, w, shift, offset);
+                test_fn_8bit(dst_mod, dst_mod + width_lf, src_8bit, w, shift, offset);
+            }
+            else {
+                linear_input_scaling_line_16bit_c(src_16bit, src_32bit, w, shift, offset, input_bit_depth);
+                dwt_horizontal_line_input_16bit_c(dst_c, dst_c + width_lf, src_16bit, w, shift, offset, input_bit_depth);
+                test_fn_16bit(dst_mod, dst_mod + width_lf, src_16bit, w, shift, offset, input_bit_depth);
+            }
+            dwt_horizontal_line_c(dst_ref, dst_ref + width_lf, src_32bit, w);
+            ASSERT_EQ(memcmp(dst_ref, dst_c, sizeof(int32_t) * w), 0) << "width " << w;
+            ASSERT_EQ(memcmp(dst_ref, dst_mod, sizeof(int32_t) * w), 0) << "width " << w;
+        }
+    }
+
+    free(src_8bit);
+    free(src_16bit);
+    free(src_32bit);
+    free(dst_ref);
+    free(dst_c);
+    free(dst_mod);
+    delete rnd;
+}
+
+TEST(Dwt_Horizontal_Line_Input, AVX2) {
+    test_dwt_horizontal_line_input(dwt_horizontal_line_input_8bit_avx2, dwt_horizontal_line_input_16bit_avx2);
+}
+
+TEST(Dwt_Horizontal_Line_Input, AVX512) {
+    if (CPU_FLAGS_AVX512F & get_cpu_flags()) {
+        test_dwt_horizontal_line_input(dwt_horizontal_line_input_8bit_avx512, dwt_horizontal_line_input_16bit_avx512);
+    }
+}
+
+void test_dwt_horizontal_line_int16_input(
+    void (*test_fn_8bit)(int16_t* out_lf, int16_t* out_hf, const uint8_t* in, uint32_t len, uint8_t shift, int16_t offset),
+    void (*test_fn_16bit)(int16_t* out_lf, int16_t* out_hf, const uint16_t* in, uint32_t len, uint8_t shift, int16_t offset,
+                          uint8_t bit_depth)) {
+    const uint32_t w_max = 1999;
+    const uint32_t widths[] = {2, 3, 4, 5, 16, 17, 33, 34, 35, 64, 65, 66, 67, 1998, w_max};
+
+    svt_jxs_test_tool::SVTRandom* rnd = new svt_jxs_test_tool::SVTRandom(16, false);
+    uint8_t* src_8bit = (uint8_t*)malloc(w_max * sizeof(uint8_t));
+    uint16_t* src_16bit = (uint16_t*)malloc(w_max * sizeof(uint16_t));
+    int32_t* dst_32bit = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int16_t* dst_ref = (int16_t*)malloc(w_max * sizeof(int16_t));
+    int16_t* dst_mod = (int16_t*)malloc(w_max * sizeof(int16_t));
+
+    picture_header_dynamic_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.hdr_Bw = 20;
+    hdr.hdr_Fq = 8;
+
+    for (uint8_t input_bit_depth = 8; input_bit_depth <= 10; ++input_bit_depth) {
+        dwt_16bit_params_t params;
+        dwt_16bit_params_init(&params, &hdr, input_bit_depth);
+        ASSERT_TRUE(params.enable);
+
+        for (uint32_t j = 0; j < w_max; j++) {
+            src_8bit[j] = rnd->Rand8();
+            /*Invalid bits over bit depth have to be ignored*/
+            src_16bit[j] = rnd->Rand16();
+        }
+
+        for (uint32_t w : widths) {
+            const uint32_t width_lf = (w + 1) / 2;
+            memset(dst_ref, 0, w_max * sizeof(int16_t));
+            memset(dst_mod, 0, w_max * sizeof(int16_t));
+
+            if (input_bit_depth == 8) {
+                dwt_horizontal_line_input_8bit_c(dst_32bit, dst_32bit + width_lf, src_8bit, w, params.shift_in, params.offset_in);
+                dwt_horizontal_line_int16_input_8bit_c(
+                    dst_ref, dst_ref + width_lf, src_8bit, w, params.shift_in, params.offset_in);
+                test_fn_8bit(dst_mod, dst_mod + width_lf, src_8bit, w, params.shift_in, params.offset_in);
+            }
+            else {
+                dwt_horizontal_line_input_16bit_c(
+                    dst_32bit, dst_32bit + width_lf, src_16bit, w, params.shift_in, params.offset_in, input_bit_depth);
+                dwt_horizontal_line_int16_input_16bit_c(
+                    dst_ref, dst_ref + width_lf, src_16bit, w, params.shift_in, params.offset_in, input_bit_depth);
+                test_fn_16bit(dst_mod, dst_mod + width_lf, src_16bit, w, params.shift_in, params.offset_in, input_bit_depth);
+            }
+            /*Output of first level in 16 bits is exact*/
+            for (uint32_t j = 0; j < w; j++) {
+                ASSERT_EQ(dst_32bit[j], dst_ref[j]) << "width " << w << " index " << j;
+            }
+            ASSERT_EQ(memcmp(dst_ref, dst_mod, sizeof(int16_t) * w), 0) << "width " << w;
+        }
+    }
+
+    free(src_8bit);
+    free(src_16bit);
+    free(dst_32bit);
+    free(dst_ref);
+    free(dst_mod);
+    delete rnd;
+}
+
+TEST(Dwt_Horizontal_Line_Int16_Input, AVX2) {
+    test_dwt_horizontal_line_int16_input(dwt_horizontal_line_int16_input_8bit_avx2, dwt_horizontal_line_int16_input_16bit_avx2);
+}
+template <typename T>
+void test_idwt_output_linear(void (*test_fn)(const int32_t* in_lf, const int16_t* in_hf, T* out, uint32_t len, uint8_t shift,
+                                             uint8_t bw, uint8_t depth),
+                             void (*ref_fn)(const int32_t* in_lf, const int16_t* in_hf, T* out, uint32_t len, uint8_t shift,
+                                            uint8_t bw, uint8_t depth),
+                             void (*scaling_fn)(int32_t* in, uint32_t bw, uint32_t depth, T* out, uint32_t w), uint8_t depth) {
+    const uint32_t w_max = 1999;
+    const uint32_t widths[] = {2, 3, 4, 5, 17, 18, 19, 33, 34, 35, 64, 65, 66, 67, 1998, w_max};
+    const uint8_t bw = 20;
+    const uint8_t shift = 8;
+
+    svt_jxs_test_tool::SVTRandom* rnd = new svt_jxs_test_tool::SVTRandom(32, false);
+    int32_t* lf = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int16_t* hf = (int16_t*)malloc(w_max * sizeof(int16_t));
+    int32_t* line = (int32_t*)malloc(w_max * sizeof(int32_t));
+    T* out_ref = (T*)malloc(w_max * sizeof(T));
+    T* out_c = (T*)malloc(w_max * sizeof(T));
+    T* out_mod = (T*)malloc(w_max * sizeof(T));
+
+    for (uint32_t j = 0; j < w_max; j++) {
+        /*Values out of output range test clamping on both sides*/
+        lf[j] = (int32_t)((uint32_t)rnd->random() % (1u << (bw + 1))) - (1 << bw);
+        hf[j] = (int16_t)((int32_t)((uint32_t)rnd->random() % (1u << 13)) - (1 << 12));
+    }
+
+    for (uint32_t w : widths) {
+        memset(out_ref, 0, w_max * sizeof(T));
+        memset(out_c, 0, w_max * sizeof(T));
+        memset(out_mod, 0, w_max * sizeof(T));
+
+        /*Reference is last IDWT level to 32 bits line and output scaling of line*/
+        idwt_horizontal_line_lf32_hf16_c(lf, hf, line, w, shift);
+        scaling_fn(line, bw, depth, out_ref, w);
+        ref_fn(lf, hf, out_c, w, shift, bw, depth);
+        test_fn(lf, hf, out_mod, w, shift, bw, depth);
+
+        ASSERT_EQ(memcmp(out_ref, out_c, sizeof(T) * w_max), 0) << "width " << w;
+        ASSERT_EQ(memcmp(out_ref, out_mod, sizeof(T) * w_max), 0) << "width " << w;
+    }
+
+    free(lf);
+    free(hf);
+    free(line);
+    free(out_ref);
+    free(out_c);
+    free(out_mod);
+    delete rnd;
+}
+
+TEST(Idwt_Output_Linear, AVX2) {
+    test_idwt_output_linear<uint8_t>(idwt_horizontal_line_lf32_hf16_output_8bit_avx2,
+                                     idwt_horizontal_line_lf32_hf16_output_8bit_c,
+                                     linear_output_scaling_8bit_line_c,
+                                     8);
+    for (uint8_t depth = 10; depth <= 16; depth += 2) {
+        test_idwt_output_linear<uint16_t>(idwt_horizontal_line_lf32_hf16_output_16bit_avx2,
+                                          idwt_horizontal_line_lf32_hf16_output_16bit_c,
+                                          linear_output_scaling_16bit_line_c,
+                                          depth);
+    }
+}
+
+TEST(Idwt_Output_Linear, AVX512) {
+    if (CPU_FLAGS_AVX512F & get_cpu_flags()) {
+        test_idwt_output_linear<uint8_t>(idwt_horizontal_line_lf32_hf16_output_8bit_avx512,
+                                         idwt_horizontal_line_lf32_hf16_output_8bit_c,
+                                         linear_output_scaling_8bit_line_c,
+                                         8);
+        for (uint8_t depth = 10; depth <= 16; depth += 2) {
+            test_idwt_output_linear<uint16_t>(idwt_horizontal_line_lf32_hf16_output_16bit_avx512,
+                                              idwt_horizontal_line_lf32_hf16_output_16bit_c,
+                                              linear_output_scaling_16bit_line_c,
+                                              depth);
+        }
+    }
+}
+
+template <typename T>
+void test_idwt_vertical_output_linear(void (*test_fn)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1,
+                                                      int32_t* out[4], T* out_odd, T* out_even, uint32_t len, uint8_t bw,
+                                                      uint8_t depth),
+                                      void (*ref_fn)(const int32_t* in_lf, const int32_t* in_hf0, const int32_t* in_hf1,
+                                                     int32_t* out[4], T* out_odd, T* out_even, uint32_t len, uint8_t bw,
+                                                     uint8_t depth),
+                                      void (*scaling_fn)(int32_t* in, uint32_t bw, uint32_t depth, T* out, uint32_t w),
+                                      uint8_t depth) {
+    const uint32_t w_max = 1999;
+    const uint32_t widths[] = {2, 3, 7, 8, 9, 15, 16, 17, 33, 64, 65, 1998, w_max};
+    const uint8_t bw = 20;
+
+    svt_jxs_test_tool::SVTRandom* rnd = new svt_jxs_test_tool::SVTRandom(32, false);
+    int32_t* lf = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int32_t* hf0 = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int32_t* hf1 = (int32_t*)malloc(w_max * sizeof(int32_t));
+    int32_t* lines_ref = (int32_t*)malloc(4 * w_max * sizeof(int32_t));
+    int32_t* lines_mod = (int32_t*)malloc(4 * w_max * sizeof(int32_t));
+    T* out_ref = (T*)malloc(2 * w_max * sizeof(T));
+    T* out_c = (T*)malloc(2 * w_max * sizeof(T));
+    T* out_mod = (T*)malloc(2 * w_max * sizeof(T));
+    int32_t* ref[4] = {lines_ref, lines_ref + w_max, lines_ref + 2 * w_max, lines_ref + 3 * w_max};
+    int32_t* mod[4] = {lines_mod, lines_mod + w_max, lines_mod + 2 * w_max, lines_mod + 3 * w_max};
+
+    for (uint32_t j = 0; j < w_max; j++) {
+        /*Values out of output range test clamping on both sides*/
+        lf[j] = (int32_t)((uint32_t)rnd->random() % (1u << (bw + 1))) - (1 << bw);
+        hf0[j] = (int32_t)((uint32_t)rnd->random() % (1u << 21)) - (1 << 20);
+        hf1[j] = (int32_t)((uint32_t)rnd->random() % (1u << 21)) - (1 << 20);
+        ref[0][j] = (int32_t)((uint32_t)rnd->random() % (1u << (bw + 1))) - (1 << bw);
+    }
+
+    for (uint32_t w : widths) {
+        memset(lines_ref + w_max, 0, 3 * w_max * sizeof(int32_t));
+        memcpy(lines_mod, lines_ref, 4 * w_max * sizeof(int32_t));
+        memset(out_ref, 0, 2 * w_max * sizeof(T));
+        memset(out_c, 0, 2 * w_max * sizeof(T));
+        memset(out_mod, 0, 2 * w_max * sizeof(T));
+
+        /*Reference is vertical IDWT of precinct inside component to 32 bits lines and output scaling of lines*/
+        idwt_vertical_line_c(lf, hf0, hf1, ref, w, 0, 0, 100);
+        scaling_fn(ref[1], bw, depth, out_ref, w);
+        scaling_fn(ref[2], bw, depth, out_ref + w_max, w);
+        ref_fn(lf, hf0, hf1, mod, out_c, out_c + w_max, w, bw, depth);
+        test_fn(lf, hf0, hf1, mod, out_mod, out_mod + w_max, w, bw, depth);
+
+        ASSERT_EQ(memcmp(ref[2], mod[2], sizeof(int32_t) * w_max), 0) << "width " << w;
+        ASSERT_EQ(memcmp(out_ref, out_c, sizeof(T) * 2 * w_max), 0) << "width " << w;
+        ASSERT_EQ(memcmp(out_ref, out_mod, sizeof(T) * 2 * w_max), 0) << "width " << w;
+    }
+
+    free(lf);
+    free(hf0);
+    free(hf1);
+    free(lines_ref);
+    free(lines_mod);
+    free(out_ref);
+    free(out_c);
+    free(out_mod);
+    delete rnd;
+}
+
+TEST(Idwt_Vertical_Output_Linear, AVX2) {
+    test_idwt_vertical_output_linear<uint8_t>(
+        idwt_vertical_line_output_8bit_avx2, idwt_vertical_line_output_8bit_c, linear_output_scaling_8bit_line_c, 8);
+    for (uint8_t depth = 10; depth <= 16; depth += 2) {
+        test_idwt_vertical_output_linear<uint16_t>(
+            idwt_vertical_line_output_16bit_avx2, idwt_vertical_line_output_16bit_c, linear_output_scaling_16bit_line_c, depth);
+    }
+}
+
+TEST(Idwt_Vertical_Output_Linear, AVX512) {
+    if (CPU_FLAGS_AVX512F & get_cpu_flags()) {
+        test_idwt_vertical_output_linear<uint8_t>(
+            idwt_vertical_line_output_8bit_avx512, idwt_vertical_line_output_8bit_c, linear_output_scaling_8bit_line_c, 8);
+        for (uint8_t depth = 10; depth <= 16; depth += 2) {
+            test_idwt_vertical_output_linear<uint16_t>(idwt_vertical_line_output_16bit_avx512,
+                                                       idwt_vertical_line_output_16bit_c,
+                                                       linear_output_scaling_16bit_line_c,
+                                                       depth);
+        }
+    }
+}
 #endif
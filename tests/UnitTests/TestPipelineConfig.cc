@@ -0,0 +1,79 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Smallest coefficient ring and picture pool have to produce that same bitstream.
+ *With 16 threads every component has own DWT Stage thread and ring is smaller than frame.*/
+TEST(EncoderPipeline, coeff_slice_ring_match_default) {
+    for (uint32_t colour_format : {COLOUR_FORMAT_PLANAR_YUV422, COLOUR_FORMAT_PLANAR_YUV420}) {
+        const EncoderConfigure format = [colour_format](svt_jpeg_xs_encoder_api_t* enc) {
+            enc->colour_format = (ColourFormat_t)colour_format;
+        };
+        std::vector<Bitstream> ref_bitstreams;
+        encode_frames(NULL, 4, 1, &ref_bitstreams, NULL, 0, format);
+        for (uint32_t threads_num : {4u, 16u}) {
+            for (uint32_t ring_size : {1u, 2u}) {
+                std::vector<Bitstream> bitstreams;
+                encode_frames(NULL, threads_num, 1, &bitstreams, NULL, 0, [&](svt_jpeg_xs_encoder_api_t* enc) {
+                    format(enc);
+                    enc->picture_pool_size = ring_size;
+                    enc->coeff_slice_ring_size = ring_size;
+                });
+                EXPECT_EQ(ref_bitstreams, bitstreams);
+            }
+        }
+    }
+}
+
+class EncoderPipelinePreset : public ::testing::TestWithParam<uint8_t> {};
+
+TEST_P(EncoderPipelinePreset, queue_depths_match_default) {
+    const uint8_t cpu_profile = GetParam();
+    const EncoderConfigure enc_configs[] = {
+        [](svt_jpeg_xs_encoder_api_t* enc) { enc->pipeline_preset = pipeline_preset_min_latency; },
+        [](svt_jpeg_xs_encoder_api_t* enc) { enc->pipeline_preset = pipeline_preset_max_throughput; },
+        [](svt_jpeg_xs_encoder_api_t* enc) {
+            enc->input_queue_size = 2;
+            enc->output_queue_size = 1;
+            enc->slice_queue_size = 1;
+        }};
+    const DecoderConfigure dec_configs[] = {
+        [](svt_jpeg_xs_decoder_api_t* dec) { dec->pipeline_preset = pipeline_preset_min_latency; },
+        [](svt_jpeg_xs_decoder_api_t* dec) { dec->pipeline_preset = pipeline_preset_max_throughput; },
+        [](svt_jpeg_xs_decoder_api_t* dec) {
+            dec->input_queue_size = 2;
+            dec->output_queue_size = 1;
+            dec->frame_pool_size = 2;
+        }};
+
+    std::vector<Bitstream> ref_bitstreams;
+    encode_frames(NULL, 6, cpu_profile, &ref_bitstreams);
+    for (const EncoderConfigure& configure : enc_configs) {
+        std::vector<Bitstream> bitstreams;
+        encode_frames(NULL, 6, cpu_profile, &bitstreams, NULL, 0, configure);
+        EXPECT_EQ(ref_bitstreams, bitstreams);
+    }
+
+    std::vector<Bitstream> ref_images;
+    decode_frames(NULL, 6, ref_bitstreams, &ref_images);
+    for (const DecoderConfigure& configure : dec_configs) {
+        std::vector<Bitstream> images;
+        decode_frames(NULL, 6, ref_bitstreams, &images, NULL, configure);
+        EXPECT_EQ(ref_images, images);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, EncoderPipelinePreset, ::testing::Values(0, 1));
+
+TEST(EncoderPipeline, invalid_preset) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.pipeline_preset = pipeline_preset_max;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+}
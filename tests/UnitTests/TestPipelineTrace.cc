@@ -0,0 +1,88 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "PipelineTestUtils.h"
+#include "SvtTrace.h"
+
+/*Checks are compiled in every configuration, they run only when library is built with ENABLE_TRACE.
+ *Tests can run in parallel processes, so every test writes own file.*/
+static std::string trace_test_path() {
+    return std::string("svt_jpeg_xs_trace_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json";
+}
+
+static std::string trace_flush_read() {
+    const std::string path = trace_test_path();
+    std::string trace;
+    EXPECT_EQ(SvtJxsErrorNone, svt_jpeg_xs_trace_flush(path.c_str()));
+    FILE* file = fopen(path.c_str(), "rb");
+    EXPECT_NE(nullptr, file);
+    if (file) {
+        char buffer[4096];
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            trace.append(buffer, read);
+        }
+        fclose(file);
+    }
+    remove(path.c_str());
+    return trace;
+}
+
+static bool trace_enabled() {
+    const std::string path = trace_test_path();
+    const SvtJxsErrorType_t ret = svt_jpeg_xs_trace_flush(path.c_str());
+    remove(path.c_str());
+    if (ret == SvtJxsErrorUndefined) {
+        return false;
+    }
+    EXPECT_EQ(SvtJxsErrorNone, ret);
+    return true;
+}
+
+TEST(PipelineTrace, flush_chrome_trace) {
+    EXPECT_NE(SvtJxsErrorNone, svt_jpeg_xs_trace_flush(NULL));
+    if (!trace_enabled()) {
+        GTEST_SKIP() << "Library built without ENABLE_TRACE";
+    }
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 2, 1, &bitstreams);
+    std::vector<Bitstream> images;
+    decode_frames(NULL, 2, bitstreams, &images);
+
+    std::string trace = trace_flush_read();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"enc_pack\",\"ph\":\"B\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"enc_pack\",\"ph\":\"E\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"dec_slice\",\"ph\":\"E\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"dec_final\""));
+    /*Events are consumed by flush.*/
+    trace = trace_flush_read();
+    EXPECT_EQ(std::string::npos, trace.find("\"name\":\"enc_pack\""));
+}
+
+TEST(PipelineTrace, dropped_events_reset_on_flush) {
+    if (!trace_enabled()) {
+        GTEST_SKIP() << "Library built without ENABLE_TRACE";
+    }
+    /*New thread has own empty buffer, events above its size are dropped.*/
+    const uint32_t events_num = (1 << 16) + 100;
+    std::thread thread([events_num]() {
+        for (uint32_t i = 0; i < events_num; i++) {
+            SVT_TRACE_BEGIN("test_event", i, -1);
+        }
+    });
+    thread.join();
+
+    std::string trace = trace_flush_read();
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"test_event"));
+    EXPECT_NE(std::string::npos, trace.find("\"dropped_events\":\"100\""));
+    trace = trace_flush_read();
+    EXPECT_NE(std::string::npos, trace.find("\"dropped_events\":\"0\""));
+}
@@ -0,0 +1,55 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <thread>
+#include "encoder_dsp_rtcd.h"
+#include "decoder_dsp_rtcd.h"
+#include "Dwt.h"
+#include "Dequant.h"
+
+TEST(Rtcd, table_c_only) {
+    common_rtcd_t common_rtcd;
+    encoder_rtcd_t encoder_rtcd;
+    decoder_rtcd_t decoder_rtcd;
+    setup_common_rtcd(&common_rtcd, 0);
+    setup_encoder_rtcd(&encoder_rtcd, 0);
+    setup_decoder_rtcd(&decoder_rtcd, 0);
+
+    EXPECT_EQ(common_rtcd.svt_log2_32, log2_32_c);
+    EXPECT_EQ(encoder_rtcd.dwt_horizontal_line, dwt_horizontal_line_c);
+    EXPECT_EQ(decoder_rtcd.dequant, dequant_c);
+}
+
+TEST(Rtcd, setup_table_not_modify_bound_kernels) {
+    setup_common_rtcd_internal(0);
+    setup_encoder_rtcd_internal(0);
+
+    common_rtcd_t common_rtcd;
+    encoder_rtcd_t encoder_rtcd;
+    setup_common_rtcd(&common_rtcd, CPU_FLAGS_ALL);
+    setup_encoder_rtcd(&encoder_rtcd, CPU_FLAGS_ALL);
+
+    EXPECT_EQ(svt_log2_32, log2_32_c);
+    EXPECT_EQ(dwt_horizontal_line, dwt_horizontal_line_c);
+}
+
+TEST(Rtcd, bind_per_thread) {
+    encoder_rtcd_t encoder_rtcd_c;
+    encoder_rtcd_t encoder_rtcd_all;
+    setup_encoder_rtcd(&encoder_rtcd_c, 0);
+    setup_encoder_rtcd(&encoder_rtcd_all, CPU_FLAGS_ALL);
+    bind_encoder_rtcd(&encoder_rtcd_c);
+
+    void (*thread_dwt_horizontal_line)(int32_t*, int32_t*, const int32_t*, uint32_t) = NULL;
+    std::thread worker([&]() {
+        bind_encoder_rtcd(&encoder_rtcd_all);
+        thread_dwt_horizontal_line = dwt_horizontal_line;
+    });
+    worker.join();
+
+    EXPECT_EQ(thread_dwt_horizontal_line, encoder_rtcd_all.dwt_horizontal_line);
+    EXPECT_EQ(dwt_horizontal_line, dwt_horizontal_line_c);
+}
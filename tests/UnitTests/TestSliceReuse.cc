@@ -0,0 +1,83 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Reuse of unchanged slices: screen content with static frames and one changed line.*/
+static void encode_frames_screen(uint32_t threads_num, uint8_t cpu_profile, uint8_t reuse, std::vector<Bitstream>* bitstreams,
+                                 const EncoderConfigure& configure) {
+    TestEncoder encoder;
+    ASSERT_EQ(SvtJxsErrorNone, encoder.init([&](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->cpu_profile = cpu_profile;
+        enc->threads_num = threads_num;
+        enc->slice_height = 16;
+        configure(enc);
+        enc->reuse_unchanged_slices = reuse;
+    }));
+
+    /*Frames: static, static, first line of third slice changed (used by DWT of second slice), static, restored.*/
+    const uint32_t changed_line = 2 * encoder.api.slice_height;
+    for (uint32_t f = 0; f < 5; f++) {
+        fill_image(encoder.image, 0);
+        if (f == 2 || f == 3) {
+            uint8_t* line = (uint8_t*)encoder.image->data_yuv[0] + (size_t)changed_line * encoder.image->stride[0];
+            for (uint32_t i = 0; i < encoder.image_config.components[0].width; i++) {
+                line[i] = (uint8_t)(line[i] ^ 0x5a);
+            }
+        }
+        svt_jpeg_xs_frame_t input = encoder.input_frame();
+        Bitstream bitstream;
+        ASSERT_EQ(SvtJxsErrorNone, encoder.encode(&input, &bitstream));
+        bitstreams->push_back(bitstream);
+    }
+}
+
+/*Copied slices have to give the same codestream as slices encoded again.*/
+TEST(EncoderSliceReuse, match_without_reuse) {
+    const EncoderConfigure configs[] = {[](svt_jpeg_xs_encoder_api_t*) {},
+                                        [](svt_jpeg_xs_encoder_api_t* enc) {
+                                            enc->colour_format = COLOUR_FORMAT_PLANAR_YUV420;
+                                            enc->rate_control_mode = 2;
+                                            enc->coding_vertical_prediction_mode = 1;
+                                        },
+                                        [](svt_jpeg_xs_encoder_api_t* enc) {
+                                            enc->ndecomp_v = 1;
+                                            enc->slice_height = 8;
+                                        }};
+    for (const EncoderConfigure& configure : configs) {
+        for (uint8_t cpu_profile : {0, 1}) {
+            std::vector<Bitstream> ref_bitstreams;
+            encode_frames_screen(1, cpu_profile, 0, &ref_bitstreams, configure);
+            ASSERT_EQ(5u, ref_bitstreams.size());
+            ASSERT_EQ(ref_bitstreams[0], ref_bitstreams[1]);
+            ASSERT_NE(ref_bitstreams[1], ref_bitstreams[2]);
+            for (uint32_t threads_num : {1u, 4u}) {
+                std::vector<Bitstream> bitstreams;
+                encode_frames_screen(threads_num, cpu_profile, 1, &bitstreams, configure);
+                EXPECT_EQ(ref_bitstreams, bitstreams);
+            }
+        }
+    }
+}
+
+TEST(EncoderSliceReuse, invalid_configuration) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.reuse_unchanged_slices = 2;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+
+    enc.reuse_unchanged_slices = 1;
+    enc.streaming = 1;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+
+    enc.streaming = 0;
+    enc.transcode = 1;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+}
@@ -0,0 +1,315 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <atomic>
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Streaming: image is kept by application and read by line bands, codestream is written at offsets of slices.*/
+typedef struct StreamFrame {
+    svt_jpeg_xs_image_buffer_t* image;
+    uint32_t pixel_size;
+    Bitstream bitstream;
+    std::atomic<uint32_t> lines_max;
+    uint32_t fail_line; /*Fail read of band with this line, UINT32_MAX - never*/
+} StreamFrame;
+
+static SvtJxsErrorType_t stream_read_lines(void* context, uint32_t component, uint32_t first_line, uint32_t lines_num, void* out,
+                                           uint32_t out_stride) {
+    StreamFrame* frame = (StreamFrame*)context;
+    if (frame->fail_line >= first_line && frame->fail_line < first_line + lines_num) {
+        return SvtJxsErrorUndefined;
+    }
+    const uint32_t stride = frame->image->stride[component] * frame->pixel_size;
+    const uint8_t* in = (const uint8_t*)frame->image->data_yuv[component] + (size_t)first_line * stride;
+    for (uint32_t i = 0; i < lines_num; i++) {
+        memcpy((uint8_t*)out + (size_t)i * out_stride * frame->pixel_size, in + (size_t)i * stride, out_stride * frame->pixel_size);
+    }
+    uint32_t lines_max = frame->lines_max.load();
+    while (lines_num > lines_max && !frame->lines_max.compare_exchange_weak(lines_max, lines_num)) {
+    }
+    return SvtJxsErrorNone;
+}
+
+static SvtJxsErrorType_t stream_write_bytes(void* context, uint32_t offset, const uint8_t* data, uint32_t size) {
+    StreamFrame* frame = (StreamFrame*)context;
+    if ((size_t)offset + size > frame->bitstream.size()) {
+        return SvtJxsErrorBadParameter;
+    }
+    memcpy(frame->bitstream.data() + offset, data, size);
+    return SvtJxsErrorNone;
+}
+
+static void encode_frames_streaming(uint32_t threads_num, std::vector<Bitstream>* bitstreams, uint32_t* lines_max,
+                                    const EncoderConfigure& configure) {
+    TestEncoder encoder;
+    ASSERT_EQ(SvtJxsErrorNone, encoder.init([&](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->threads_num = threads_num;
+        configure(enc);
+        enc->streaming = 1;
+    }));
+    StreamFrame frame;
+    frame.image = encoder.image;
+    frame.pixel_size = encoder.image_config.bit_depth <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+    frame.lines_max = 0;
+    frame.fail_line = UINT32_MAX;
+    svt_jpeg_xs_stream_t stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.read_lines = stream_read_lines;
+    stream.write_bytes = stream_write_bytes;
+    stream.context = &frame;
+
+    for (uint32_t f = 0; f < TEST_FRAMES_NUM; f++) {
+        fill_image(frame.image, f);
+        frame.bitstream.assign(encoder.bytes_per_frame, 0);
+        svt_jpeg_xs_frame_t enc_input;
+        memset(&enc_input, 0, sizeof(enc_input));
+        enc_input.stream = &stream;
+        ASSERT_EQ(SvtJxsErrorNone, encoder.encode(&enc_input, NULL));
+        bitstreams->push_back(frame.bitstream);
+    }
+    *lines_max = frame.lines_max;
+}
+
+/*Encoder configurations of streaming tests, proxy decoding require vertical decomposition.*/
+typedef struct StreamingConfig {
+    EncoderConfigure configure;
+    bool proxy_supported;
+} StreamingConfig;
+
+static const StreamingConfig streaming_configs[] = {
+    {[](svt_jpeg_xs_encoder_api_t*) {}, true},
+    {[](svt_jpeg_xs_encoder_api_t* enc) {
+         enc->colour_format = COLOUR_FORMAT_PLANAR_YUV420;
+         enc->slice_height = 8;
+     },
+     true},
+    {[](svt_jpeg_xs_encoder_api_t* enc) { enc->ndecomp_v = 1; }, true},
+    {[](svt_jpeg_xs_encoder_api_t* enc) { enc->ndecomp_v = 0; }, false},
+    {[](svt_jpeg_xs_encoder_api_t* enc) {
+         enc->rate_control_mode = 2;
+         enc->coding_vertical_prediction_mode = 1;
+     },
+     true}};
+
+/*Codestream written by line band streaming have to be the same as encoded from whole image,
+ *and encoder read only lines of slice with lines around used by vertical DWT.*/
+TEST(EncoderStreaming, match_whole_frame) {
+    for (const StreamingConfig& config : streaming_configs) {
+        std::vector<Bitstream> ref_bitstreams;
+        encode_frames(NULL, 1, 0, &ref_bitstreams, NULL, 0, config.configure);
+        for (uint32_t threads_num : {1u, 4u}) {
+            std::vector<Bitstream> bitstreams;
+            uint32_t lines_max = 0;
+            encode_frames_streaming(threads_num, &bitstreams, &lines_max, config.configure);
+            EXPECT_EQ(ref_bitstreams, bitstreams);
+            /*Default slice height 16 (8 for 420) and 6 lines on both sides for vertical decomposition 2.*/
+            EXPECT_GT(lines_max, 0u);
+            EXPECT_LE(lines_max, 16u + 2 * 6);
+        }
+    }
+}
+
+TEST(EncoderStreaming, read_error_fail_frame) {
+    TestEncoder encoder;
+    ASSERT_EQ(SvtJxsErrorNone, encoder.init([](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->threads_num = 4;
+        enc->streaming = 1;
+    }));
+    StreamFrame frame;
+    frame.image = encoder.image;
+    frame.pixel_size = sizeof(uint8_t);
+    frame.lines_max = 0;
+    frame.bitstream.assign(encoder.bytes_per_frame, 0);
+    svt_jpeg_xs_stream_t stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.read_lines = stream_read_lines;
+    stream.write_bytes = stream_write_bytes;
+    stream.context = &frame;
+
+    svt_jpeg_xs_frame_t enc_input;
+    memset(&enc_input, 0, sizeof(enc_input));
+    /*Frame without stream callbacks*/
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_send_picture(&encoder.api, &enc_input, 1));
+
+    /*Fail in the middle of image, next frame is encoded correctly*/
+    enc_input.stream = &stream;
+    for (uint32_t fail_line : {TEST_HEIGHT / 2u, (uint32_t)UINT32_MAX}) {
+        fill_image(frame.image, 0);
+        frame.fail_line = fail_line;
+        EXPECT_EQ(fail_line == UINT32_MAX ? SvtJxsErrorNone : SvtJxsErrorEncodeFrameError, encoder.encode(&enc_input, NULL));
+    }
+}
+
+TEST(EncoderStreaming, invalid_configuration) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.streaming = 1;
+    enc.slice_packetization_mode = 1;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+}
+
+/*Streaming decoder: lines of every component have to be written in order, each line once.*/
+typedef struct StreamImage {
+    svt_jpeg_xs_image_config_t image_config;
+    uint32_t pixel_size;
+    Bitstream planes;
+    uint32_t lines_next[MAX_COMPONENTS_NUM];
+    uint32_t fail_line; /*Fail write of band with this line, UINT32_MAX - never*/
+} StreamImage;
+
+static SvtJxsErrorType_t stream_write_lines(void* context, uint32_t component, uint32_t first_line, uint32_t lines_num,
+                                            const void* in, uint32_t in_stride) {
+    StreamImage* image = (StreamImage*)context;
+    if (image->fail_line >= first_line && image->fail_line < first_line + lines_num) {
+        return SvtJxsErrorUndefined;
+    }
+    EXPECT_EQ(image->lines_next[component], first_line);
+    EXPECT_LE(first_line + lines_num, image->image_config.components[component].height);
+    const uint32_t width = image->image_config.components[component].width;
+    EXPECT_EQ(width, in_stride);
+    size_t offset = 0;
+    for (uint32_t c = 0; c < component; c++) {
+        offset += image->image_config.components[c].byte_size;
+    }
+    offset += (size_t)first_line * width * image->pixel_size;
+    memcpy(image->planes.data() + offset, in, (size_t)lines_num * width * image->pixel_size);
+    image->lines_next[component] = first_line + lines_num;
+    return SvtJxsErrorNone;
+}
+
+static void decode_frames_streaming(const std::vector<Bitstream>& bitstreams, std::vector<Bitstream>* images,
+                                    proxy_mode_t proxy_mode) {
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.proxy_mode = proxy_mode;
+    dec.streaming = 1;
+    StreamImage image;
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                            SVT_JPEGXS_API_VER_MINOR,
+                                            &dec,
+                                            bitstreams[0].data(),
+                                            bitstreams[0].size(),
+                                            &image.image_config));
+    image.pixel_size = image.image_config.bit_depth <= 8 ? sizeof(uint8_t) : sizeof(uint16_t);
+    image.fail_line = UINT32_MAX;
+    size_t image_size = 0;
+    for (uint32_t c = 0; c < image.image_config.components_num; c++) {
+        image_size += image.image_config.components[c].byte_size;
+    }
+    svt_jpeg_xs_stream_t stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.write_lines = stream_write_lines;
+    stream.context = &image;
+
+    svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_sync_ctx_create(&dec, &sync_ctx));
+    for (const Bitstream& bitstream : bitstreams) {
+        image.planes.assign(image_size, 0);
+        memset(image.lines_next, 0, sizeof(image.lines_next));
+        svt_jpeg_xs_frame_t frame;
+        memset(&frame, 0, sizeof(frame));
+        frame.bitstream.buffer = (uint8_t*)bitstream.data();
+        frame.bitstream.used_size = (uint32_t)bitstream.size();
+        frame.stream = &stream;
+        ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decode_frame_sync(sync_ctx, &frame));
+        for (uint32_t c = 0; c < image.image_config.components_num; c++) {
+            EXPECT_EQ(image.image_config.components[c].height, image.lines_next[c]);
+        }
+        images->push_back(image.planes);
+    }
+    svt_jpeg_xs_decoder_sync_ctx_destroy(sync_ctx);
+    svt_jpeg_xs_decoder_close(&dec);
+}
+
+TEST(DecoderStreaming, match_sync_decoder) {
+    for (const StreamingConfig& config : streaming_configs) {
+        std::vector<Bitstream> bitstreams;
+        encode_frames(NULL, 1, 0, &bitstreams, NULL, 0, config.configure);
+        for (proxy_mode_t proxy_mode : {proxy_mode_full, proxy_mode_half}) {
+            if (proxy_mode != proxy_mode_full && !config.proxy_supported) {
+                continue;
+            }
+            svt_jpeg_xs_decoder_api_t dec;
+            load_test_decoder_config(&dec);
+            dec.proxy_mode = proxy_mode;
+            svt_jpeg_xs_image_config_t image_config;
+            ASSERT_EQ(SvtJxsErrorNone,
+                      svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                                    SVT_JPEGXS_API_VER_MINOR,
+                                                    &dec,
+                                                    bitstreams[0].data(),
+                                                    bitstreams[0].size(),
+                                                    &image_config));
+            std::vector<Bitstream> ref_images;
+            decode_frames_sync(&dec, image_config, bitstreams, &ref_images);
+            svt_jpeg_xs_decoder_close(&dec);
+
+            std::vector<Bitstream> images;
+            decode_frames_streaming(bitstreams, &images, proxy_mode);
+            EXPECT_EQ(ref_images, images);
+        }
+    }
+}
+
+TEST(DecoderStreaming, invalid_usage) {
+    std::vector<Bitstream> bitstreams;
+    encode_frames(NULL, 4, 0, &bitstreams);
+
+    svt_jpeg_xs_decoder_api_t dec;
+    load_test_decoder_config(&dec);
+    dec.streaming = 1;
+    StreamImage image;
+    /*Lines can not be written in order by threaded decoder.*/
+    EXPECT_EQ(SvtJxsErrorBadParameter,
+              svt_jpeg_xs_decoder_init(SVT_JPEGXS_API_VER_MAJOR,
+                                       SVT_JPEGXS_API_VER_MINOR,
+                                       &dec,
+                                       bitstreams[0].data(),
+                                       bitstreams[0].size(),
+                                       &image.image_config));
+    svt_jpeg_xs_decoder_close(&dec);
+
+    ASSERT_EQ(SvtJxsErrorNone,
+              svt_jpeg_xs_decoder_sync_init(SVT_JPEGXS_API_VER_MAJOR,
+                                            SVT_JPEGXS_API_VER_MINOR,
+                                            &dec,
+                                            bitstreams[0].data(),
+                                            bitstreams[0].size(),
+                                            &image.image_config));
+    image.pixel_size = sizeof(uint8_t);
+    size_t image_size = 0;
+    for (uint32_t c = 0; c < image.image_config.components_num; c++) {
+        image_size += image.image_config.components[c].byte_size;
+    }
+    image.planes.assign(image_size, 0);
+    svt_jpeg_xs_decoder_sync_ctx_t* sync_ctx = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_decoder_sync_ctx_create(&dec, &sync_ctx));
+
+    svt_jpeg_xs_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.bitstream.buffer = bitstreams[0].data();
+    frame.bitstream.used_size = (uint32_t)bitstreams[0].size();
+    EXPECT_EQ(SvtJxsErrorDecoderInvalidPointer, svt_jpeg_xs_decode_frame_sync(sync_ctx, &frame));
+
+    /*Error of callback fail frame, next frame is decoded.*/
+    svt_jpeg_xs_stream_t stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.write_lines = stream_write_lines;
+    stream.context = &image;
+    frame.stream = &stream;
+    for (uint32_t fail_line : {TEST_HEIGHT / 2u, (uint32_t)UINT32_MAX}) {
+        memset(image.lines_next, 0, sizeof(image.lines_next));
+        image.fail_line = fail_line;
+        EXPECT_EQ(fail_line == UINT32_MAX ? SvtJxsErrorNone : SvtJxsErrorUndefined,
+                  svt_jpeg_xs_decode_frame_sync(sync_ctx, &frame));
+    }
+    svt_jpeg_xs_decoder_sync_ctx_destroy(sync_ctx);
+    svt_jpeg_xs_decoder_close(&dec);
+}
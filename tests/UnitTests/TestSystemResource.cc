@@ -0,0 +1,126 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "Threads/SystemResourceManager.h"
+
+static SvtJxsErrorType_t test_object_creator(void_ptr *object_dbl_ptr, void_ptr object_init_data_ptr) {
+    (void)object_init_data_ptr;
+    *object_dbl_ptr = calloc(1, sizeof(uint32_t));
+    return *object_dbl_ptr ? SvtJxsErrorNone : SvtJxsErrorInsufficientResources;
+}
+
+static void test_object_destroyer(void_ptr p) {
+    free(p);
+}
+
+class SystemResourceTest : public ::testing::Test {
+  protected:
+    void create(uint32_t objects, uint32_t producers, uint32_t consumers) {
+        memset(&resource, 0, sizeof(resource));
+        ASSERT_EQ(SvtJxsErrorNone,
+                  svt_jxs_system_resource_ctor(
+                      &resource, objects, producers, consumers, test_object_creator, NULL, test_object_destroyer));
+    }
+
+    void TearDown() override {
+        if (resource.dctor) {
+            resource.dctor(&resource);
+        }
+    }
+
+    SystemResource_t resource;
+};
+
+TEST_F(SystemResourceTest, non_blocking_empty_and_full) {
+    create(2, 1, 1);
+    Fifo_t *producer = svt_jxs_system_resource_get_producer_fifo(&resource, 0);
+    Fifo_t *consumer = svt_jxs_system_resource_get_consumer_fifo(&resource, 0);
+    ObjectWrapper_t *wrapper[3];
+
+    svt_jxs_get_full_object_non_blocking(consumer, &wrapper[0]);
+    EXPECT_EQ(NULL, wrapper[0]);
+
+    svt_jxs_get_empty_object_non_blocking(producer, &wrapper[0]);
+    svt_jxs_get_empty_object_non_blocking(producer, &wrapper[1]);
+    svt_jxs_get_empty_object_non_blocking(producer, &wrapper[2]);
+    ASSERT_NE((ObjectWrapper_t *)NULL, wrapper[0]);
+    ASSERT_NE((ObjectWrapper_t *)NULL, wrapper[1]);
+    EXPECT_EQ(NULL, wrapper[2]);
+
+    svt_jxs_post_full_object(wrapper[1]);
+    svt_jxs_get_full_object_non_blocking(consumer, &wrapper[2]);
+    EXPECT_EQ(wrapper[1], wrapper[2]);
+
+    svt_jxs_release_object(wrapper[2]);
+    svt_jxs_get_empty_object_non_blocking(producer, &wrapper[2]);
+    EXPECT_EQ(wrapper[1], wrapper[2]);
+    svt_jxs_release_object(wrapper[0]);
+    svt_jxs_release_object(wrapper[2]);
+}
+
+TEST_F(SystemResourceTest, shutdown_wakes_consumers) {
+    create(2, 1, 2);
+    std::vector<std::thread> consumers;
+    SvtJxsErrorType_t ret[2] = {SvtJxsErrorNone, SvtJxsErrorNone};
+    for (uint32_t i = 0; i < 2; i++) {
+        consumers.emplace_back([&, i]() {
+            ObjectWrapper_t *wrapper = NULL;
+            ret[i] = svt_jxs_get_full_object(svt_jxs_system_resource_get_consumer_fifo(&resource, i), &wrapper);
+            EXPECT_EQ(NULL, wrapper);
+        });
+    }
+    svt_jxs_shutdown_process(&resource);
+    for (auto &t : consumers) {
+        t.join();
+    }
+    EXPECT_EQ(SvtJxsErrorNoErrorFifoShutdown, ret[0]);
+    EXPECT_EQ(SvtJxsErrorNoErrorFifoShutdown, ret[1]);
+}
+
+TEST_F(SystemResourceTest, multi_producer_multi_consumer) {
+    const uint32_t producers_num = 3;
+    const uint32_t consumers_num = 3;
+    const uint32_t objects_per_producer = 20000;
+    create(4, producers_num, consumers_num);
+
+    std::vector<std::thread> threads;
+    std::vector<uint64_t> sums(consumers_num, 0);
+    for (uint32_t i = 0; i < producers_num; i++) {
+        threads.emplace_back([&, i]() {
+            Fifo_t *fifo = svt_jxs_system_resource_get_producer_fifo(&resource, i);
+            for (uint32_t j = 1; j <= objects_per_producer; j++) {
+                ObjectWrapper_t *wrapper = NULL;
+                ASSERT_EQ(SvtJxsErrorNone, svt_jxs_get_empty_object(fifo, &wrapper));
+                *(uint32_t *)wrapper->object_ptr = j;
+                svt_jxs_post_full_object(wrapper);
+            }
+        });
+    }
+    for (uint32_t i = 0; i < consumers_num; i++) {
+        threads.emplace_back([&, i]() {
+            Fifo_t *fifo = svt_jxs_system_resource_get_consumer_fifo(&resource, i);
+            for (uint32_t j = 0; j < objects_per_producer; j++) {
+                ObjectWrapper_t *wrapper = NULL;
+                ASSERT_EQ(SvtJxsErrorNone, svt_jxs_get_full_object(fifo, &wrapper));
+                sums[i] += *(uint32_t *)wrapper->object_ptr;
+                svt_jxs_release_object(wrapper);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < consumers_num; i++) {
+        sum += sums[i];
+    }
+    EXPECT_EQ((uint64_t)producers_num * objects_per_producer * (objects_per_producer + 1) / 2, sum);
+}
@@ -0,0 +1,95 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <vector>
+#include "PipelineTestUtils.h"
+#include "Threads/SvtThreads.h"
+
+TEST(ThreadPlacement, init_default) {
+    svt_jpeg_xs_thread_placement_t placement;
+    memset(&placement, 0xff, sizeof(placement));
+    svt_jpeg_xs_thread_placement_init(&placement);
+    EXPECT_EQ(-1, placement.numa_node);
+    EXPECT_EQ(0, placement.rt_priority);
+    for (uint32_t cpu = 0; cpu < SVT_JPEGXS_CPU_SET_SIZE; cpu++) {
+        ASSERT_EQ(0u, SVT_JPEGXS_CPU_SET_CHECK(&placement.cpu_set, cpu));
+        ASSERT_EQ(0u, SVT_JPEGXS_CPU_SET_CHECK(&placement.slice_cpu_set, cpu));
+    }
+}
+
+#if defined(__linux__)
+static void* get_affinity_kernel(void* context) {
+    cpu_set_t* set = (cpu_set_t*)context;
+    CPU_ZERO(set);
+    sched_getaffinity(0, sizeof(*set), set);
+    return NULL;
+}
+
+/*Return CPUs allowed for test process, first two are used by tests.*/
+static std::vector<uint32_t> get_allowed_cpus() {
+    std::vector<uint32_t> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+TEST(ThreadPlacement, pin_stage_threads) {
+    std::vector<uint32_t> cpus = get_allowed_cpus();
+    if (cpus.size() < 2) {
+        GTEST_SKIP() << "Test require 2 CPUs";
+    }
+    svt_jpeg_xs_thread_placement_t placement;
+    svt_jpeg_xs_thread_placement_init(&placement);
+    SVT_JPEGXS_CPU_SET_ADD(&placement.cpu_set, cpus[0]);
+    SVT_JPEGXS_CPU_SET_ADD(&placement.slice_cpu_set, cpus[1]);
+
+    for (uint8_t slice_stage = 0; slice_stage < 2; slice_stage++) {
+        cpu_set_t set;
+        Handle_t thread = svt_jxs_create_thread_placed(get_affinity_kernel, &set, &placement, slice_stage);
+        ASSERT_NE(nullptr, thread);
+        svt_jxs_destroy_thread(thread);
+        EXPECT_EQ(1, CPU_COUNT(&set));
+        EXPECT_TRUE(CPU_ISSET(cpus[slice_stage], &set));
+    }
+}
+
+TEST(ThreadPlacement, encode_decode_pinned) {
+    std::vector<uint32_t> cpus = get_allowed_cpus();
+    ASSERT_FALSE(cpus.empty());
+    svt_jpeg_xs_thread_placement_t placement;
+    svt_jpeg_xs_thread_placement_init(&placement);
+    SVT_JPEGXS_CPU_SET_ADD(&placement.cpu_set, cpus[0]);
+    SVT_JPEGXS_CPU_SET_ADD(&placement.slice_cpu_set, cpus[cpus.size() - 1]);
+
+    std::vector<Bitstream> ref_bitstreams, bitstreams;
+    std::vector<Bitstream> ref_images, images;
+    encode_frames(NULL, 4, 0, &ref_bitstreams);
+    encode_frames(NULL, 4, 0, &bitstreams, &placement);
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+    decode_frames(NULL, 4, ref_bitstreams, &ref_images);
+    decode_frames(NULL, 4, ref_bitstreams, &images, &placement);
+    EXPECT_EQ(ref_images, images);
+}
+
+TEST(ThreadPlacement, encode_numa_node) {
+    svt_jpeg_xs_thread_placement_t placement;
+    svt_jpeg_xs_thread_placement_init(&placement);
+    placement.numa_node = 0;
+
+    std::vector<Bitstream> ref_bitstreams, bitstreams;
+    encode_frames(NULL, 4, 1, &ref_bitstreams);
+    encode_frames(NULL, 4, 1, &bitstreams, &placement);
+    EXPECT_EQ(ref_bitstreams, bitstreams);
+}
+#endif
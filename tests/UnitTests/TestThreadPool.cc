@@ -0,0 +1,167 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "PipelineTestUtils.h"
+#include "Threads/SvtThreadPool.h"
+
+TEST(ThreadPool, create_invalid) {
+    svt_jpeg_xs_thread_pool_t* pool = NULL;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_thread_pool_create(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &pool, 0));
+    EXPECT_EQ(nullptr, pool);
+    EXPECT_EQ(SvtJxsErrorNone, svt_jpeg_xs_thread_pool_create(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &pool, 2));
+    EXPECT_NE(nullptr, pool);
+    svt_jpeg_xs_thread_pool_destroy(pool);
+}
+
+class ThreadPoolEncDec : public ::testing::TestWithParam<uint8_t> {};
+
+TEST_P(ThreadPoolEncDec, shared_pool_match_own_threads) {
+    const uint8_t cpu_profile = GetParam();
+    const uint32_t instances_num = 3;
+    std::vector<Bitstream> ref_bitstreams;
+    std::vector<Bitstream> ref_images;
+    encode_frames(NULL, 6, cpu_profile, &ref_bitstreams);
+    ASSERT_EQ((size_t)TEST_FRAMES_NUM, ref_bitstreams.size());
+    decode_frames(NULL, 6, ref_bitstreams, &ref_images);
+
+    svt_jpeg_xs_thread_pool_t* pool = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_thread_pool_create(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &pool, 3));
+
+    std::vector<std::vector<Bitstream>> bitstreams(instances_num);
+    std::vector<std::vector<Bitstream>> images(instances_num);
+    std::vector<std::thread> instances;
+    for (uint32_t i = 0; i < instances_num; i++) {
+        instances.emplace_back([&, i]() {
+            encode_frames(pool, 0, cpu_profile, &bitstreams[i]);
+            decode_frames(pool, 0, ref_bitstreams, &images[i]);
+        });
+    }
+    for (auto& t : instances) {
+        t.join();
+    }
+    svt_jpeg_xs_thread_pool_destroy(pool);
+
+    for (uint32_t i = 0; i < instances_num; i++) {
+        EXPECT_EQ(ref_bitstreams, bitstreams[i]);
+        EXPECT_EQ(ref_images, images[i]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, ThreadPoolEncDec, ::testing::Values(0, 1));
+
+/*Lane context of client that record order of executed tasks.*/
+typedef struct FairnessLane {
+    char name;
+    std::atomic<bool>* blocked;
+    std::mutex* mutex;
+    std::string* order;
+} FairnessLane;
+
+static void fairness_run_task(void* lane_ctx) {
+    FairnessLane* lane = (FairnessLane*)lane_ctx;
+    while (lane->blocked->load()) {
+        std::this_thread::yield();
+    }
+    std::lock_guard<std::mutex> lock(*lane->mutex);
+    lane->order->push_back(lane->name);
+}
+
+/*Instance that submit many tasks at once do not delay tasks of other instance.*/
+TEST(ThreadPool, clients_served_round_robin) {
+    svt_jpeg_xs_thread_pool_t* pool = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_thread_pool_create(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &pool, 1));
+    ASSERT_EQ(1u, svt_jxs_thread_pool_get_threads_num(pool));
+
+    std::atomic<bool> blocked(true);
+    std::mutex mutex;
+    std::string order;
+    FairnessLane lanes[2] = {{'A', &blocked, &mutex, &order}, {'B', &blocked, &mutex, &order}};
+    void* lane_ctx[2] = {&lanes[0], &lanes[1]};
+    ThreadPoolClient_t clients[2];
+    memset(clients, 0, sizeof(clients));
+    for (uint32_t i = 0; i < 2; i++) {
+        ASSERT_EQ(SvtJxsErrorNone, svt_jxs_thread_pool_client_ctor(&clients[i], pool, fairness_run_task, &lane_ctx[i]));
+    }
+
+    /*First task of A keeps the only worker busy until all tasks are submitted.*/
+    const uint32_t tasks_num = 4;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jxs_thread_pool_submit(&clients[0]));
+    while (svt_jxs_atomic_load_i32(&clients[0].running) == 0) {
+        std::this_thread::yield();
+    }
+    for (uint32_t i = 0; i < tasks_num; i++) {
+        ASSERT_EQ(SvtJxsErrorNone, svt_jxs_thread_pool_submit(&clients[0]));
+    }
+    for (uint32_t i = 0; i < tasks_num; i++) {
+        ASSERT_EQ(SvtJxsErrorNone, svt_jxs_thread_pool_submit(&clients[1]));
+    }
+    blocked.store(false);
+    for (;;) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (order.size() == 2 * tasks_num + 1) {
+            break;
+        }
+    }
+    EXPECT_EQ("AABABABAB", order);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        clients[i].dctor(&clients[i]);
+    }
+    svt_jpeg_xs_thread_pool_destroy(pool);
+}
+
+/*Encoder whose slices are not received stops in its own Init Stage, pool workers keep encoding other instances.*/
+TEST(ThreadPool, undrained_encoder_not_block_pool) {
+    std::vector<Bitstream> ref_bitstreams;
+    encode_frames(NULL, 3, 0, &ref_bitstreams);
+
+    svt_jpeg_xs_thread_pool_t* pool = NULL;
+    ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_thread_pool_create(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &pool, 1));
+    {
+        TestEncoder undrained;
+        ASSERT_EQ(SvtJxsErrorNone, undrained.init([&](svt_jpeg_xs_encoder_api_t* enc) {
+            enc->thread_pool = pool;
+            enc->threads_num = 0;
+            enc->slice_packetization_mode = 1;
+        }));
+        /*Send frames until input queue stays full, then output queue and all slice outputs of encoder are used.*/
+        std::vector<Bitstream> buffers;
+        uint32_t full_count = 0;
+        while (full_count < 10) {
+            Bitstream buffer(undrained.bytes_per_frame);
+            svt_jpeg_xs_frame_t input = undrained.input_frame();
+            input.bitstream.buffer = buffer.data();
+            if (svt_jpeg_xs_encoder_send_picture(&undrained.api, &input, 0) == SvtJxsErrorNone) {
+                buffers.push_back(std::move(buffer));
+                full_count = 0;
+            }
+            else {
+                full_count++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+        std::vector<Bitstream> bitstreams;
+        encode_frames(pool, 0, 0, &bitstreams);
+        EXPECT_EQ(ref_bitstreams, bitstreams);
+
+        /*Encoder is closed with empty pipeline.*/
+        size_t frames_received = 0;
+        while (frames_received < buffers.size()) {
+            svt_jpeg_xs_frame_t output;
+            ASSERT_EQ(SvtJxsErrorNone, svt_jpeg_xs_encoder_get_packet(&undrained.api, &output, 1));
+            frames_received += output.bitstream.last_packet_in_frame;
+        }
+    }
+    svt_jpeg_xs_thread_pool_destroy(pool);
+}
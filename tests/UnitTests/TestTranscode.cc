@@ -0,0 +1,182 @@
+/*
+* Copyright(c) 2024 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include "PipelineTestUtils.h"
+
+/*Transcode: codestreams are packed again with budget of encoder, image is not used.*/
+static void transcode_frames(uint32_t threads_num, const std::vector<Bitstream>& sources, std::vector<Bitstream>* bitstreams,
+                             const EncoderConfigure& configure = EncoderConfigure(),
+                             SvtJxsErrorType_t expected_error = SvtJxsErrorNone) {
+    TestEncoder encoder;
+    ASSERT_EQ(SvtJxsErrorNone, encoder.init([&](svt_jpeg_xs_encoder_api_t* enc) {
+        enc->threads_num = threads_num;
+        if (configure) {
+            configure(enc);
+        }
+        enc->transcode = 1;
+    }));
+
+    for (const Bitstream& source : sources) {
+        svt_jpeg_xs_bitstream_buffer_t source_buffer;
+        memset(&source_buffer, 0, sizeof(source_buffer));
+        source_buffer.buffer = (uint8_t*)source.data();
+        source_buffer.allocation_size = (uint32_t)source.size();
+        source_buffer.used_size = (uint32_t)source.size();
+        svt_jpeg_xs_frame_t enc_input;
+        memset(&enc_input, 0, sizeof(enc_input));
+        enc_input.bitstream.buffer = encoder.out_buffer.data();
+        enc_input.bitstream.allocation_size = encoder.bytes_per_frame;
+        /*Frame without source codestream*/
+        EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_send_picture(&encoder.api, &enc_input, 1));
+        enc_input.transcode_source = &source_buffer;
+        Bitstream bitstream;
+        ASSERT_EQ(expected_error, encoder.encode(&enc_input, &bitstream));
+        if (expected_error == SvtJxsErrorNone) {
+            ASSERT_EQ(encoder.bytes_per_frame, bitstream.size());
+            bitstreams->push_back(bitstream);
+        }
+    }
+}
+
+static void configure_transcode_source(svt_jpeg_xs_encoder_api_t* enc) {
+    enc->bpp_numerator = 8;
+}
+
+static void configure_rc_slice(svt_jpeg_xs_encoder_api_t* enc) {
+    enc->rate_control_mode = 2;
+    enc->coding_vertical_prediction_mode = 1;
+}
+
+/*Source slice height different from default 16 lines.*/
+static void configure_other_slice_height(svt_jpeg_xs_encoder_api_t* enc) {
+    enc->slice_height = 32;
+}
+
+static void configure_proxy_half(svt_jpeg_xs_encoder_api_t* enc) {
+    enc->source_width = TEST_WIDTH / 2;
+    enc->source_height = TEST_HEIGHT / 2;
+    enc->ndecomp_v = 1;
+    enc->ndecomp_h = 4;
+    enc->slice_height = 8;
+    enc->bpp_numerator = 16;
+    enc->transcode_proxy_mode = proxy_mode_half;
+}
+
+static void configure_proxy_quarter(svt_jpeg_xs_encoder_api_t* enc) {
+    enc->source_width = TEST_WIDTH / 4;
+    enc->source_height = TEST_HEIGHT / 4;
+    enc->ndecomp_v = 0;
+    enc->ndecomp_h = 3;
+    enc->slice_height = 4;
+    enc->bpp_numerator = 16;
+    enc->transcode_proxy_mode = proxy_mode_quarter;
+}
+
+/*Quantization of source with higher bpp is finer than quantization of encoder, so truncated coefficients and
+ *codestream transcoded to lower bpp are the same as encoded from image with that bpp.*/
+TEST(EncoderTranscode, lower_bpp_match_direct_encode) {
+    struct {
+        EncoderConfigure configure_source;
+        EncoderConfigure configure;
+    } configs[] = {{configure_transcode_source, EncoderConfigure()},
+                   {[](svt_jpeg_xs_encoder_api_t* enc) {
+                        configure_transcode_source(enc);
+                        configure_rc_slice(enc);
+                    },
+                    EncoderConfigure()},
+                   {configure_transcode_source, configure_rc_slice}};
+    for (auto& config : configs) {
+        std::vector<Bitstream> sources;
+        encode_frames(NULL, 1, 0, &sources, NULL, 0, config.configure_source);
+        std::vector<Bitstream> ref_bitstreams;
+        encode_frames(NULL, 1, 0, &ref_bitstreams, NULL, 0, config.configure);
+        for (uint32_t threads_num : {1u, 4u}) {
+            std::vector<Bitstream> bitstreams;
+            transcode_frames(threads_num, sources, &bitstreams, config.configure);
+            EXPECT_EQ(ref_bitstreams, bitstreams);
+        }
+    }
+}
+
+/*Proxy codestream keeps lower bands of source, with budget big enough to not quantize them again
+ *decoded image is the same as proxy decoding of source.*/
+TEST(EncoderTranscode, proxy_match_proxy_decode) {
+    struct {
+        EncoderConfigure configure;
+        proxy_mode_t proxy_mode;
+    } configs[] = {{configure_proxy_half, proxy_mode_half}, {configure_proxy_quarter, proxy_mode_quarter}};
+    std::vector<Bitstream> sources;
+    encode_frames(NULL, 1, 0, &sources);
+    for (auto& config : configs) {
+        const proxy_mode_t proxy_mode = config.proxy_mode;
+        std::vector<Bitstream> ref_images;
+        decode_frames(NULL, 1, sources, &ref_images, NULL, [proxy_mode](svt_jpeg_xs_decoder_api_t* dec) {
+            dec->proxy_mode = proxy_mode;
+        });
+        for (uint32_t threads_num : {1u, 4u}) {
+            std::vector<Bitstream> bitstreams;
+            transcode_frames(threads_num, sources, &bitstreams, config.configure);
+            std::vector<Bitstream> images;
+            decode_frames(NULL, 1, bitstreams, &images);
+            ASSERT_EQ(ref_images.size(), images.size());
+            for (size_t f = 0; f < images.size(); f++) {
+                ASSERT_EQ(ref_images[f].size(), images[f].size());
+                int32_t diff_max = 0;
+                for (size_t i = 0; i < images[f].size(); i++) {
+                    diff_max = std::max(diff_max, std::abs((int32_t)ref_images[f][i] - (int32_t)images[f][i]));
+                }
+                /*Rounding of output in different decomposition levels*/
+                EXPECT_LE(diff_max, 1);
+            }
+        }
+    }
+}
+
+TEST(EncoderTranscode, invalid_source_fail_frame) {
+    std::vector<Bitstream> sources;
+    encode_frames(NULL, 1, 0, &sources, NULL, 0, configure_other_slice_height);
+    std::vector<Bitstream> bitstreams;
+    transcode_frames(2, sources, &bitstreams, EncoderConfigure(), SvtJxsErrorEncodeFrameError);
+
+    /*Truncated source*/
+    sources.clear();
+    encode_frames(NULL, 1, 0, &sources, NULL, 0, configure_transcode_source);
+    for (Bitstream& source : sources) {
+        source.resize(source.size() / 2);
+    }
+    transcode_frames(2, sources, &bitstreams, EncoderConfigure(), SvtJxsErrorEncodeFrameError);
+
+    /*Proxy of source have different slice height*/
+    sources.clear();
+    encode_frames(NULL, 1, 0, &sources, NULL, 0, configure_other_slice_height);
+    transcode_frames(2, sources, &bitstreams, configure_proxy_half, SvtJxsErrorEncodeFrameError);
+}
+
+TEST(EncoderTranscode, invalid_configuration) {
+    svt_jpeg_xs_encoder_api_t enc;
+    load_test_encoder_config(&enc);
+    enc.transcode = 1;
+    enc.streaming = 1;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+
+    /*DWT Stage of profile CPU is not used by transcode*/
+    enc.streaming = 0;
+    enc.cpu_profile = 1;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+
+    /*Proxy mode without transcode*/
+    enc.cpu_profile = 0;
+    enc.transcode = 0;
+    enc.transcode_proxy_mode = proxy_mode_half;
+    EXPECT_EQ(SvtJxsErrorBadParameter, svt_jpeg_xs_encoder_init(SVT_JPEGXS_API_VER_MAJOR, SVT_JPEGXS_API_VER_MINOR, &enc));
+    svt_jpeg_xs_encoder_close(&enc);
+}
@@ -12,9 +12,9 @@
 #include "BitstreamWriter.h"
 #include "Codestream.h"
 
-typedef SvtJxsErrorType_t (*unpack_data)(bitstream_reader_t* bitstream, uint16_t* buf, uint32_t w, uint8_t* gclis,
-                                         uint32_t group_size, uint8_t gtli, uint8_t sign_flag, uint8_t* leftover_signs_num,
-                                         int32_t* precinct_bits_left);
+typedef SvtJxsErrorType_t (*unpack_data_fn)(bitstream_reader_t* bitstream, uint16_t* buf, uint32_t w, uint8_t* gclis,
+                                            uint32_t group_size, uint8_t gtli, uint8_t sign_flag, uint8_t* leftover_signs_num,
+                                            int32_t* precinct_bits_left);
 
 SvtJxsErrorType_t unpack_data_old(bitstream_reader_t* bitstream, uint16_t* buf, uint32_t w, uint8_t* gclis, uint32_t group_size,
                                   uint8_t gtli, uint8_t sign_flag, uint8_t* leftover_signs_num, int32_t* precinct_bits_left) {
@@ -131,7 +131,7 @@ SvtJxsErrorType_t unpack_data_old(bitstream_reader_t* bitstream, uint16_t* buf,
     return SvtJxsErrorNone;
 }
 
-static void unpack_test(unpack_data unpack_data_test) {
+static void unpack_test(unpack_data_fn unpack_data_test) {
     const uint32_t gcli_size = 50;
     const uint32_t bitstream_reader_size = 80;
     const uint32_t out_buffer_size = 1024;